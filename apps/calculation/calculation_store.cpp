@@ -1,9 +1,11 @@
 #include "calculation_store.h"
 #include "../shared/poincare_helpers.h"
+#include <poincare/integral.h>
 #include <poincare/rational.h>
 #include <poincare/symbol.h>
 #include <poincare/undefined.h>
 #include <assert.h>
+#include <cmath>
 
 using namespace Poincare;
 using namespace Shared;
@@ -49,6 +51,20 @@ ExpiringPointer<Calculation> CalculationStore::calculationAtIndex(int i) {
   return calculationAtIndex(i);
 }
 
+/* The approximate output of an integral only keeps the digits left by its
+ * estimated error. */
+static Expression ApproximateIntegral(const Integral integral, Context * context) {
+  double absoluteError;
+  double value = PoincareHelpers::ApproximateWithError<double>(integral, context, &absoluteError);
+  if (std::isnan(value)) {
+    return Undefined::Builder();
+  }
+  int numberOfSignificantDigits = PoincareHelpers::NumberOfSignificantDigitsWithError(value, absoluteError, PrintFloat::k_numberOfStoredSignificantDigits);
+  char buffer[PrintFloat::k_maxFloatCharSize];
+  PoincareHelpers::ConvertFloatToText<double>(value, buffer, PrintFloat::k_maxFloatCharSize, numberOfSignificantDigits);
+  return Expression::Parse(buffer);
+}
+
 ExpiringPointer<Calculation> CalculationStore::push(const char * text, Context * context) {
   /* Compute ans now, before the buffer is slided and before the calculation
    * might be deleted */
@@ -91,7 +107,13 @@ ExpiringPointer<Calculation> CalculationStore::push(const char * text, Context *
   // Compute and serialize the outputs
   {
     Expression outputs[] = {Expression(), Expression()};
-    PoincareHelpers::ParseAndSimplifyAndApproximate(inputSerialization, &(outputs[0]), &(outputs[1]), context, false);
+    Expression input = Expression::Parse(inputSerialization);
+    if (input.type() == ExpressionNode::Type::Integral) {
+      PoincareHelpers::ParseAndSimplifyAndApproximate(inputSerialization, &(outputs[0]), nullptr, context, false);
+      outputs[1] = ApproximateIntegral(static_cast<Integral &>(input), context);
+    } else {
+      PoincareHelpers::ParseAndSimplifyAndApproximate(inputSerialization, &(outputs[0]), &(outputs[1]), context, false);
+    }
     for (int i = 0; i < 2; i++) {
       if (!serializeExpression(outputs[i], nextSerializationLocation, &newCalculationsLocation)) {
         /* If the exat/approximate output does not fit in the store (event if the
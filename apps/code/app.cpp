@@ -75,6 +75,7 @@ App::App(Snapshot * snapshot) :
   Shared::InputEventHandlerDelegateApp(snapshot, &m_codeStackViewController),
   m_pythonHeap{},
   m_pythonUser(nullptr),
+  m_scriptCache(),
   m_consoleController(nullptr, this, snapshot->scriptStore()
 #if EPSILON_GETOPT
       , snapshot->lockOnConsole()
@@ -85,11 +86,13 @@ App::App(Snapshot * snapshot) :
   m_codeStackViewController(&m_modalViewController, &m_listFooter),
   m_variableBoxController(snapshot->scriptStore())
 {
+  snapshot->scriptStore()->setCache(&m_scriptCache);
 }
 
 App::~App() {
   assert(!m_consoleController.inputRunLoopActive());
   deinitPython();
+  static_cast<Snapshot *>(snapshot())->scriptStore()->setCache(nullptr);
 }
 
 bool App::handleEvent(Ion::Events::Event event) {
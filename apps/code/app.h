@@ -6,6 +6,7 @@
 #include "../shared/input_event_handler_delegate_app.h"
 #include "console_controller.h"
 #include "menu_controller.h"
+#include "script_cache.h"
 #include "script_store.h"
 #include "python_toolbox.h"
 #include "variable_box_controller.h"
@@ -77,6 +78,9 @@ private:
   static constexpr int k_pythonHeapSize = 16384;
   char m_pythonHeap[k_pythonHeapSize];
   const void * m_pythonUser;
+  /* The parse results and bytecode of the scripts outlive the Python
+   * environments, so that unchanged scripts are not compiled again. */
+  ScriptCache m_scriptCache;
 
   App(Snapshot * snapshot);
   ConsoleController m_consoleController;
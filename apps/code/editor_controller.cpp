@@ -20,6 +20,9 @@ EditorController::EditorController(MenuController * menuController, App * python
 
 void EditorController::setScript(Script script) {
   m_script = script;
+  /* A compressed script is written uncompressed while it is edited, for its
+   * size in the storage to be the size of its text. */
+  m_script.decompress();
   Script::Data scriptData = m_script.value();
   size_t availableScriptSize = scriptData.size + Ion::Storage::sharedStorage()->availableSize();
   assert(sizeof(m_areaBuffer) >= availableScriptSize);
@@ -72,9 +72,8 @@ bool Script::importationStatus() const {
 }
 
 void Script::toggleImportationStatus() {
-  Data d = value();
-  ((char *)d.buffer)[0] = (((char *)d.buffer)[0] == 1 ? 0 : 1);
-  setValue(d);
+  char importationStatus = Script::importationStatus() ? 0 : 1;
+  patchValue(0, &importationStatus, k_importationStatusSize);
 }
 
 const char * Script::readContent() const {
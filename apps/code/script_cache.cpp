@@ -0,0 +1,110 @@
+#include "script_cache.h"
+#include <assert.h>
+#include <string.h>
+
+namespace Code {
+
+constexpr char ScriptCache::k_functionMarker;
+constexpr char ScriptCache::k_variableMarker;
+
+const char * ScriptCache::namesOfScript(uint32_t checksum, size_t * size) const {
+  const EntryHeader * entry = entryForChecksum(checksum);
+  if (entry == nullptr || entry->namesSize == 0) {
+    return nullptr;
+  }
+  *size = entry->namesSize;
+  return reinterpret_cast<const char *>(entry + 1);
+}
+
+const void * ScriptCache::bytecodeOfScript(uint32_t checksum, size_t * size) const {
+  const EntryHeader * entry = entryForChecksum(checksum);
+  if (entry == nullptr || entry->bytecodeSize == 0) {
+    return nullptr;
+  }
+  *size = entry->bytecodeSize;
+  return reinterpret_cast<const char *>(entry + 1) + entry->namesSize;
+}
+
+void ScriptCache::storeNames(uint32_t checksum, const char * names, size_t size) {
+  const EntryHeader * previousEntry = entryForChecksum(checksum);
+  if (previousEntry != nullptr) {
+    deleteEntry(previousEntry);
+  }
+  if (sizeof(EntryHeader) + size > k_bufferSize) {
+    return;
+  }
+  EntryHeader header = {checksum, static_cast<uint16_t>(size), 0};
+  makeRoom(EntrySize(&header));
+  EntryHeader * entry = entryAt(m_size);
+  *entry = header;
+  memcpy(entry + 1, names, size);
+  m_size += EntrySize(entry);
+}
+
+void ScriptCache::storeBytecode(uint32_t checksum, const void * bytecode, size_t size) {
+  if (m_size == 0 || sizeof(EntryHeader) + size > k_bufferSize) {
+    return;
+  }
+  size_t lastEntryOffset = offsetOfLastEntry();
+  EntryHeader * entry = entryAt(lastEntryOffset);
+  if (entry->checksum != checksum || entry->bytecodeSize != 0) {
+    return;
+  }
+  EntryHeader header = *entry;
+  header.bytecodeSize = size;
+  size_t additionalSize = EntrySize(&header) - EntrySize(entry);
+  // Delete the oldest entries, but not the entry of the script
+  while (k_bufferSize - m_size < additionalSize && lastEntryOffset > 0) {
+    size_t firstEntrySize = EntrySize(entryAt(0));
+    deleteEntry(entryAt(0));
+    lastEntryOffset -= firstEntrySize;
+  }
+  if (k_bufferSize - m_size < additionalSize) {
+    return;
+  }
+  entry = entryAt(lastEntryOffset);
+  entry->bytecodeSize = size;
+  memcpy(reinterpret_cast<char *>(entry + 1) + entry->namesSize, bytecode, size);
+  m_size += additionalSize;
+}
+
+size_t ScriptCache::EntrySize(const EntryHeader * header) {
+  size_t size = sizeof(EntryHeader) + header->namesSize + header->bytecodeSize;
+  // Keep the headers aligned
+  return (size + alignof(EntryHeader) - 1) / alignof(EntryHeader) * alignof(EntryHeader);
+}
+
+const ScriptCache::EntryHeader * ScriptCache::entryForChecksum(uint32_t checksum) const {
+  for (size_t offset = 0; offset < m_size; offset += EntrySize(entryAt(offset))) {
+    if (entryAt(offset)->checksum == checksum) {
+      return entryAt(offset);
+    }
+  }
+  return nullptr;
+}
+
+size_t ScriptCache::offsetOfLastEntry() const {
+  assert(m_size > 0);
+  size_t offset = 0;
+  while (offset + EntrySize(entryAt(offset)) < m_size) {
+    offset += EntrySize(entryAt(offset));
+  }
+  return offset;
+}
+
+void ScriptCache::deleteEntry(const EntryHeader * entry) {
+  char * start = reinterpret_cast<char *>(const_cast<EntryHeader *>(entry));
+  size_t entrySize = EntrySize(entry);
+  size_t end = start - m_buffer + entrySize;
+  memmove(start, start + entrySize, m_size - end);
+  m_size -= entrySize;
+}
+
+void ScriptCache::makeRoom(size_t size) {
+  assert(size <= k_bufferSize);
+  while (k_bufferSize - m_size < size) {
+    deleteEntry(entryAt(0));
+  }
+}
+
+}
@@ -0,0 +1,57 @@
+#ifndef CODE_SCRIPT_CACHE_H
+#define CODE_SCRIPT_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Code {
+
+/* The script cache keeps what was computed from the scripts last imported or
+ * scanned for the variable box, so that unchanged scripts are neither parsed
+ * nor compiled again while the app is open: the names of the functions and
+ * variables they define, and the bytecode they compile to. The entries are
+ * keyed by the checksum of the script records, which changes whenever a script
+ * is edited. When there is no room left to store a new entry, the oldest
+ * entries are deleted.
+ *
+ * Entry : | Checksum | Names size | Bytecode size | Names | Bytecode |
+ * The names are null-terminated strings, each prefixed by k_functionMarker or
+ * k_variableMarker, and followed by an empty string. The names of an entry
+ * whose names did not fit have a size of 0: it only keeps the bytecode. */
+
+class ScriptCache {
+public:
+  static constexpr char k_functionMarker = 'f';
+  static constexpr char k_variableMarker = 'v';
+  ScriptCache() : m_size(0) {}
+  // Return the names of the script, or nullptr when they are not cached
+  const char * namesOfScript(uint32_t checksum, size_t * size) const;
+  // Return the bytecode of the script, or nullptr when it is not cached
+  const void * bytecodeOfScript(uint32_t checksum, size_t * size) const;
+  /* Replace the entry of the script with an entry that has no bytecode, and no
+   * names if size is 0. */
+  void storeNames(uint32_t checksum, const char * names, size_t size);
+  /* Add the bytecode of the script to the last stored entry, if it is the one
+   * of the script. */
+  void storeBytecode(uint32_t checksum, const void * bytecode, size_t size);
+private:
+  struct EntryHeader {
+    uint32_t checksum;
+    uint16_t namesSize;
+    uint16_t bytecodeSize;
+  };
+  static constexpr size_t k_bufferSize = 4096;
+  static size_t EntrySize(const EntryHeader * header);
+  EntryHeader * entryAt(size_t offset) const { return reinterpret_cast<EntryHeader *>(const_cast<char *>(m_buffer + offset)); }
+  const EntryHeader * entryForChecksum(uint32_t checksum) const;
+  size_t offsetOfLastEntry() const;
+  void deleteEntry(const EntryHeader * entry);
+  // Delete the oldest entries until size bytes are available
+  void makeRoom(size_t size);
+  alignas(EntryHeader) char m_buffer[k_bufferSize];
+  size_t m_size;
+};
+
+}
+
+#endif
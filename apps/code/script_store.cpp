@@ -1,5 +1,6 @@
 #include "script_store.h"
 #include "string.h"
+#include <assert.h>
 #include <stddef.h>
 
 extern "C" {
@@ -16,7 +17,8 @@ bool ScriptStore::ScriptNameIsFree(const char * baseName) {
   return Ion::Storage::sharedStorage()->recordBaseNamedWithExtension(baseName, k_scriptExtension).isNull();
 }
 
-ScriptStore::ScriptStore()
+ScriptStore::ScriptStore() :
+  m_cache(nullptr)
 {
   addScriptFromTemplate(ScriptTemplate::Squares());
   addScriptFromTemplate(ScriptTemplate::Mandelbrot());
@@ -38,78 +40,37 @@ void ScriptStore::scanScriptsForFunctionsAndVariables(void * context, ScanCallba
     // Handle lexer or parser errors with nlr.
     nlr_buf_t nlr;
     if (nlr_push(&nlr) == 0) {
-      const char * scriptContent = scriptAtIndex(scriptIndex).readContent();
-      if (scriptContent == nullptr) {
-        continue;
-      }
-      mp_lexer_t *lex = mp_lexer_new_from_str_len(0, scriptContent, strlen(scriptContent), false);
-      mp_parse_tree_t parseTree = mp_parse(lex, MP_PARSE_FILE_INPUT);
-      mp_parse_node_t pn = parseTree.root;
-
-      if (!MP_PARSE_NODE_IS_STRUCT(pn)) {
-        mp_parse_tree_clear(&parseTree);
-        nlr_pop();
-        continue;
-      }
-
-      mp_parse_node_struct_t *pns = (mp_parse_node_struct_t*)pn;
-
-      // The script is only a single function definition.
-      if (((uint)(MP_PARSE_NODE_STRUCT_KIND(pns))) == k_functionDefinitionParseNodeStructKind) {
-        const char * id = structID(pns);
-        if (id == nullptr) {
-          continue;
-        }
-        storeFunction(context, id, scriptIndex);
-        mp_parse_tree_clear(&parseTree);
-        nlr_pop();
-        continue;
-      }
-
-      // The script is only a single global variable definition.
-      if (((uint)(MP_PARSE_NODE_STRUCT_KIND(pns))) == k_expressionStatementParseNodeStructKind) {
-        const char * id = structID(pns);
-        if (id == nullptr) {
-          continue;
+      Script script = scriptAtIndex(scriptIndex);
+      uint32_t checksum = script.checksum();
+      size_t namesSize = 0;
+      const char * names = m_cache != nullptr ? m_cache->namesOfScript(checksum, &namesSize) : nullptr;
+      char parsedNames[k_maxNamesSize];
+      if (names == nullptr) {
+        const char * scriptContent = script.readContent();
+        mp_lexer_t *lex = mp_lexer_new_from_str_len(0, scriptContent, strlen(scriptContent), false);
+        mp_parse_tree_t parseTree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        namesSize = namesOfParseTree(parseTree.root, parsedNames);
+        if (namesSize == 0) {
+          scanParseTree(parseTree.root, scriptIndex, context, storeFunction, storeVariable);
+        } else {
+          names = parsedNames;
+          if (m_cache != nullptr) {
+            m_cache->storeNames(checksum, parsedNames, namesSize);
+          }
         }
-        storeVariable(context, id, scriptIndex);
         mp_parse_tree_clear(&parseTree);
-        nlr_pop();
-        continue;
       }
-
-      if (((uint)(MP_PARSE_NODE_STRUCT_KIND(pns))) != k_fileInput2ParseNodeStructKind) {
-        // The script node is not of type "file_input_2", thus it will not have main
-        // structures of the wanted type.
-        mp_parse_tree_clear(&parseTree);
-        nlr_pop();
-        continue;
-      }
-
-      // Count the number of structs in child nodes.
-
-      size_t n = MP_PARSE_NODE_STRUCT_NUM_NODES(pns);
-      for (size_t i = 0; i < n; i++) {
-        mp_parse_node_t child = pns->nodes[i];
-        if (MP_PARSE_NODE_IS_STRUCT(child)) {
-          mp_parse_node_struct_t *child_pns = (mp_parse_node_struct_t*)(child);
-          if (((uint)(MP_PARSE_NODE_STRUCT_KIND(child_pns))) == k_functionDefinitionParseNodeStructKind) {
-            const char * id = structID(child_pns);
-            if (id == nullptr) {
-              continue;
-            }
-            storeFunction(context, id, scriptIndex);
-          } else if (((uint)(MP_PARSE_NODE_STRUCT_KIND(child_pns))) == k_expressionStatementParseNodeStructKind) {
-            const char * id = structID(child_pns);
-            if (id == nullptr) {
-              continue;
-            }
-            storeVariable(context, id, scriptIndex);
-          }
+      /* The callbacks keep the names, which are thus given as qstrs to live as
+       * long as the Python environment. */
+      for (const char * name = names; name != nullptr && *name != 0; name += strlen(name) + 1) {
+        const char * id = qstr_str(qstr_from_str(name + 1));
+        if (*name == ScriptCache::k_functionMarker) {
+          storeFunction(context, id, scriptIndex);
+        } else {
+          assert(*name == ScriptCache::k_variableMarker);
+          storeVariable(context, id, scriptIndex);
         }
       }
-
-      mp_parse_tree_clear(&parseTree);
       nlr_pop();
     }
   }
@@ -123,6 +84,35 @@ const char * ScriptStore::contentOfScript(const char * name) {
   return script.readContent();
 }
 
+const void * ScriptStore::bytecodeOfScript(const char * name, size_t * size) {
+  Script script = scriptNamed(name);
+  if (m_cache == nullptr || script.isNull()) {
+    return nullptr;
+  }
+  return m_cache->bytecodeOfScript(script.checksum(), size);
+}
+
+void ScriptStore::willCompileScript(const char * name, mp_parse_node_t root) {
+  Script script = scriptNamed(name);
+  if (m_cache == nullptr || script.isNull()) {
+    return;
+  }
+  /* Cache the names of the functions and variables of the script, which are
+   * stored along its bytecode when it is compiled. When they do not fit, the
+   * entry only keeps the bytecode. */
+  char names[k_maxNamesSize];
+  size_t namesSize = namesOfParseTree(root, names);
+  m_cache->storeNames(script.checksum(), names, namesSize);
+}
+
+void ScriptStore::didCompileScript(const char * name, const void * bytecode, size_t size) {
+  Script script = scriptNamed(name);
+  if (m_cache == nullptr || script.isNull()) {
+    return;
+  }
+  m_cache->storeBytecode(script.checksum(), bytecode, size);
+}
+
 Script::ErrorStatus ScriptStore::addScriptFromTemplate(const ScriptTemplate * scriptTemplate) {
   size_t valueSize = strlen(scriptTemplate->content())+1+1;// scriptcontent size + 1 char for the importation status
   assert(Script::nameCompliant(scriptTemplate->name()));
@@ -131,6 +121,92 @@ Script::ErrorStatus ScriptStore::addScriptFromTemplate(const ScriptTemplate * sc
   return err;
 }
 
+void ScriptStore::scanParseTree(mp_parse_node_t root, int scriptIndex, void * context, ScanCallback storeFunction, ScanCallback storeVariable) {
+  if (!MP_PARSE_NODE_IS_STRUCT(root)) {
+    return;
+  }
+
+  mp_parse_node_struct_t *pns = (mp_parse_node_struct_t*)root;
+
+  // The script is only a single function definition.
+  if (((uint)(MP_PARSE_NODE_STRUCT_KIND(pns))) == k_functionDefinitionParseNodeStructKind) {
+    const char * id = structID(pns);
+    if (id != nullptr) {
+      storeFunction(context, id, scriptIndex);
+    }
+    return;
+  }
+
+  // The script is only a single global variable definition.
+  if (((uint)(MP_PARSE_NODE_STRUCT_KIND(pns))) == k_expressionStatementParseNodeStructKind) {
+    const char * id = structID(pns);
+    if (id != nullptr) {
+      storeVariable(context, id, scriptIndex);
+    }
+    return;
+  }
+
+  if (((uint)(MP_PARSE_NODE_STRUCT_KIND(pns))) != k_fileInput2ParseNodeStructKind) {
+    // The script node is not of type "file_input_2", thus it will not have main
+    // structures of the wanted type.
+    return;
+  }
+
+  // Count the number of structs in child nodes.
+
+  size_t n = MP_PARSE_NODE_STRUCT_NUM_NODES(pns);
+  for (size_t i = 0; i < n; i++) {
+    mp_parse_node_t child = pns->nodes[i];
+    if (MP_PARSE_NODE_IS_STRUCT(child)) {
+      mp_parse_node_struct_t *child_pns = (mp_parse_node_struct_t*)(child);
+      if (((uint)(MP_PARSE_NODE_STRUCT_KIND(child_pns))) == k_functionDefinitionParseNodeStructKind) {
+        const char * id = structID(child_pns);
+        if (id == nullptr) {
+          continue;
+        }
+        storeFunction(context, id, scriptIndex);
+      } else if (((uint)(MP_PARSE_NODE_STRUCT_KIND(child_pns))) == k_expressionStatementParseNodeStructKind) {
+        const char * id = structID(child_pns);
+        if (id == nullptr) {
+          continue;
+        }
+        storeVariable(context, id, scriptIndex);
+      }
+    }
+  }
+}
+
+struct NamesBuffer {
+  char * names;
+  size_t size;
+  size_t maxSize;
+  bool overflows;
+};
+
+template<char Marker>
+static void AppendName(void * context, const char * name, int scriptIndex) {
+  NamesBuffer * buffer = static_cast<NamesBuffer *>(context);
+  size_t nameSize = strlen(name) + 1;
+  // Keep room for the marker and the empty string ending the names
+  if (buffer->overflows || buffer->size + 1 + nameSize + 1 > buffer->maxSize) {
+    buffer->overflows = true;
+    return;
+  }
+  buffer->names[buffer->size++] = Marker;
+  memcpy(buffer->names + buffer->size, name, nameSize);
+  buffer->size += nameSize;
+}
+
+size_t ScriptStore::namesOfParseTree(mp_parse_node_t root, char * names) {
+  NamesBuffer buffer = {names, 0, k_maxNamesSize, false};
+  scanParseTree(root, 0, &buffer, AppendName<ScriptCache::k_functionMarker>, AppendName<ScriptCache::k_variableMarker>);
+  if (buffer.overflows) {
+    return 0;
+  }
+  names[buffer.size++] = 0;
+  return buffer.size;
+}
+
 const char * ScriptStore::structID(mp_parse_node_struct_t *structNode) {
   // Find the id child node, which stores the struct's name
   size_t childNodesCount = MP_PARSE_NODE_STRUCT_NUM_NODES(structNode);
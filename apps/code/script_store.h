@@ -3,6 +3,7 @@
 
 #include <ion.h>
 #include "script.h"
+#include "script_cache.h"
 #include "script_template.h"
 #include <python/port/port.h>
 extern "C" {
@@ -35,12 +36,19 @@ public:
   void deleteAllScripts();
   bool isFull();
 
+  /* The cache of the scripts is owned by the app, and is only set while the
+   * app is open. */
+  void setCache(ScriptCache * cache) { m_cache = cache; }
+
   /* Provide scripts content information */
   typedef void (* ScanCallback)(void * context, const char * p, int n);
   void scanScriptsForFunctionsAndVariables(void * context, ScanCallback storeFunction,ScanCallback storeVariable);
 
   /* MicroPython::ScriptProvider */
   const char * contentOfScript(const char * name) override;
+  const void * bytecodeOfScript(const char * name, size_t * size) override;
+  void willCompileScript(const char * name, mp_parse_node_t root) override;
+  void didCompileScript(const char * name, const void * bytecode, size_t size) override;
 
   Ion::Storage::Record::ErrorStatus addScriptFromTemplate(const ScriptTemplate * scriptTemplate);
 private:
@@ -51,10 +59,19 @@ private:
    * importation status (1 char), the default content "from math import *\n"
    * (20 char) and 10 char of free space. */
   static constexpr int k_fullFreeSpaceSizeLimit = sizeof(Ion::Storage::record_size_t)+Script::k_defaultScriptNameMaxSize+k_scriptExtensionLength+1+20+10;
+  /* The names of the functions and variables of a script are cached unless
+   * they do not fit in k_maxNamesSize, in which case its bytecode is cached
+   * without them. */
+  static constexpr size_t k_maxNamesSize = 512;
   static constexpr size_t k_fileInput2ParseNodeStructKind = 1;
   static constexpr size_t k_functionDefinitionParseNodeStructKind = 3;
   static constexpr size_t k_expressionStatementParseNodeStructKind = 5;
+  void scanParseTree(mp_parse_node_t root, int scriptIndex, void * context, ScanCallback storeFunction, ScanCallback storeVariable);
+  /* Write the names of the functions and variables of the parse tree in the
+   * format of ScriptCache, and return their size, or 0 if they do not fit. */
+  size_t namesOfParseTree(mp_parse_node_t root, char * names);
   const char * structID(mp_parse_node_struct_t *structNode);
+  ScriptCache * m_cache;
 };
 
 }
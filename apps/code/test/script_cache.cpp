@@ -0,0 +1,140 @@
+#include <quiz.h>
+#include <string.h>
+#include <assert.h>
+#include "../script_cache.h"
+#include "../script_store.h"
+
+namespace Code {
+
+static void fill_names(char * names, size_t size, char c) {
+  names[0] = ScriptCache::k_functionMarker;
+  memset(names + 1, c, size - 3);
+  names[size - 2] = 0;
+  names[size - 1] = 0;
+}
+
+QUIZ_CASE(code_script_cache_eviction) {
+  static ScriptCache cache;
+  constexpr size_t namesSize = 500;
+  char names[namesSize];
+  size_t size = 0;
+
+  // The oldest entries are deleted to make room for a new one
+  constexpr uint32_t numberOfEntries = 9;
+  for (uint32_t checksum = 1; checksum <= numberOfEntries; checksum++) {
+    fill_names(names, namesSize, 'a' + checksum);
+    cache.storeNames(checksum, names, namesSize);
+  }
+  quiz_assert(cache.namesOfScript(1, &size) == nullptr);
+  for (uint32_t checksum = 2; checksum <= numberOfEntries; checksum++) {
+    const char * cachedNames = cache.namesOfScript(checksum, &size);
+    fill_names(names, namesSize, 'a' + checksum);
+    quiz_assert(cachedNames != nullptr && size == namesSize && memcmp(cachedNames, names, namesSize) == 0);
+  }
+
+  // Storing the names of a script again replaces its entry
+  fill_names(names, namesSize, 'z');
+  cache.storeNames(2, names, namesSize);
+  const char * cachedNames = cache.namesOfScript(2, &size);
+  quiz_assert(cachedNames != nullptr && memcmp(cachedNames, names, namesSize) == 0);
+  quiz_assert(cache.namesOfScript(3, &size) != nullptr);
+}
+
+QUIZ_CASE(code_script_cache_bytecode) {
+  static ScriptCache cache;
+  const char names[] = "fsquare\0vside\0";
+  const char bytecode[] = "bytecode";
+  const char otherBytecode[] = "other bytecode";
+  size_t size = 0;
+
+  // Bytecode is only added to the last stored entry
+  cache.storeNames(1, names, sizeof(names));
+  cache.storeNames(2, names, sizeof(names));
+  cache.storeBytecode(1, bytecode, sizeof(bytecode));
+  quiz_assert(cache.bytecodeOfScript(1, &size) == nullptr);
+  cache.storeBytecode(2, bytecode, sizeof(bytecode));
+  const void * cachedBytecode = cache.bytecodeOfScript(2, &size);
+  quiz_assert(cachedBytecode != nullptr && size == sizeof(bytecode) && memcmp(cachedBytecode, bytecode, size) == 0);
+  const char * cachedNames = cache.namesOfScript(2, &size);
+  quiz_assert(cachedNames != nullptr && size == sizeof(names) && memcmp(cachedNames, names, size) == 0);
+
+  // The bytecode of an entry is kept until its names are stored again
+  cache.storeBytecode(2, otherBytecode, sizeof(otherBytecode));
+  cachedBytecode = cache.bytecodeOfScript(2, &size);
+  quiz_assert(size == sizeof(bytecode) && memcmp(cachedBytecode, bytecode, size) == 0);
+  cache.storeNames(2, names, sizeof(names));
+  quiz_assert(cache.bytecodeOfScript(2, &size) == nullptr);
+  cache.storeBytecode(2, otherBytecode, sizeof(otherBytecode));
+  cachedBytecode = cache.bytecodeOfScript(2, &size);
+  quiz_assert(cachedBytecode != nullptr && size == sizeof(otherBytecode) && memcmp(cachedBytecode, otherBytecode, size) == 0);
+
+  // Bytecode is kept for scripts whose names do not fit
+  cache.storeNames(3, nullptr, 0);
+  quiz_assert(cache.namesOfScript(3, &size) == nullptr);
+  cache.storeBytecode(3, bytecode, sizeof(bytecode));
+  cachedBytecode = cache.bytecodeOfScript(3, &size);
+  quiz_assert(cachedBytecode != nullptr && size == sizeof(bytecode) && memcmp(cachedBytecode, bytecode, size) == 0);
+}
+
+class CountingScriptStore : public ScriptStore {
+public:
+  CountingScriptStore() : m_numberOfCompilations(0) {}
+  int numberOfCompilations() const { return m_numberOfCompilations; }
+  void willCompileScript(const char * name, mp_parse_node_t root) override {
+    m_numberOfCompilations++;
+    ScriptStore::willCompileScript(name, root);
+  }
+private:
+  int m_numberOfCompilations;
+};
+
+class PrintingExecutionEnvironment : public MicroPython::ExecutionEnvironment {
+public:
+  PrintingExecutionEnvironment() : m_text(), m_length(0) {}
+  const char * text() const { return m_text; }
+  void printText(const char * text, size_t length) override {
+    assert(m_length + length < sizeof(m_text));
+    memcpy(m_text + m_length, text, length);
+    m_length += length;
+  }
+private:
+  char m_text[64];
+  size_t m_length;
+};
+
+QUIZ_CASE(code_script_cache_import) {
+  static char pythonHeap[16384];
+  static ScriptCache cache;
+  CountingScriptStore scriptStore;
+  scriptStore.setCache(&cache);
+  const char script[] = "\x01" "def successor(n):\n  return n+1\n";
+  quiz_assert(Ion::Storage::sharedStorage()->createRecordWithFullName("cached.py", script, sizeof(script)) == Ion::Storage::Record::ErrorStatus::None);
+
+  // The script is only compiled the first time it is imported
+  for (int i = 0; i < 2; i++) {
+    MicroPython::init(pythonHeap, pythonHeap + sizeof(pythonHeap));
+    MicroPython::registerScriptProvider(&scriptStore);
+    PrintingExecutionEnvironment environment;
+    environment.runCode("from cached import *");
+    environment.runCode("print(successor(1))");
+    quiz_assert(strcmp(environment.text(), "2\n") == 0);
+    quiz_assert(scriptStore.numberOfCompilations() == 1);
+    MicroPython::deinit();
+  }
+
+  // An edited script is compiled again
+  const char editedScript[] = "\x01" "def successor(n):\n  return n+2\n";
+  quiz_assert(scriptStore.scriptNamed("cached.py").setValue({.buffer = editedScript, .size = sizeof(editedScript)}) == Ion::Storage::Record::ErrorStatus::None);
+  MicroPython::init(pythonHeap, pythonHeap + sizeof(pythonHeap));
+  PrintingExecutionEnvironment environment;
+  environment.runCode("from cached import *");
+  environment.runCode("print(successor(1))");
+  quiz_assert(strcmp(environment.text(), "3\n") == 0);
+  quiz_assert(scriptStore.numberOfCompilations() == 2);
+  MicroPython::deinit();
+
+  MicroPython::registerScriptProvider(nullptr);
+  scriptStore.deleteAllScripts();
+}
+
+}
@@ -0,0 +1,94 @@
+#include "curve_samples_cache.h"
+#include <assert.h>
+
+namespace Graph {
+
+void CurveSamplesCache::setCurve(Ion::Storage::Record record, uint32_t checksum, float step) {
+  if (record == m_record && checksum == m_checksum && step == m_step) {
+    return;
+  }
+  m_record = record;
+  m_checksum = checksum;
+  m_step = step;
+  clear();
+}
+
+void CurveSamplesCache::clear() {
+  m_firstIndex = 0;
+  for (uint32_t & word : m_sampled) {
+    word = 0;
+  }
+}
+
+bool CurveSamplesCache::sampleAtAbscissa(float t, float * y) const {
+  int k;
+  if (!indexOfAbscissa(t, &k) || k < m_firstIndex || k >= m_firstIndex + k_numberOfSamples) {
+    return false;
+  }
+  int position = positionOfIndex(k);
+  if (!isSampled(position)) {
+    return false;
+  }
+  *y = m_samples[position];
+  return true;
+}
+
+void CurveSamplesCache::setSampleAtAbscissa(float t, float y) {
+  int k;
+  if (!indexOfAbscissa(t, &k)) {
+    return;
+  }
+  // Slide the window onto k, dropping the samples it leaves
+  int newFirstIndex = m_firstIndex;
+  if (k < m_firstIndex) {
+    newFirstIndex = k;
+  } else if (k >= m_firstIndex + k_numberOfSamples) {
+    newFirstIndex = k - k_numberOfSamples + 1;
+  }
+  int shift = newFirstIndex - m_firstIndex;
+  if (shift >= k_numberOfSamples || shift <= -k_numberOfSamples) {
+    clear();
+  } else if (shift > 0) {
+    for (int i = m_firstIndex; i < newFirstIndex; i++) {
+      setSampled(positionOfIndex(i), false);
+    }
+  } else {
+    for (int i = newFirstIndex + k_numberOfSamples; i < m_firstIndex + k_numberOfSamples; i++) {
+      setSampled(positionOfIndex(i), false);
+    }
+  }
+  m_firstIndex = newFirstIndex;
+  int position = positionOfIndex(k);
+  m_samples[position] = y;
+  setSampled(position, true);
+}
+
+bool CurveSamplesCache::indexOfAbscissa(float t, int * k) const {
+  if (m_record.isNull() || !(m_step > 0.0f)) {
+    return false;
+  }
+  constexpr float k_maxIndex = 1 << 24;
+  float index = std::round(t / m_step);
+  if (!(std::fabs(index) <= k_maxIndex) || std::fabs(t - index * m_step) > m_step / 1000.0f) {
+    return false;
+  }
+  *k = index;
+  return true;
+}
+
+int CurveSamplesCache::positionOfIndex(int k) const {
+  int position = k % k_numberOfSamples;
+  return position < 0 ? position + k_numberOfSamples : position;
+}
+
+void CurveSamplesCache::setSampled(int position, bool sampled) {
+  assert(position >= 0 && position < k_numberOfSamples);
+  uint32_t mask = 1u << (position % k_numberOfBitsPerWord);
+  if (sampled) {
+    m_sampled[position / k_numberOfBitsPerWord] |= mask;
+  } else {
+    m_sampled[position / k_numberOfBitsPerWord] &= ~mask;
+  }
+}
+
+}
@@ -0,0 +1,47 @@
+#ifndef GRAPH_CURVE_SAMPLES_CACHE_H
+#define GRAPH_CURVE_SAMPLES_CACHE_H
+
+#include <ion/display.h>
+#include <ion/storage.h>
+#include <stdint.h>
+#include <cmath>
+
+namespace Graph {
+
+/* CurveSamplesCache memoizes the ordinates of a cartesian function at the
+ * abscissas k*step, for a window of consecutive integers k spanning the
+ * screen width, step being the width of a pixel. These are the abscissas the
+ * curve view samples whatever the horizontal position of the range, so the
+ * samples remain valid when the range is panned and are only dropped when
+ * the step, or the checksum of the function record, changes. */
+
+class CurveSamplesCache {
+public:
+  CurveSamplesCache() { setCurve(Ion::Storage::Record(), 0, NAN); }
+  Ion::Storage::Record record() const { return m_record; }
+  // Drop the samples unless they were taken on the same curve with the same step
+  void setCurve(Ion::Storage::Record record, uint32_t checksum, float step);
+  void clear();
+  bool sampleAtAbscissa(float t, float * y) const;
+  void setSampleAtAbscissa(float t, float y);
+private:
+  constexpr static int k_numberOfSamples = Ion::Display::Width + 1;
+  constexpr static int k_numberOfBitsPerWord = 8 * sizeof(uint32_t);
+  /* Returns false if t is not k*m_step. The index is bounded so that the
+   * window does not overflow. */
+  bool indexOfAbscissa(float t, int * k) const;
+  int positionOfIndex(int k) const;
+  bool isSampled(int position) const { return m_sampled[position / k_numberOfBitsPerWord] & (1u << (position % k_numberOfBitsPerWord)); }
+  void setSampled(int position, bool sampled);
+  Ion::Storage::Record m_record;
+  uint32_t m_checksum;
+  float m_step;
+  // The window spans the indices [m_firstIndex, m_firstIndex+k_numberOfSamples[
+  int m_firstIndex;
+  float m_samples[k_numberOfSamples];
+  uint32_t m_sampled[(k_numberOfSamples + k_numberOfBitsPerWord - 1) / k_numberOfBitsPerWord];
+};
+
+}
+
+#endif
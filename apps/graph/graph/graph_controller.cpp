@@ -31,6 +31,7 @@ I18n::Message GraphController::emptyMessage() {
 
 void GraphController::viewWillAppear() {
   m_view.drawTangent(false);
+  m_view.clearCurvesSamples();
 #ifdef GRAPH_CURSOR_SPEEDUP
   m_cursorView.resetMemoization();
 #endif
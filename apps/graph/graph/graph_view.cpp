@@ -9,6 +9,7 @@ namespace Graph {
 GraphView::GraphView(InteractiveCurveViewRange * graphRange,
   CurveViewCursor * cursor, Shared::BannerView * bannerView, CursorView * cursorView) :
   FunctionGraphView(graphRange, cursor, bannerView, cursorView),
+  m_oldestCurveSamplesCacheIndex(0),
   m_tangent(false)
 {
 }
@@ -21,6 +22,33 @@ void GraphView::reload() {
   return FunctionGraphView::reload();
 }
 
+void GraphView::clearCurvesSamples() {
+  for (CurveSamplesCache & cache : m_curvesSamplesCaches) {
+    cache.clear();
+  }
+}
+
+CurveSamplesCache * GraphView::curveSamplesCache(Ion::Storage::Record record) const {
+  CurveSamplesCache * cache = nullptr;
+  for (int i = 0; i < k_numberOfCurvesSamplesCaches; i++) {
+    if (m_curvesSamplesCaches[i].record() == record) {
+      cache = m_curvesSamplesCaches + i;
+      break;
+    }
+  }
+  if (cache == nullptr) {
+    cache = m_curvesSamplesCaches + m_oldestCurveSamplesCacheIndex;
+    m_oldestCurveSamplesCacheIndex = (m_oldestCurveSamplesCacheIndex + 1) % k_numberOfCurvesSamplesCaches;
+  }
+  cache->setCurve(record, record.checksum(), pixelWidth());
+  return cache;
+}
+
+struct CachedCurve {
+  ContinuousFunction * function;
+  CurveSamplesCache * samples;
+};
+
 void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
   FunctionGraphView::drawRect(ctx, rect);
   ContinuousFunctionStore * functionStore = App::app()->functionStore();
@@ -46,11 +74,53 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
 
     // Cartesian
     if (type == Shared::ContinuousFunction::PlotType::Cartesian) {
+      CachedCurve curve = {f.operator->(), curveSamplesCache(record)};
       drawCartesianCurve(ctx, rect, tmin, tmax, [](float t, void * model, void * context) {
-            ContinuousFunction * f = (ContinuousFunction *)model;
+            CachedCurve * curve = (CachedCurve *)model;
+            Poincare::Context * c = (Poincare::Context *)context;
+            float y;
+            if (!curve->samples->sampleAtAbscissa(t, &y)) {
+              y = curve->function->evaluateXYAtParameter(t, c).x2();
+              curve->samples->setSampleAtAbscissa(t, y);
+            }
+            return Poincare::Coordinate2D<float>(t, y);
+          }, &curve, context(), f->color(), record == m_selectedRecord, m_highlightedStart, m_highlightedEnd,
+          [](const float * t, Poincare::Coordinate2D<float> * xy, int numberOfParameters, void * model, void * context) {
+            CachedCurve * curve = (CachedCurve *)model;
             Poincare::Context * c = (Poincare::Context *)context;
-            return f->evaluateXYAtParameter(t, c);
-          }, f.operator->(), context(), f->color(), record == m_selectedRecord, m_highlightedStart, m_highlightedEnd);
+            /* Abscissas missing from the samples cache are gathered to be
+             * evaluated at once. */
+            constexpr int k_maxNumberOfMisses = 16;
+            float misses[k_maxNumberOfMisses];
+            int missIndexes[k_maxNumberOfMisses];
+            Poincare::Coordinate2D<float> missesXY[k_maxNumberOfMisses];
+            int i = 0;
+            while (i < numberOfParameters) {
+              int numberOfMisses = 0;
+              for (; i < numberOfParameters && numberOfMisses < k_maxNumberOfMisses; i++) {
+                float y;
+                if (curve->samples->sampleAtAbscissa(t[i], &y)) {
+                  xy[i] = Poincare::Coordinate2D<float>(t[i], y);
+                } else {
+                  misses[numberOfMisses] = t[i];
+                  missIndexes[numberOfMisses++] = i;
+                }
+              }
+              if (numberOfMisses > 0) {
+                curve->function->evaluateXYAtParameters(misses, missesXY, numberOfMisses, c);
+              }
+              for (int j = 0; j < numberOfMisses; j++) {
+                float y = missesXY[j].x2();
+                curve->samples->setSampleAtAbscissa(misses[j], y);
+                xy[missIndexes[j]] = Poincare::Coordinate2D<float>(misses[j], y);
+              }
+            }
+          },
+          [](Poincare::Interval<float> x, Poincare::Interval<float> * y, void * model, void * context) {
+            CachedCurve * curve = (CachedCurve *)model;
+            Poincare::Context * c = (Poincare::Context *)context;
+            return curve->function->evaluateYOnXInterval(x, y, c);
+          });
       /* Draw tangent */
       if (m_tangent && record == m_selectedRecord) {
         float tangentParameter[2];
@@ -72,7 +142,12 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
         ContinuousFunction * f = (ContinuousFunction *)model;
         Poincare::Context * c = (Poincare::Context *)context;
         return f->evaluateXYAtParameter(t, c);
-      }, f.operator->(), context(), false, f->color());
+      }, f.operator->(), context(), false, f->color(), false, 0.0f, 0.0f,
+      [](const float * t, Poincare::Coordinate2D<float> * xy, int numberOfParameters, void * model, void * context) {
+        ContinuousFunction * f = (ContinuousFunction *)model;
+        Poincare::Context * c = (Poincare::Context *)context;
+        f->evaluateXYAtParameters(t, xy, numberOfParameters, c);
+      });
   }
 }
 
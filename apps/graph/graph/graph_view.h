@@ -1,6 +1,7 @@
 #ifndef GRAPH_GRAPH_VIEW_H
 #define GRAPH_GRAPH_VIEW_H
 
+#include "curve_samples_cache.h"
 #include "../../shared/function_graph_view.h"
 
 namespace Graph {
@@ -17,7 +18,15 @@ public:
    * of the application graph. We thereby avoid to uselessly reload some part
    * of the graph where the area under the curve is colored. */
   void setAreaHighlightColor(bool highlightColor) override {};
+  /* The samples of the cartesian curves are memoized across redraws. They
+   * have to be cleared when functions may have changed without their record
+   * changing, as when a variable they depend on is modified. */
+  void clearCurvesSamples();
 private:
+  constexpr static int k_numberOfCurvesSamplesCaches = 4;
+  CurveSamplesCache * curveSamplesCache(Ion::Storage::Record record) const;
+  mutable CurveSamplesCache m_curvesSamplesCaches[k_numberOfCurvesSamplesCaches];
+  mutable int m_oldestCurveSamplesCacheIndex;
   bool m_tangent;
 };
 
@@ -0,0 +1,49 @@
+#include <quiz.h>
+#include <ion/storage.h>
+#include <assert.h>
+#include "../graph/curve_samples_cache.h"
+
+namespace Graph {
+
+QUIZ_CASE(graph_curve_samples_cache) {
+  static CurveSamplesCache cache;
+  const char data[] = "f";
+  quiz_assert(Ion::Storage::sharedStorage()->createRecordWithFullName("f.func", data, sizeof(data)) == Ion::Storage::Record::ErrorStatus::None);
+  Ion::Storage::Record record = Ion::Storage::sharedStorage()->recordNamed("f.func");
+  float y;
+
+  // Samples are only kept at multiples of the step
+  cache.setCurve(record, 1, 0.5f);
+  quiz_assert(!cache.sampleAtAbscissa(1.5f, &y));
+  cache.setSampleAtAbscissa(1.5f, 2.25f);
+  cache.setSampleAtAbscissa(1.7f, 2.89f);
+  quiz_assert(cache.sampleAtAbscissa(1.5f, &y) && y == 2.25f);
+  quiz_assert(!cache.sampleAtAbscissa(1.7f, &y));
+  quiz_assert(!cache.sampleAtAbscissa(2.0f, &y));
+
+  // Setting the same curve keeps the samples
+  cache.setCurve(record, 1, 0.5f);
+  quiz_assert(cache.sampleAtAbscissa(1.5f, &y) && y == 2.25f);
+
+  // Panning the range keeps the samples within a screen width
+  cache.setSampleAtAbscissa(0.5f * Ion::Display::Width, 1.0f);
+  quiz_assert(cache.sampleAtAbscissa(1.5f, &y) && y == 2.25f);
+  cache.setSampleAtAbscissa(0.5f * (Ion::Display::Width + 4), 1.0f);
+  quiz_assert(!cache.sampleAtAbscissa(1.5f, &y));
+  quiz_assert(cache.sampleAtAbscissa(0.5f * Ion::Display::Width, &y) && y == 1.0f);
+
+  // A modified function drops the samples
+  cache.setSampleAtAbscissa(200.0f, 3.0f);
+  cache.setCurve(record, 2, 0.5f);
+  quiz_assert(!cache.sampleAtAbscissa(200.0f, &y));
+
+  // Zooming, which changes the step, drops the samples
+  cache.setSampleAtAbscissa(200.0f, 3.0f);
+  quiz_assert(cache.sampleAtAbscissa(200.0f, &y) && y == 3.0f);
+  cache.setCurve(record, 2, 0.25f);
+  quiz_assert(!cache.sampleAtAbscissa(200.0f, &y));
+
+  record.destroy();
+}
+
+}
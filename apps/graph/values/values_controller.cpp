@@ -281,6 +281,34 @@ void ValuesController::fillMemoizedBuffer(int column, int row, int index) {
       evaluationX = eval.x1();
     }
   }
+  fillMemoizedBufferWithEvaluation(index, evaluationX, evaluationY, isParametric);
+}
+
+void ValuesController::fillMemoizedBuffersOfColumn(int column, const int * rows, const int * indexes, int numberOfCells) {
+  bool isDerivative = false;
+  Ion::Storage::Record record = recordAtColumn(column, &isDerivative);
+  if (isDerivative) {
+    for (int k = 0; k < numberOfCells; k++) {
+      fillMemoizedBuffer(column, rows[k], indexes[k]);
+    }
+    return;
+  }
+  assert(numberOfCells <= k_maxNumberOfDisplayableRows);
+  double abscissas[k_maxNumberOfDisplayableRows];
+  Poincare::Coordinate2D<double> evaluations[k_maxNumberOfDisplayableRows];
+  Shared::Interval * interval = intervalAtColumn(column);
+  for (int k = 0; k < numberOfCells; k++) {
+    abscissas[k] = interval->element(rows[k]-1); // Subtract the title row from row to get the element index
+  }
+  Shared::ExpiringPointer<ContinuousFunction> function = functionStore()->modelForRecord(record);
+  function->evaluate2DAtParameters(abscissas, evaluations, numberOfCells, textFieldDelegateApp()->localContext());
+  bool isParametric = function->plotType() == ContinuousFunction::PlotType::Parametric;
+  for (int k = 0; k < numberOfCells; k++) {
+    fillMemoizedBufferWithEvaluation(indexes[k], isParametric ? evaluations[k].x1() : NAN, evaluations[k].x2(), isParametric);
+  }
+}
+
+void ValuesController::fillMemoizedBufferWithEvaluation(int index, double evaluationX, double evaluationY, bool isParametric) {
   char * buffer = memoizedBufferAtIndex(index);
   int numberOfChar = 0;
   if (isParametric) {
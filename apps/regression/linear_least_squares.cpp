@@ -0,0 +1,66 @@
+#include "linear_least_squares.h"
+#include <assert.h>
+#include <cmath>
+
+namespace Regression {
+
+LinearLeastSquares::LinearLeastSquares(int numberOfUnknowns) :
+  m_numberOfUnknowns(numberOfUnknowns),
+  m_r{},
+  m_qtb{},
+  m_squaredColumnNorms{}
+{
+  assert(numberOfUnknowns > 0 && numberOfUnknowns <= k_maxNumberOfUnknowns);
+}
+
+void LinearLeastSquares::addEquation(const double * coefficients, double constant) {
+  int n = m_numberOfUnknowns;
+  double row[k_maxNumberOfUnknowns];
+  for (int j = 0; j < n; j++) {
+    row[j] = coefficients[j];
+    m_squaredColumnNorms[j] += row[j]*row[j];
+  }
+  /* Each rotation combines the new row with a row of R to cancel the next
+   * coefficient of the new row. What remains of the constant is a part of the
+   * residual. */
+  for (int i = 0; i < n; i++) {
+    if (row[i] == 0.0) {
+      continue;
+    }
+    double norm = std::hypot(m_r[i][i], row[i]);
+    double c = m_r[i][i]/norm;
+    double s = row[i]/norm;
+    m_r[i][i] = norm;
+    for (int j = i + 1; j < n; j++) {
+      double rij = m_r[i][j];
+      m_r[i][j] = c*rij + s*row[j];
+      row[j] = c*row[j] - s*rij;
+    }
+    double qtbi = m_qtb[i];
+    m_qtb[i] = c*qtbi + s*constant;
+    constant = c*constant - s*qtbi;
+  }
+}
+
+bool LinearLeastSquares::solve(double * unknowns) const {
+  int n = m_numberOfUnknowns;
+  // Solve R*c = Qt*b by back substitution
+  for (int i = n - 1; i >= 0; i--) {
+    if (!(std::fabs(m_r[i][i]) > k_rankTolerance * std::sqrt(m_squaredColumnNorms[i]))) {
+      return false;
+    }
+    double sum = m_qtb[i];
+    for (int j = i + 1; j < n; j++) {
+      sum -= m_r[i][j]*unknowns[j];
+    }
+    unknowns[i] = sum/m_r[i][i];
+  }
+  for (int i = 0; i < n; i++) {
+    if (!std::isfinite(unknowns[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}
@@ -0,0 +1,37 @@
+#ifndef REGRESSION_LINEAR_LEAST_SQUARES_H
+#define REGRESSION_LINEAR_LEAST_SQUARES_H
+
+#include "model/model.h"
+
+namespace Regression {
+
+/* LinearLeastSquares finds the unknowns c minimizing |A*c-b|, the equations
+ * being the rows of A and b. It maintains the QR decomposition of A, each
+ * added equation being rotated into the triangular factor R by Givens
+ * rotations. This is as stable as factorizing A, but neither A nor Q are
+ * stored, so the memory used does not depend on the number of equations. */
+
+class LinearLeastSquares {
+public:
+  LinearLeastSquares(int numberOfUnknowns);
+  // Add the equation coefficients[0]*c[0]+...+coefficients[n-1]*c[n-1] = constant
+  void addEquation(const double * coefficients, double constant);
+  // Return false if the unknowns are not determined by the equations
+  bool solve(double * unknowns) const;
+private:
+  constexpr static int k_maxNumberOfUnknowns = Model::k_maxNumberOfCoefficients;
+  /* An unknown is considered undetermined if its column of A is this close to
+   * the span of the previous columns, relatively to its norm. */
+  constexpr static double k_rankTolerance = 1e-12;
+  int m_numberOfUnknowns;
+  // R is upper triangular, only the coefficients above the diagonal are used
+  double m_r[k_maxNumberOfUnknowns][k_maxNumberOfUnknowns];
+  // The first rows of the transposed Q times b
+  double m_qtb[k_maxNumberOfUnknowns];
+  // The squared norms of the columns of A
+  double m_squaredColumnNorms[k_maxNumberOfUnknowns];
+};
+
+}
+
+#endif
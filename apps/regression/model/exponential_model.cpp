@@ -1,6 +1,6 @@
 #include "exponential_model.h"
 #include "../store.h"
-#include "../linear_model_helper.h"
+#include "../linear_least_squares.h"
 #include <math.h>
 #include <assert.h>
 #include <poincare/code_point_layout.h>
@@ -48,7 +48,7 @@ double ExponentialModel::levelSet(double * modelCoefficients, double xMin, doubl
   return log(y/a)/b;
 }
 
-void ExponentialModel::fit(Store * store, int series, double * modelCoefficients, Poincare::Context * context) {
+Model::FitReport ExponentialModel::fit(Store * store, int series, double * modelCoefficients, Poincare::Context * context) {
   /* By the change of variable z=ln(y), the equation y=a*exp(b*x) becomes
    * z=c*x+d with c=b and d=ln(a). Although that change of variable does not
    * preserve the regression error function, it turns an exponential regression
@@ -58,10 +58,7 @@ void ExponentialModel::fit(Store * store, int series, double * modelCoefficients
    * the y values are all negative, one may replace each of them by its
    * opposite. In the case where y values happen to be zero or of opposite
    * sign, we call the base class method as a fallback. */
-  double sumOfX = 0;
-  double sumOfY = 0;
-  double sumOfXX = 0;
-  double sumOfXY = 0;
+  LinearLeastSquares leastSquares(numberOfCoefficients());
   const int numberOfPoints = store->numberOfPairsOfSeries(series);
   const int sign = store->get(series, 1, 0) > 0 ? 1 : -1;
   for (int p = 0; p < numberOfPoints; p++) {
@@ -70,21 +67,16 @@ void ExponentialModel::fit(Store * store, int series, double * modelCoefficients
     if (z <= 0) {
       return Model::fit(store, series, modelCoefficients, context);
     }
-    const double y = log(z);
-    sumOfX += x;
-    sumOfY += y;
-    sumOfXX += x*x;
-    sumOfXY += x*y;
+    const double equation[2] = {1.0, x};
+    leastSquares.addEquation(equation, log(z));
   }
-  const double meanOfX = sumOfX / numberOfPoints;
-  const double meanOfY = sumOfY / numberOfPoints;
-  const double meanOfXX = sumOfXX / numberOfPoints;
-  const double meanOfXY = sumOfXY / numberOfPoints;
-  const double variance = meanOfXX - meanOfX * meanOfX;
-  const double covariance = meanOfXY - meanOfX * meanOfY;
-  modelCoefficients[1] = LinearModelHelper::Slope(covariance, variance);
-  modelCoefficients[0] =
-    sign * exp(LinearModelHelper::YIntercept(meanOfY, meanOfX, modelCoefficients[1]));
+  double unknowns[2];
+  if (!leastSquares.solve(unknowns)) {
+    return Model::fit(store, series, modelCoefficients, context);
+  }
+  modelCoefficients[0] = sign * exp(unknowns[0]);
+  modelCoefficients[1] = unknowns[1];
+  return FitReport({0, true});
 }
 
 double ExponentialModel::partialDerivate(double * modelCoefficients, int derivateCoefficientIndex, double x) const {
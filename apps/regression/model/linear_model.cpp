@@ -31,9 +31,10 @@ double LinearModel::levelSet(double * modelCoefficients, double xMin, double ste
   return (y-b)/a;
 }
 
-void LinearModel::fit(Store * store, int series, double * modelCoefficients, Poincare::Context * context) {
+Model::FitReport LinearModel::fit(Store * store, int series, double * modelCoefficients, Poincare::Context * context) {
   modelCoefficients[0] = store->slope(series);
   modelCoefficients[1] = store->yIntercept(series);
+  return FitReport({0, true});
 }
 
 double LinearModel::partialDerivate(double * modelCoefficients, int derivateCoefficientIndex, double x) const {
@@ -1,4 +1,5 @@
 #include "logarithmic_model.h"
+#include "../linear_least_squares.h"
 #include "../store.h"
 #include <poincare/layout_helper.h>
 #include <math.h>
@@ -45,6 +46,23 @@ double LogarithmicModel::partialDerivate(double * modelCoefficients, int derivat
   return 0.0;
 }
 
+Model::FitReport LogarithmicModel::fit(Store * store, int series, double * modelCoefficients, Poincare::Context * context) {
+  // y=a*ln(x)+b is linear in a and b
+  if (!dataSuitableForFit(store, series)) {
+    return Model::fit(store, series, modelCoefficients, context);
+  }
+  LinearLeastSquares leastSquares(numberOfCoefficients());
+  const int numberOfPoints = store->numberOfPairsOfSeries(series);
+  for (int p = 0; p < numberOfPoints; p++) {
+    const double equation[2] = {log(store->get(series, 0, p)), 1.0};
+    leastSquares.addEquation(equation, store->get(series, 1, p));
+  }
+  if (!leastSquares.solve(modelCoefficients)) {
+    return Model::fit(store, series, modelCoefficients, context);
+  }
+  return FitReport({0, true});
+}
+
 bool LogarithmicModel::dataSuitableForFit(Store * store, int series) const {
   if (!Model::dataSuitableForFit(store, series)) {
     return false;
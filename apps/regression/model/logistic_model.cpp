@@ -81,4 +81,16 @@ double LogisticModel::partialDerivate(double * modelCoefficients, int derivateCo
   return 0.0;
 }
 
+void LogisticModel::evaluateWithPartialDerivatives(double * modelCoefficients, double x, double * value, double * partialDerivatives) const {
+  double a = modelCoefficients[0];
+  double b = modelCoefficients[1];
+  double c = modelCoefficients[2];
+  double exponential = exp(-b*x);
+  double inverseDenominator = 1.0/(1.0+a*exponential);
+  *value = c*inverseDenominator;
+  partialDerivatives[0] = -exponential*c*inverseDenominator*inverseDenominator;
+  partialDerivatives[1] = x*a*exponential*c*inverseDenominator*inverseDenominator;
+  partialDerivatives[2] = inverseDenominator;
+}
+
 }
@@ -1,4 +1,5 @@
 #include "model.h"
+#include "../linear_least_squares.h"
 #include "../store.h"
 #include "../../shared/poincare_helpers.h"
 #include <poincare/decimal.h>
@@ -31,17 +32,41 @@ double Model::levelSet(double * modelCoefficients, double xMin, double step, dou
   return result;
 }
 
-void Model::fit(Store * store, int series, double * modelCoefficients, Poincare::Context * context) {
+Model::FitReport Model::fit(Store * store, int series, double * modelCoefficients, Poincare::Context * context) {
   if (dataSuitableForFit(store, series)) {
     for (int i = 0; i < numberOfCoefficients(); i++) {
       modelCoefficients[i] = k_initialCoefficientValue;
     }
-    fitLevenbergMarquardt(store, series, modelCoefficients, context);
-  } else {
-    for (int i = 0; i < numberOfCoefficients(); i++) {
-      modelCoefficients[i] = NAN;
+    return fitLevenbergMarquardt(store, series, modelCoefficients, context);
+  }
+  for (int i = 0; i < numberOfCoefficients(); i++) {
+    modelCoefficients[i] = NAN;
+  }
+  return FitReport({0, false});
+}
+
+Model::FitReport Model::fitPolynomial(Store * store, int series, double * modelCoefficients, Poincare::Context * context) {
+  if (!dataSuitableForFit(store, series)) {
+    return Model::fit(store, series, modelCoefficients, context);
+  }
+  int n = numberOfCoefficients();
+  LinearLeastSquares leastSquares(n);
+  int numberOfPairs = store->numberOfPairsOfSeries(series);
+  for (int i = 0; i < numberOfPairs; i++) {
+    double x = store->get(series, 0, i);
+    // Powers of x by decreasing degree
+    double powers[k_maxNumberOfCoefficients];
+    double power = 1.0;
+    for (int k = n - 1; k >= 0; k--) {
+      powers[k] = power;
+      power *= x;
     }
+    leastSquares.addEquation(powers, store->get(series, 1, i));
+  }
+  if (!leastSquares.solve(modelCoefficients)) {
+    return Model::fit(store, series, modelCoefficients, context);
   }
+  return FitReport({0, true});
 }
 
 bool Model::dataSuitableForFit(Store * store, int series) const {
@@ -51,7 +76,14 @@ bool Model::dataSuitableForFit(Store * store, int series) const {
   return !store->seriesIsEmpty(series);
 }
 
-void Model::fitLevenbergMarquardt(Store * store, int series, double * modelCoefficients, Context * context) {
+void Model::evaluateWithPartialDerivatives(double * modelCoefficients, double x, double * value, double * partialDerivatives) const {
+  *value = evaluate(modelCoefficients, x);
+  for (int k = 0; k < numberOfCoefficients(); k++) {
+    partialDerivatives[k] = partialDerivate(modelCoefficients, k, x);
+  }
+}
+
+Model::FitReport Model::fitLevenbergMarquardt(Store * store, int series, double * modelCoefficients, Context * context) {
   /* We want to find the best coefficients of the regression to minimize the sum
    * of the squares of the difference between a data point and the corresponding
    * point of the fitting regression (chi2 function).
@@ -59,10 +91,15 @@ void Model::fitLevenbergMarquardt(Store * store, int series, double * modelCoeff
    * function.
    * The equation to solve is A'*da = B, with A' a damped version of the chi2
    * Hessian matrix, da the coefficients increments and B colinear to the
-   * gradient of chi2.*/
-  double currentChi2 = chi2(store, series, modelCoefficients);
-  double lambda = k_initialLambda;
+   * gradient of chi2.
+   * A and B only depend on the coefficients, so they are computed along with
+   * chi2 when trying new coefficients, and kept while only the damping
+   * changes. */
   int n = numberOfCoefficients(); // n unknown coefficients
+  double alpha[Model::k_maxNumberOfCoefficients * Model::k_maxNumberOfCoefficients];
+  double beta[Model::k_maxNumberOfCoefficients];
+  double currentChi2 = chi2WithNormalEquations(store, series, modelCoefficients, alpha, beta);
+  double lambda = k_initialLambda;
   int smallChi2ChangeCounts = 0;
   int iterationCount = 0;
   while (smallChi2ChangeCounts < k_consecutiveSmallChi2ChangesLimit && iterationCount < k_maxIterations) {
@@ -70,22 +107,16 @@ void Model::fitLevenbergMarquardt(Store * store, int series, double * modelCoeff
     double coefficientsAPrime[Model::k_maxNumberOfCoefficients * Model::k_maxNumberOfCoefficients];
     for (int i = 0; i < n; i++) {
       for (int j = i; j < n; j++) {
-        double alphaPrime = alphaPrimeCoefficient(store, series, modelCoefficients, i, j, lambda);
+        double alphaPrime = alphaPrimeCoefficient(alpha, i, j, lambda);
         coefficientsAPrime[i*n+j] = alphaPrime;
         if (i != j) {
           coefficientsAPrime[j*n+i] = alphaPrime;
         }
       }
     }
-    // Create the beta matrix
-    double operandsB[Model::k_maxNumberOfCoefficients];
-    for (int j = 0; j < n; j++) {
-      operandsB[j] = betaCoefficient(store, series, modelCoefficients, j);
-    }
-
     // Compute the equation solution (= vector of coefficients increments)
     double modelCoefficientSteps[Model::k_maxNumberOfCoefficients];
-    if (solveLinearSystem(modelCoefficientSteps, coefficientsAPrime, operandsB, n, context) < 0) {
+    if (solveLinearSystem(modelCoefficientSteps, coefficientsAPrime, beta, n, context) < 0) {
       break;
     }
 
@@ -96,7 +127,9 @@ void Model::fitLevenbergMarquardt(Store * store, int series, double * modelCoeff
     }
 
     // Compare new chi2 with the previous value
-    double newChi2 = chi2(store, series, newModelCoefficients);
+    double newAlpha[Model::k_maxNumberOfCoefficients * Model::k_maxNumberOfCoefficients];
+    double newBeta[Model::k_maxNumberOfCoefficients];
+    double newChi2 = chi2WithNormalEquations(store, series, newModelCoefficients, newAlpha, newBeta);
     smallChi2ChangeCounts = (fabs(currentChi2 - newChi2) > k_chi2ChangeCondition) ? 0 : smallChi2ChangeCounts + 1;
     if (newChi2 >= currentChi2) {
       lambda*= k_lambdaFactor;
@@ -104,29 +137,61 @@ void Model::fitLevenbergMarquardt(Store * store, int series, double * modelCoeff
       lambda/= k_lambdaFactor;
       for (int i = 0; i < n; i++) {
         modelCoefficients[i] = newModelCoefficients[i];
+        beta[i] = newBeta[i];
+      }
+      for (int i = 0; i < n*n; i++) {
+        alpha[i] = newAlpha[i];
       }
       currentChi2 = newChi2;
     }
     iterationCount++;
   }
+  return FitReport({iterationCount, smallChi2ChangeCounts >= k_consecutiveSmallChi2ChangesLimit});
 }
 
-double Model::chi2(Store * store, int series, double * modelCoefficients) const {
+// chi2 = sum(0, N-1, (yi - y(xi|a))^2)
+// a(k,l) = sum(0, N-1, derivate(y(xi|a), ak) * derivate(y(xi|a), al))
+// b(k) = sum(0, N-1, (yi - y(xi|a)) * derivate(y(xi|a), ak))
+double Model::chi2WithNormalEquations(Store * store, int series, double * modelCoefficients, double * alpha, double * beta) const {
+  int n = numberOfCoefficients();
+  for (int k = 0; k < n; k++) {
+    beta[k] = 0.0;
+    for (int l = k; l < n; l++) {
+      alpha[k*n+l] = 0.0;
+    }
+  }
   double result = 0.0;
-  for (int i = 0; i < store->numberOfPairsOfSeries(series); i++) {
+  int m = store->numberOfPairsOfSeries(series); // m equations
+  for (int i = 0; i < m; i++) {
     double xi = store->get(series, 0, i);
     double yi = store->get(series, 1, i);
-    double difference = yi - evaluate(modelCoefficients, xi);
+    double value;
+    double partialDerivatives[Model::k_maxNumberOfCoefficients];
+    evaluateWithPartialDerivatives(modelCoefficients, xi, &value, partialDerivatives);
+    double difference = yi - value;
     result += difference * difference;
+    for (int k = 0; k < n; k++) {
+      beta[k] += difference * partialDerivatives[k];
+      for (int l = k; l < n; l++) {
+        alpha[k*n+l] += partialDerivatives[k] * partialDerivatives[l];
+      }
+    }
+  }
+  // Alpha is symmetric
+  for (int k = 0; k < n; k++) {
+    for (int l = 0; l < k; l++) {
+      alpha[k*n+l] = alpha[l*n+k];
+    }
   }
   return result;
 }
 
 // a'(k,k) = a(k,k) * (1 + lambda)
 // a'(k,l) = a(l,k) when (k != l)
-double Model::alphaPrimeCoefficient(Store * store, int series, double * modelCoefficients, int k, int l, double lambda) const {
-  assert(k >= 0 && k < numberOfCoefficients());
-  assert(l >= 0 && l < numberOfCoefficients());
+double Model::alphaPrimeCoefficient(const double * alpha, int k, int l, double lambda) const {
+  int n = numberOfCoefficients();
+  assert(k >= 0 && k < n);
+  assert(l >= 0 && l < n);
   double result = 0.0;
   if (k == l) {
     /* The Levengerg method uses a'(k,k) = a(k,k) + lambda.
@@ -135,38 +200,12 @@ double Model::alphaPrimeCoefficient(Store * store, int series, double * modelCoe
      * a'(k,k) = a(k,k) * (1 + lambda), but if a'(k,k) is too small,
      * a'(k,k) = 2*epsilon so that the inversion method does not detect a'(k,k)
      * as a zero. */
-    result = alphaCoefficient(store, series, modelCoefficients, k, l)*(1.0+lambda);
+    result = alpha[k*n+k]*(1.0+lambda);
     if (std::fabs(result) < Expression::Epsilon<double>()) {
       result = 2*Expression::Epsilon<double>();
     }
   } else {
-    result = alphaCoefficient(store, series, modelCoefficients, l, k);
-  }
-  return result;
-}
-
-// a(k,l) = sum(0, N-1, derivate(y(xi|a), ak) * derivate(y(xi|a), a))
-double Model::alphaCoefficient(Store * store, int series, double * modelCoefficients, int k, int l) const {
-  assert(k >= 0 && k < numberOfCoefficients());
-  assert(l >= 0 && l < numberOfCoefficients());
-  double result = 0.0;
-  int m = store->numberOfPairsOfSeries(series);
-  for (int i = 0; i < m; i++) {
-    double xi = store->get(series, 0, i);
-    result += partialDerivate(modelCoefficients, k, xi) * partialDerivate(modelCoefficients, l, xi);
-  }
-  return result;
-}
-
-// b(k) = sum(0, N-1, (yi - y(xi|a)) * derivate(y(xi|a), ak))
-double Model::betaCoefficient(Store * store, int series, double * modelCoefficients, int k) const {
-  assert(k >= 0 && k < numberOfCoefficients());
-  double result = 0.0;
-  int m = store->numberOfPairsOfSeries(series); // m equations
-  for (int i = 0; i < m; i++) {
-    double xi = store->get(series, 0, i);
-    double yi = store->get(series, 1, i);
-    result += (yi - evaluate(modelCoefficients, xi)) * partialDerivate(modelCoefficients, k, xi);
+    result = alpha[l*n+k];
   }
   return result;
 }
@@ -26,6 +26,13 @@ public:
   };
   static constexpr int k_numberOfModels = 9;
   static constexpr int k_maxNumberOfCoefficients = 5; // This has to verify: k_maxNumberOfCoefficients < Matrix::k_maxNumberOfCoefficients
+  /* A fit reports the number of Levenberg-Marquardt iterations it took, 0 for
+   * models fitted in closed form, and whether it converged, chi2 having
+   * stopped decreasing before the iterations limit. */
+  struct FitReport {
+    int numberOfIterations;
+    bool hasConverged;
+  };
   virtual ~Model() = default;
   virtual Poincare::Layout layout() = 0;
   // Reinitialize m_layout to empty the pool
@@ -34,18 +41,25 @@ public:
   virtual I18n::Message formulaMessage() const = 0;
   virtual double evaluate(double * modelCoefficients, double x) const = 0;
   virtual double levelSet(double * modelCoefficients, double xMin, double step, double xMax, double y, Poincare::Context * context);
-  virtual void fit(Store * store, int series, double * modelCoefficients, Poincare::Context * context);
+  virtual FitReport fit(Store * store, int series, double * modelCoefficients, Poincare::Context * context);
   virtual int numberOfCoefficients() const = 0;
   virtual int bannerLinesCount() const { return 2; }
 protected:
   // Fit
   virtual bool dataSuitableForFit(Store * store, int series) const;
+  /* Fit the coefficients of a polynomial, sorted by decreasing degree, by
+   * solving the linear least squares problem. */
+  FitReport fitPolynomial(Store * store, int series, double * modelCoefficients, Poincare::Context * context);
   constexpr static const KDFont * k_layoutFont = KDFont::SmallFont;
   Poincare::Layout m_layout;
 private:
   // Model attributes
   virtual Poincare::Expression expression(double * modelCoefficients) { return Poincare::Expression(); } // expression is overrided only by Models that do not override levelSet
   virtual double partialDerivate(double * modelCoefficients, int derivateCoefficientIndex, double x) const = 0;
+  /* Compute the value of the model and its partial derivatives along all its
+   * coefficients at x. Models override it to share computations between
+   * them. */
+  virtual void evaluateWithPartialDerivatives(double * modelCoefficients, double x, double * value, double * partialDerivatives) const;
 
   // Levenberg-Marquardt
   static constexpr double k_maxIterations = 300;
@@ -55,11 +69,11 @@ private:
   static constexpr double k_chi2ChangeCondition = 0.001;
   static constexpr double k_initialCoefficientValue = 1.0;
   static constexpr int k_consecutiveSmallChi2ChangesLimit = 10;
-  void fitLevenbergMarquardt(Store * store, int series, double * modelCoefficients, Poincare::Context * context);
-  double chi2(Store * store, int series, double * modelCoefficients) const;
-  double alphaPrimeCoefficient(Store * store, int series, double * modelCoefficients, int k, int l, double lambda) const;
-  double alphaCoefficient(Store * store, int series, double * modelCoefficients, int k, int l) const;
-  double betaCoefficient(Store * store, int series, double * modelCoefficients, int k) const;
+  FitReport fitLevenbergMarquardt(Store * store, int series, double * modelCoefficients, Poincare::Context * context);
+  /* Compute, in a single pass over the data, chi2 along with the alpha matrix
+   * and the beta vector at the given coefficients. */
+  double chi2WithNormalEquations(Store * store, int series, double * modelCoefficients, double * alpha, double * beta) const;
+  double alphaPrimeCoefficient(const double * alpha, int k, int l, double lambda) const;
   int solveLinearSystem(double * solutions, double * coefficients, double * constants, int solutionDimension, Poincare::Context * context);
 };
 
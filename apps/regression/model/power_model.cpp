@@ -1,4 +1,5 @@
 #include "power_model.h"
+#include "../linear_least_squares.h"
 #include "../store.h"
 #include <math.h>
 #include <assert.h>
@@ -61,6 +62,35 @@ double PowerModel::partialDerivate(double * modelCoefficients, int derivateCoeff
   return 0.0;
 }
 
+Model::FitReport PowerModel::fit(Store * store, int series, double * modelCoefficients, Poincare::Context * context) {
+  /* As for the exponential model, the change of variables X=ln(x) and
+   * z=ln(y) turns y=a*x^b into z=b*X+ln(a), which is solved as a linear least
+   * squares problem. This requires x values to be positive and y values to be
+   * of the same sign, the base class method being the fallback otherwise. */
+  if (!dataSuitableForFit(store, series)) {
+    return Model::fit(store, series, modelCoefficients, context);
+  }
+  LinearLeastSquares leastSquares(numberOfCoefficients());
+  const int numberOfPoints = store->numberOfPairsOfSeries(series);
+  const int sign = store->get(series, 1, 0) > 0 ? 1 : -1;
+  for (int p = 0; p < numberOfPoints; p++) {
+    const double x = store->get(series, 0, p);
+    const double z = store->get(series, 1, p) * sign;
+    if (x <= 0 || z <= 0) {
+      return Model::fit(store, series, modelCoefficients, context);
+    }
+    const double equation[2] = {1.0, log(x)};
+    leastSquares.addEquation(equation, log(z));
+  }
+  double unknowns[2];
+  if (!leastSquares.solve(unknowns)) {
+    return Model::fit(store, series, modelCoefficients, context);
+  }
+  modelCoefficients[0] = sign * exp(unknowns[0]);
+  modelCoefficients[1] = unknowns[1];
+  return FitReport({0, true});
+}
+
 bool PowerModel::dataSuitableForFit(Store * store, int series) const {
   if (!Model::dataSuitableForFit(store, series)) {
     return false;
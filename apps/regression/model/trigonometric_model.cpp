@@ -69,6 +69,21 @@ double TrigonometricModel::partialDerivate(double * modelCoefficients, int deriv
   return 0.0;
 }
 
+void TrigonometricModel::evaluateWithPartialDerivatives(double * modelCoefficients, double x, double * value, double * partialDerivatives) const {
+  double a = modelCoefficients[0];
+  double b = modelCoefficients[1];
+  double c = modelCoefficients[2];
+  double d = modelCoefficients[3];
+  double radianX = x * toRadians(Poincare::Preferences::sharedPreferences()->angleUnit());
+  double sine = sin(b*radianX+c);
+  double cosine = cos(b*radianX+c);
+  *value = a*sine+d;
+  partialDerivatives[0] = sine;
+  partialDerivatives[1] = radianX*a*cosine;
+  partialDerivatives[2] = a*cosine;
+  partialDerivatives[3] = 1.0;
+}
+
 Expression TrigonometricModel::expression(double * modelCoefficients) {
   double a = modelCoefficients[0];
   double b = modelCoefficients[1];
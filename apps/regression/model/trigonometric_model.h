@@ -12,6 +12,7 @@ public:
   I18n::Message formulaMessage() const override { return I18n::Message::TrigonometricRegressionFormula; }
   double evaluate(double * modelCoefficients, double x) const override;
   double partialDerivate(double * modelCoefficients, int derivateCoefficientIndex, double x) const override;
+  void evaluateWithPartialDerivatives(double * modelCoefficients, double x, double * value, double * partialDerivatives) const override;
   int numberOfCoefficients() const override { return 4; }
   int bannerLinesCount() const override { return 4; }
 private:
@@ -14,17 +14,19 @@ static inline float maxFloat(float x, float y) { return x > y ? x : y; }
 static inline float minFloat(float x, float y) { return x < y ? x : y; }
 
 static_assert(Model::k_numberOfModels == 9, "Number of models changed, Regression::Store() needs to adapt");
-static_assert(Store::k_numberOfSeries == 3, "Number of series changed, Regression::Store() needs to adapt (m_seriesChecksum)");
 
 Store::Store() :
   InteractiveCurveViewRange(),
   DoublePairStore(),
-  m_seriesChecksum{0, 0, 0},
+  m_seriesChecksum{},
+  m_fitReports{},
   m_angleUnit(Poincare::Preferences::AngleUnit::Degree)
 {
   for (int i = 0; i < k_numberOfSeries; i++) {
     m_regressionTypes[i] = Model::Type::Linear;
-    m_regressionChanged[i] = false;
+    for (int j = 0; j < Model::k_numberOfModels; j++) {
+      m_regressionChanged[i][j] = true;
+    }
   }
 }
 
@@ -37,10 +39,7 @@ void Store::tidy() {
 /* Regressions */
 void Store::setSeriesRegressionType(int series, Model::Type type) {
   assert(series >= 0 && series < k_numberOfSeries);
-  if (m_regressionTypes[series] != type) {
-    m_regressionTypes[series] = type;
-    m_regressionChanged[series] = true;
-  }
+  m_regressionTypes[series] = type;
 }
 
 /* Dots */
@@ -170,18 +169,22 @@ double * Store::coefficientsForSeries(int series, Poincare::Context * globalCont
   if (m_angleUnit != currentAngleUnit) {
     m_angleUnit = currentAngleUnit;
     for (int i = 0; i < k_numberOfSeries; i++) {
-      if (m_regressionTypes[i] == Model::Type::Trigonometric) {
-        m_regressionChanged[i] = true;
-      }
+      m_regressionChanged[i][(int)Model::Type::Trigonometric] = true;
     }
   }
-  if (m_regressionChanged[series] || (m_seriesChecksum[series] != storeChecksumSeries)) {
+  int type = (int)m_regressionTypes[series];
+  if (m_regressionChanged[series][type] || (m_seriesChecksum[series][type] != storeChecksumSeries)) {
     Model * seriesModel = modelForSeries(series);
-    seriesModel->fit(this, series, m_regressionCoefficients[series], globalContext);
-    m_regressionChanged[series] = false;
-    m_seriesChecksum[series] = storeChecksumSeries;
+    m_fitReports[series][type] = seriesModel->fit(this, series, m_regressionCoefficients[series][type], globalContext);
+    m_regressionChanged[series][type] = false;
+    m_seriesChecksum[series][type] = storeChecksumSeries;
   }
-  return m_regressionCoefficients[series];
+  return m_regressionCoefficients[series][type];
+}
+
+Model::FitReport Store::fitReportForSeries(int series, Poincare::Context * globalContext) {
+  coefficientsForSeries(series, globalContext);
+  return m_fitReports[series][(int)m_regressionTypes[series]];
 }
 
 double Store::doubleCastedNumberOfPairsOfSeries(int series) const {
@@ -204,22 +207,6 @@ float Store::minValueOfColumn(int series, int i) const {
   return minColumn;
 }
 
-double Store::squaredValueSumOfColumn(int series, int i) const {
-  double result = 0;
-  for (int k = 0; k < numberOfPairsOfSeries(series); k++) {
-    result += m_data[series][i][k]*m_data[series][i][k];
-  }
-  return result;
-}
-
-double Store::columnProductSum(int series) const {
-  double result = 0;
-  for (int k = 0; k < numberOfPairsOfSeries(series); k++) {
-    result += m_data[series][0][k]*m_data[series][1][k];
-  }
-  return result;
-}
-
 double Store::meanOfColumn(int series, int i) const {
   return numberOfPairsOfSeries(series) == 0 ? 0 : sumOfColumn(series, i)/numberOfPairsOfSeries(series);
 }
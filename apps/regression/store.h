@@ -55,9 +55,9 @@ public:
 
   // Calculation
   double * coefficientsForSeries(int series, Poincare::Context * globalContext);
+  // Report of the fit which computed the current coefficients of the series
+  Model::FitReport fitReportForSeries(int series, Poincare::Context * globalContext);
   double doubleCastedNumberOfPairsOfSeries(int series) const;
-  double squaredValueSumOfColumn(int series, int i) const;
-  double columnProductSum(int series) const;
   double meanOfColumn(int series, int i) const;
   double varianceOfColumn(int series, int i) const;
   double standardDeviationOfColumn(int series, int i) const;
@@ -73,7 +73,10 @@ private:
   float maxValueOfColumn(int series, int i) const; //TODO LEA why float ?
   float minValueOfColumn(int series, int i) const; //TODO LEA why float ?
   Model * regressionModel(int index);
-  uint32_t m_seriesChecksum[k_numberOfSeries];
+  /* The coefficients are memoized for each series and each model, along with
+   * the checksum of the data they were fitted on, so that switching models
+   * does not fit them again. */
+  uint32_t m_seriesChecksum[k_numberOfSeries][Model::k_numberOfModels];
   Model::Type m_regressionTypes[k_numberOfSeries];
   LinearModel m_linearModel;
   QuadraticModel m_quadraticModel;
@@ -84,8 +87,9 @@ private:
   PowerModel m_powerModel;
   TrigonometricModel m_trigonometricModel;
   LogisticModel m_logisticModel;
-  double m_regressionCoefficients[k_numberOfSeries][Model::k_maxNumberOfCoefficients];
-  bool m_regressionChanged[k_numberOfSeries];
+  double m_regressionCoefficients[k_numberOfSeries][Model::k_numberOfModels][Model::k_maxNumberOfCoefficients];
+  Model::FitReport m_fitReports[k_numberOfSeries][Model::k_numberOfModels];
+  bool m_regressionChanged[k_numberOfSeries][Model::k_numberOfModels];
   Poincare::Preferences::AngleUnit m_angleUnit;
 };
 
@@ -48,6 +48,15 @@ QUIZ_CASE(quadratic_regression) {
   assert_regression_is(x, y, 5, Model::Type::Quadratic, coefficients);
 }
 
+/* Far from the origin, the columns of the design matrix are almost colinear
+ * and the normal equations lose most of their precision. */
+QUIZ_CASE(quadratic_regression_far_from_origin) {
+  double x[] = {100.0, 101.0, 102.0, 103.0, 104.0, 105.0, 106.0, 107.0, 108.0, 109.0, 110.0};
+  double y[] = {4701.0, 4798.5, 4897.0, 4996.5, 5097.0, 5198.5, 5301.0, 5404.5, 5509.0, 5614.5, 5721.0};
+  double coefficients[] = {0.5, -3.0, 1.0};
+  assert_regression_is(x, y, 11, Model::Type::Quadratic, coefficients);
+}
+
 QUIZ_CASE(cubic_regression) {
   double x[] = {-3.0, -2.8, -1.0, 0.0, 12.0};
   double y[] = {691.261, 566.498, 20.203, -12.865, -34293.21};
@@ -107,3 +116,31 @@ QUIZ_CASE(logistic_regression) {
   double coefficients[] = {6, 1.5, 4.7};
   assert_regression_is(x, y, 4, Model::Type::Logistic, coefficients);
 }
+
+QUIZ_CASE(regression_fit_report) {
+  double x[] = {2.3, 5.6, 1.1, 4.3};
+  double y[] = {3.948, 4.694, 2.184, 4.656};
+  int series = 0;
+  Regression::Store store;
+  for (int i = 0; i < 4; i++) {
+    store.set(x[i], series, 0, i);
+    store.set(y[i], series, 1, i);
+  }
+  RegressionContext context(&store);
+
+  store.setSeriesRegressionType(series, Model::Type::Logistic);
+  Model::FitReport logisticReport = store.fitReportForSeries(series, &context);
+  quiz_assert(logisticReport.hasConverged);
+  quiz_assert(logisticReport.numberOfIterations > 0);
+  double logisticCoefficient = store.coefficientsForSeries(series, &context)[2];
+
+  store.setSeriesRegressionType(series, Model::Type::Linear);
+  Model::FitReport linearReport = store.fitReportForSeries(series, &context);
+  quiz_assert(linearReport.hasConverged && linearReport.numberOfIterations == 0);
+
+  // Coming back to a model reuses its coefficients until the data changes
+  store.setSeriesRegressionType(series, Model::Type::Logistic);
+  quiz_assert(store.coefficientsForSeries(series, &context)[2] == logisticCoefficient);
+  store.set(4.7, series, 1, 1);
+  quiz_assert(store.coefficientsForSeries(series, &context)[2] != logisticCoefficient);
+}
@@ -46,7 +46,9 @@ void Sequence::setType(Type t) {
   if (type() == Type::Explicit) {
     setInitialRank(0);
   }
-  recordData()->setType(t);
+  RecordDataBuffer data = *recordData();
+  data.setType(t);
+  setRecordData(data);
   tidy();
   /* Reset all contents */
   switch (t) {
@@ -75,7 +77,9 @@ void Sequence::setType(Type t) {
 }
 
 void Sequence::setInitialRank(int rank) {
-  recordData()->setInitialRank(rank);
+  RecordDataBuffer data = *recordData();
+  data.setInitialRank(rank);
+  setRecordData(data);
   m_firstInitialCondition.tidyName();
   m_secondInitialCondition.tidyName();
 }
@@ -215,6 +219,12 @@ Sequence::RecordDataBuffer * Sequence::recordData() const {
   return reinterpret_cast<RecordDataBuffer *>(const_cast<void *>(d.buffer));
 }
 
+void Sequence::setRecordData(const RecordDataBuffer & data) {
+  Ion::Storage::Record::ErrorStatus error = patchValue(0, &data, sizeof(RecordDataBuffer));
+  assert(error == Ion::Storage::Record::ErrorStatus::None);
+  (void)error;
+}
+
 /* Sequence Model */
 
 Poincare::Layout Sequence::SequenceModel::name(Sequence * sequence) {
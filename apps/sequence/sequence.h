@@ -152,6 +152,7 @@ private:
   size_t metaDataSize() const override { return sizeof(RecordDataBuffer); }
   const Shared::ExpressionModel * model() const override { return &m_definition; }
   RecordDataBuffer * recordData() const;
+  void setRecordData(const RecordDataBuffer & data);
   DefinitionModel m_definition;
   FirstInitialConditionModel m_firstInitialCondition;
   SecondInitialConditionModel m_secondInitialCondition;
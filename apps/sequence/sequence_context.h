@@ -51,6 +51,9 @@ public:
   void setExpressionForSymbolAbstract(const Poincare::Expression & expression, const Poincare::SymbolAbstract & symbol) override {
     m_parentContext->setExpressionForSymbolAbstract(expression, symbol);
   }
+  bool resolvesSymbolsFromStorage() const override {
+    return m_parentContext->resolvesSymbolsFromStorage();
+  }
   template<typename T> T valueOfSequenceAtPreviousRank(int sequenceIndex, int rank) const {
     if (sizeof(T) == sizeof(float)) {
       return m_floatSequenceContext.valueOfSequenceAtPreviousRank(sequenceIndex, rank);
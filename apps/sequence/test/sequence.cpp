@@ -3,9 +3,11 @@
 #include <string.h>
 #include <assert.h>
 #include <cmath>
+#include <poincare/variable_context.h>
 #include "../sequence_store.h"
 #include "../sequence_context.h"
 #include "../../shared/poincare_helpers.h"
+#include "../../shared/reduction_cache.h"
 
 using namespace Poincare;
 using namespace Shared;
@@ -344,4 +346,58 @@ QUIZ_CASE(sequence_sum_evaluation) {
   check_sum_of_sequence_between_bounds(92.0, 2.0, 7.0, Sequence::Type::DoubleRecurrence, "u(n)+u(n+1)+2", "0", "0");
 }
 
+QUIZ_CASE(sequence_reduction_cache) {
+  Shared::GlobalContext globalContext;
+  SequenceStore store;
+  SequenceContext sequenceContext(&globalContext, &store);
+  ReductionCache * cache = ReductionCache::sharedCache();
+  cache->clear();
+
+  Sequence * u = addSequence(&store, Sequence::Type::Explicit, "3n+a", nullptr, nullptr);
+  quiz_assert(std::isnan(u->evaluateXYAtParameter(2.0, &sequenceContext).x2()));
+  quiz_assert(cache->numberOfHits() == 0 && cache->numberOfMisses() == 1);
+
+  // A tidied sequence gets its reduced expression back from the cache
+  store.tidy();
+  sequenceContext.resetCache();
+  u = store.modelForRecord(store.recordAtIndex(0));
+  quiz_assert(std::isnan(u->evaluateXYAtParameter(2.0, &sequenceContext).x2()));
+  quiz_assert(cache->numberOfHits() == 1 && cache->numberOfMisses() == 1);
+
+  // Defining a variable changes the records the expression may refer to
+  Expression::ParseAndSimplify("2→a", &globalContext, Preferences::ComplexFormat::Real, Preferences::AngleUnit::Radian);
+  store.tidy();
+  sequenceContext.resetCache();
+  u = store.modelForRecord(store.recordAtIndex(0));
+  quiz_assert(u->evaluateXYAtParameter(2.0, &sequenceContext).x2() == 8.0);
+  quiz_assert(cache->numberOfHits() == 1 && cache->numberOfMisses() == 2);
+
+  // Changing records the expression cannot refer to keeps the entry
+  quiz_assert(Ion::Storage::sharedStorage()->createRecordWithExtension("s", Ion::Storage::pyExtension, "\x01", 2) == Ion::Storage::Record::ErrorStatus::None);
+  store.tidy();
+  sequenceContext.resetCache();
+  u = store.modelForRecord(store.recordAtIndex(0));
+  quiz_assert(u->evaluateXYAtParameter(2.0, &sequenceContext).x2() == 8.0);
+  quiz_assert(cache->numberOfHits() == 2 && cache->numberOfMisses() == 2);
+
+  // Contexts defining symbols of their own bypass the cache
+  Expression e = Expression::Parse("b+1");
+  Expression reduced = cache->simplifiedExpression(e.addressInPool(), e.size(), &globalContext, ExpressionNode::ReductionTarget::SystemForApproximation);
+  quiz_assert(reduced.type() == ExpressionNode::Type::Addition);
+  quiz_assert(cache->numberOfHits() == 2 && cache->numberOfMisses() == 3);
+  VariableContext variableContext("b", &globalContext);
+  variableContext.setApproximationForVariable<double>(2.0);
+  reduced = cache->simplifiedExpression(e.addressInPool(), e.size(), &variableContext, ExpressionNode::ReductionTarget::SystemForApproximation);
+  quiz_assert(reduced.type() != ExpressionNode::Type::Addition);
+  quiz_assert(cache->numberOfHits() == 2 && cache->numberOfMisses() == 3);
+  reduced = cache->simplifiedExpression(e.addressInPool(), e.size(), &globalContext, ExpressionNode::ReductionTarget::SystemForApproximation);
+  quiz_assert(reduced.type() == ExpressionNode::Type::Addition);
+  quiz_assert(cache->numberOfHits() == 3 && cache->numberOfMisses() == 3);
+
+  Ion::Storage::sharedStorage()->destroyRecordWithBaseNameAndExtension("s", Ion::Storage::pyExtension);
+  Ion::Storage::sharedStorage()->destroyRecordWithBaseNameAndExtension("a", Ion::Storage::expExtension);
+  store.removeAll();
+  cache->clear();
+}
+
 }
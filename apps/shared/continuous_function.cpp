@@ -126,7 +126,9 @@ void ContinuousFunction::setPlotType(PlotType newPlotType, Poincare::Preferences
     return;
   }
 
-  recordData()->setPlotType(newPlotType);
+  RecordDataBuffer data = *recordData();
+  data.setPlotType(newPlotType);
+  setRecordData(data);
 
   // Recompute the layouts
   m_model.tidy();
@@ -187,7 +189,21 @@ I18n::Message ContinuousFunction::ParameterMessageForPlotType(PlotType plotType)
 
 template <typename T>
 Poincare::Coordinate2D<T> ContinuousFunction::privateEvaluateXYAtParameter(T t, Poincare::Context * context) const {
-  Coordinate2D<T> x1x2 = templatedApproximateAtParameter(t, context);
+  return xyFromApproximation(templatedApproximateAtParameter(t, context));
+}
+
+template <typename T>
+void ContinuousFunction::privateEvaluateXYAtParameters(const T * t, Poincare::Coordinate2D<T> * xy, int numberOfParameters, Poincare::Context * context) const {
+  templatedApproximateAtParameters(t, xy, numberOfParameters, context);
+  if (plotType() == PlotType::Polar) {
+    for (int i = 0; i < numberOfParameters; i++) {
+      xy[i] = xyFromApproximation(xy[i]);
+    }
+  }
+}
+
+template <typename T>
+Poincare::Coordinate2D<T> ContinuousFunction::xyFromApproximation(Poincare::Coordinate2D<T> x1x2) const {
   PlotType type = plotType();
   if (type == PlotType::Cartesian || type == PlotType::Parametric) {
     return x1x2;
@@ -211,7 +227,9 @@ bool ContinuousFunction::displayDerivative() const {
 }
 
 void ContinuousFunction::setDisplayDerivative(bool display) {
-  return recordData()->setDisplayDerivative(display);
+  RecordDataBuffer data = *recordData();
+  data.setDisplayDerivative(display);
+  setRecordData(data);
 }
 
 int ContinuousFunction::printValue(double cursorT, double cursorX, double cursorY, char * buffer, int bufferSize, int precision, Poincare::Context * context) {
@@ -253,11 +271,15 @@ float ContinuousFunction::tMax() const {
 }
 
 void ContinuousFunction::setTMin(float tMin) {
-  recordData()->setTMin(tMin);
+  RecordDataBuffer data = *recordData();
+  data.setTMin(tMin);
+  setRecordData(data);
 }
 
 void ContinuousFunction::setTMax(float tMax) {
-  recordData()->setTMax(tMax);
+  RecordDataBuffer data = *recordData();
+  data.setTMax(tMax);
+  setRecordData(data);
 }
 
 void * ContinuousFunction::Model::expressionAddress(const Ion::Storage::Record * record) const {
@@ -268,12 +290,61 @@ size_t ContinuousFunction::Model::expressionSize(const Ion::Storage::Record * re
   return record->value().size-sizeof(RecordDataBuffer);
 }
 
+void ContinuousFunction::Model::tidy() const {
+  for (int i = 0; i < k_numberOfPrograms; i++) {
+    m_programs[i].reset();
+  }
+  ExpressionModel::tidy();
+}
+
+const ApproximationProgram * ContinuousFunction::Model::program(const Expression e, int coordinateIndex, const char * symbol, Context * context) const {
+  assert(coordinateIndex >= 0 && coordinateIndex < k_numberOfPrograms);
+  Preferences * preferences = Preferences::sharedPreferences();
+  if (preferences->complexFormat() != m_programsComplexFormat || preferences->angleUnit() != m_programsAngleUnit) {
+    for (int i = 0; i < k_numberOfPrograms; i++) {
+      m_programs[i].reset();
+    }
+    m_programsComplexFormat = preferences->complexFormat();
+    m_programsAngleUnit = preferences->angleUnit();
+  }
+  ApproximationProgram * program = m_programs + coordinateIndex;
+  if (program->needsCompilation()) {
+    program->compile(e, symbol, context, Expression::UpdatedComplexFormatWithExpressionInput(m_programsComplexFormat, e, context), m_programsAngleUnit);
+  }
+  return program;
+}
+
+template<typename T>
+T ContinuousFunction::Model::approximateCoordinateWithValueForSymbol(const Expression e, int coordinateIndex, const char * symbol, T t, Context * context) const {
+  T result;
+  if (program(e, coordinateIndex, symbol, context)->approximateWithValueForSymbol<T>(t, &result)) {
+    return result;
+  }
+  return PoincareHelpers::ApproximateWithValueForSymbol(e, symbol, t, context);
+}
+
+template<typename T>
+void ContinuousFunction::Model::approximateCoordinateWithValuesForSymbol(const Expression e, int coordinateIndex, const char * symbol, const T * t, T * results, int numberOfValues, Context * context) const {
+  PoincareHelpers::ApproximateWithValuesForSymbol(e, symbol, t, results, numberOfValues, context, program(e, coordinateIndex, symbol, context));
+}
+
+template<typename T>
+bool ContinuousFunction::Model::approximateCoordinateOnInterval(const Expression e, int coordinateIndex, const char * symbol, Poincare::Interval<T> t, Poincare::Interval<T> * result, Context * context) const {
+  return program(e, coordinateIndex, symbol, context)->approximateOnInterval<T>(t, result);
+}
+
 ContinuousFunction::RecordDataBuffer * ContinuousFunction::recordData() const {
   assert(!isNull());
   Ion::Storage::Record::Data d = value();
   return reinterpret_cast<RecordDataBuffer *>(const_cast<void *>(d.buffer));
 }
 
+void ContinuousFunction::setRecordData(const RecordDataBuffer & data) {
+  Ion::Storage::Record::ErrorStatus error = patchValue(0, &data, sizeof(RecordDataBuffer));
+  assert(error == Ion::Storage::Record::ErrorStatus::None);
+  (void)error;
+}
+
 template<typename T>
 Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Poincare::Context * context) const {
   if (isCircularlyDefined(context) || t < tMin() || t > tMax()) {
@@ -284,7 +355,7 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Poincar
   Poincare::SerializationHelper::CodePoint(unknown, bufferSize, UCodePointUnknownX);
   PlotType type = plotType();
   if (type == PlotType::Cartesian || type == PlotType::Polar) {
-    return Coordinate2D<T>(t, PoincareHelpers::ApproximateWithValueForSymbol(expressionReduced(context), unknown, t, context));
+    return Coordinate2D<T>(t, m_model.approximateCoordinateWithValueForSymbol(expressionReduced(context), 0, unknown, t, context));
   }
   assert(type == PlotType::Parametric);
   Expression e = expressionReduced(context);
@@ -292,8 +363,76 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Poincar
   assert(static_cast<Poincare::Matrix&>(e).numberOfRows() == 2);
   assert(static_cast<Poincare::Matrix&>(e).numberOfColumns() == 1);
   return Coordinate2D<T>(
-      PoincareHelpers::ApproximateWithValueForSymbol(e.childAtIndex(0), unknown, t, context),
-      PoincareHelpers::ApproximateWithValueForSymbol(e.childAtIndex(1), unknown, t, context));
+      m_model.approximateCoordinateWithValueForSymbol(e.childAtIndex(0), 0, unknown, t, context),
+      m_model.approximateCoordinateWithValueForSymbol(e.childAtIndex(1), 1, unknown, t, context));
+}
+
+template<typename T>
+void ContinuousFunction::templatedApproximateAtParameters(const T * t, Coordinate2D<T> * x1x2, int numberOfParameters, Poincare::Context * context) const {
+  PlotType type = plotType();
+  if (isCircularlyDefined(context)) {
+    for (int i = 0; i < numberOfParameters; i++) {
+      x1x2[i] = Coordinate2D<T>(type == PlotType::Cartesian ? t[i] : NAN, NAN);
+    }
+    return;
+  }
+  constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
+  char unknown[bufferSize];
+  Poincare::SerializationHelper::CodePoint(unknown, bufferSize, UCodePointUnknownX);
+  Expression e = expressionReduced(context);
+  assert(type != PlotType::Parametric || (e.type() == ExpressionNode::Type::Matrix && static_cast<Poincare::Matrix&>(e).numberOfRows() == 2 && static_cast<Poincare::Matrix&>(e).numberOfColumns() == 1));
+  /* Parameters out of the definition interval are not approximated: the
+   * others are gathered in chunks approximated at once. */
+  constexpr int k_chunkLength = ApproximationProgram::k_batchLength;
+  T tMinimum = tMin();
+  T tMaximum = tMax();
+  T ts[k_chunkLength];
+  int indexes[k_chunkLength];
+  T x1s[k_chunkLength];
+  T x2s[k_chunkLength];
+  int i = 0;
+  while (i < numberOfParameters) {
+    int length = 0;
+    for (; i < numberOfParameters && length < k_chunkLength; i++) {
+      if (t[i] < tMinimum || t[i] > tMaximum) {
+        x1x2[i] = Coordinate2D<T>(type == PlotType::Cartesian ? t[i] : NAN, NAN);
+      } else {
+        ts[length] = t[i];
+        indexes[length++] = i;
+      }
+    }
+    if (length == 0) {
+      continue;
+    }
+    if (type == PlotType::Parametric) {
+      m_model.approximateCoordinateWithValuesForSymbol(e.childAtIndex(0), 0, unknown, ts, x1s, length, context);
+      m_model.approximateCoordinateWithValuesForSymbol(e.childAtIndex(1), 1, unknown, ts, x2s, length, context);
+    } else {
+      m_model.approximateCoordinateWithValuesForSymbol(e, 0, unknown, ts, x2s, length, context);
+    }
+    for (int j = 0; j < length; j++) {
+      x1x2[indexes[j]] = Coordinate2D<T>(type == PlotType::Parametric ? x1s[j] : ts[j], x2s[j]);
+    }
+  }
+}
+
+bool ContinuousFunction::evaluateYOnXInterval(Poincare::Interval<float> x, Poincare::Interval<float> * y, Poincare::Context * context) const {
+  assert(plotType() == PlotType::Cartesian);
+  if (isCircularlyDefined(context)) {
+    return false;
+  }
+  // The function is undefined out of [tMin, tMax]
+  float tMinimum = tMin();
+  float tMaximum = tMax();
+  if (x.upperBound() < tMinimum || x.lowerBound() > tMaximum) {
+    *y = Poincare::Interval<float>::Undefined();
+    return true;
+  }
+  Poincare::Interval<float> domainX(maxDouble(x.lowerBound(), tMinimum), minDouble(x.upperBound(), tMaximum), x.lowerBound() >= tMinimum && x.upperBound() <= tMaximum);
+  constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
+  char unknown[bufferSize];
+  Poincare::SerializationHelper::CodePoint(unknown, bufferSize, UCodePointUnknownX);
+  return m_model.approximateCoordinateOnInterval(expressionReduced(context), 0, unknown, domainX, y, context);
 }
 
 Coordinate2D<double> ContinuousFunction::nextMinimumFrom(double start, double step, double max, Context * context) const {
@@ -352,5 +491,7 @@ Poincare::Expression ContinuousFunction::sumBetweenBounds(double start, double e
 
 template Coordinate2D<float> ContinuousFunction::templatedApproximateAtParameter<float>(float, Poincare::Context *) const;
 template Coordinate2D<double> ContinuousFunction::templatedApproximateAtParameter<double>(double, Poincare::Context *) const;
+template void ContinuousFunction::templatedApproximateAtParameters<double>(const double *, Coordinate2D<double> *, int, Poincare::Context *) const;
+template void ContinuousFunction::privateEvaluateXYAtParameters<float>(const float *, Coordinate2D<float> *, int, Poincare::Context *) const;
 
 }
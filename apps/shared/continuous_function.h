@@ -12,6 +12,7 @@
 #include "global_context.h"
 #include "function.h"
 #include "range_1D.h"
+#include <poincare/approximation_program.h>
 #include <poincare/symbol.h>
 #include <poincare/coordinate_2D.h>
 
@@ -48,6 +49,16 @@ public:
   Poincare::Coordinate2D<double> evaluateXYAtParameter(double t, Poincare::Context * context) const override {
     return privateEvaluateXYAtParameter<double>(t, context);
   }
+  // Evaluation at numberOfParameters parameters at once
+  void evaluate2DAtParameters(const double * t, Poincare::Coordinate2D<double> * x1x2, int numberOfParameters, Poincare::Context * context) const {
+    templatedApproximateAtParameters(t, x1x2, numberOfParameters, context);
+  }
+  void evaluateXYAtParameters(const float * t, Poincare::Coordinate2D<float> * xy, int numberOfParameters, Poincare::Context * context) const {
+    privateEvaluateXYAtParameters<float>(t, xy, numberOfParameters, context);
+  }
+  /* Encloses the ordinates of a cartesian function over an interval of
+   * abscissas. Returns false if they cannot be enclosed. */
+  bool evaluateYOnXInterval(Poincare::Interval<float> x, Poincare::Interval<float> * y, Poincare::Context * context) const;
 
   // Derivative
   bool displayDerivative() const;
@@ -78,6 +89,8 @@ private:
   typedef Poincare::Coordinate2D<double> (*ComputePointOfInterest)(Poincare::Expression e, char * symbol, double start, double step, double max, Poincare::Context * context);
   Poincare::Coordinate2D<double> nextPointOfInterestFrom(double start, double step, double max, Poincare::Context * context, ComputePointOfInterest compute) const;
   template <typename T> Poincare::Coordinate2D<T> privateEvaluateXYAtParameter(T t, Poincare::Context * context) const;
+  template <typename T> void privateEvaluateXYAtParameters(const T * t, Poincare::Coordinate2D<T> * xy, int numberOfParameters, Poincare::Context * context) const;
+  template <typename T> Poincare::Coordinate2D<T> xyFromApproximation(Poincare::Coordinate2D<T> x1x2) const;
   /* RecordDataBuffer is the layout of the data buffer of Record
    * representing a ContinuousFunction. See comment on
    * Shared::Function::RecordDataBuffer about packing. */
@@ -107,14 +120,34 @@ private:
   };
   class Model : public ExpressionModel {
   public:
+    Model() :
+      ExpressionModel(),
+      m_programsComplexFormat(Poincare::Preferences::ComplexFormat::Real),
+      m_programsAngleUnit(Poincare::Preferences::AngleUnit::Radian)
+    {}
     void * expressionAddress(const Ion::Storage::Record * record) const override;
+    void tidy() const override;
+    /* The reduced expression of each coordinate is compiled on its first
+     * approximation. The expression is approximated directly when the program
+     * cannot handle it. */
+    template<typename T> T approximateCoordinateWithValueForSymbol(const Poincare::Expression e, int coordinateIndex, const char * symbol, T t, Poincare::Context * context) const;
+    template<typename T> void approximateCoordinateWithValuesForSymbol(const Poincare::Expression e, int coordinateIndex, const char * symbol, const T * t, T * results, int numberOfValues, Poincare::Context * context) const;
+    template<typename T> bool approximateCoordinateOnInterval(const Poincare::Expression e, int coordinateIndex, const char * symbol, Poincare::Interval<T> t, Poincare::Interval<T> * result, Poincare::Context * context) const;
   private:
+    constexpr static int k_numberOfPrograms = 2;
     size_t expressionSize(const Ion::Storage::Record * record) const override;
+    const Poincare::ApproximationProgram * program(const Poincare::Expression e, int coordinateIndex, const char * symbol, Poincare::Context * context) const;
+    mutable Poincare::ApproximationProgram m_programs[k_numberOfPrograms];
+    // The preferences the programs were compiled with
+    mutable Poincare::Preferences::ComplexFormat m_programsComplexFormat;
+    mutable Poincare::Preferences::AngleUnit m_programsAngleUnit;
   };
   size_t metaDataSize() const override { return sizeof(RecordDataBuffer); }
   const ExpressionModel * model() const override { return &m_model; }
   RecordDataBuffer * recordData() const;
+  void setRecordData(const RecordDataBuffer & data);
   template<typename T> Poincare::Coordinate2D<T> templatedApproximateAtParameter(T t, Poincare::Context * context) const;
+  template<typename T> void templatedApproximateAtParameters(const T * t, Poincare::Coordinate2D<T> * x1x2, int numberOfParameters, Poincare::Context * context) const;
   Model m_model;
 };
 
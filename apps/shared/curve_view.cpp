@@ -110,7 +110,8 @@ const float CurveView::pixelWidth() const {
 }
 
 const float CurveView::pixelHeight() const {
-  return (m_curveViewRange->yMax() - m_curveViewRange->yMin()) / (m_frame.height() - m_bannerView->minimalSizeForOptimalDisplay().height() - 1);
+  KDCoordinate bannerHeight = (m_bannerView != nullptr) ? m_bannerView->minimalSizeForOptimalDisplay().height() : 0;
+  return (m_curveViewRange->yMax() - m_curveViewRange->yMin()) / (m_frame.height() - bannerHeight - 1);
 }
 
 float CurveView::pixelToFloat(Axis axis, KDCoordinate p) const {
@@ -504,40 +505,75 @@ const uint8_t stampMask[stampSize+1][stampSize+1] = {
 #endif
 
 constexpr static int k_maxNumberOfIterations = 10;
-
-void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool colorUnderCurve, float colorLowerBound, float colorUpperBound) const {
+/* When a batch evaluation is provided, the regularly spaced parameters of a
+ * curve are evaluated k_numberOfBatchedParameters at a time. */
+constexpr static int k_numberOfBatchedParameters = 16;
+/* When an interval evaluation is provided, cartesian curves are sampled on
+ * intervals of k_numberOfColumnsPerInterval pixel columns. A
+ * discontinuity is located within a column by bisecting it at most
+ * k_maxNumberOfSubColumnBisections times: the curve around a pole must reach
+ * the edge of the view. Each bisection only refines the half containing the
+ * discontinuity, the other one being continuous. If both halves are
+ * discontinuous, the bisection stops, so that a column takes a number of
+ * evaluations linear in k_maxNumberOfSubColumnBisections. */
+constexpr static int k_numberOfColumnsPerInterval = 8;
+constexpr static int k_maxNumberOfSubColumnBisections = 16;
+
+static bool IntervalIsDiscontinuous(CurveView::EvaluateYIntervalForXInterval yIntervalEvaluation, void * model, void * context, float t, float s) {
+  Poincare::Interval<float> yInterval;
+  return yIntervalEvaluation(Poincare::Interval<float>(t, s), &yInterval, model, context) && !yInterval.isUndefined() && !yInterval.isContinuous();
+}
+
+void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, EvaluateXYForParameters xyBatchEvaluation) const {
   float previousT = NAN;
   float t = NAN;
   float previousX = NAN;
   float x = NAN;
   float previousY = NAN;
   float y = NAN;
+  float parameters[k_numberOfBatchedParameters];
+  Coordinate2D<float> batchedXY[k_numberOfBatchedParameters];
   int i = 0;
+  bool reachedEnd = false;
   do {
-    previousT = t;
-    t = tStart + (i++) * tStep;
-    if (t <= tStart) {
-      t = tStart + FLT_EPSILON;
-    }
-    if (t >= tEnd) {
-      t = tEnd - FLT_EPSILON;
+    // Compute the next regularly spaced parameters
+    int numberOfParameters = 0;
+    float lastT = t;
+    while (numberOfParameters < k_numberOfBatchedParameters) {
+      float nextT = tStart + (i++) * tStep;
+      if (nextT <= tStart) {
+        nextT = tStart + FLT_EPSILON;
+      }
+      if (nextT >= tEnd) {
+        nextT = tEnd - FLT_EPSILON;
+      }
+      if (lastT == nextT) {
+        reachedEnd = true;
+        break;
+      }
+      parameters[numberOfParameters++] = nextT;
+      lastT = nextT;
     }
-    if (previousT == t) {
-      break;
+    if (xyBatchEvaluation != nullptr && numberOfParameters > 0) {
+      xyBatchEvaluation(parameters, batchedXY, numberOfParameters, model, context);
     }
-    previousX = x;
-    previousY = y;
-    Coordinate2D<float> xy = xyEvaluation(t, model, context);
-    x = xy.x1();
-    y = xy.x2();
-    if (colorUnderCurve && !std::isnan(x) && colorLowerBound < x && x < colorUpperBound && !(std::isnan(y) || std::isinf(y))) {
-      drawSegment(ctx, rect, Axis::Vertical, x, minFloat(0.0f, y), maxFloat(0.0f, y), color, 1);
+    for (int j = 0; j < numberOfParameters; j++) {
+      previousT = t;
+      t = parameters[j];
+      previousX = x;
+      previousY = y;
+      Coordinate2D<float> xy = xyBatchEvaluation != nullptr ? batchedXY[j] : xyEvaluation(t, model, context);
+      x = xy.x1();
+      y = xy.x2();
+      if (colorUnderCurve && !std::isnan(x) && colorLowerBound < x && x < colorUpperBound && !(std::isnan(y) || std::isinf(y))) {
+        drawSegment(ctx, rect, Axis::Vertical, x, minFloat(0.0f, y), maxFloat(0.0f, y), color, 1);
+      }
+      jointDots(ctx, rect, xyEvaluation, model, context, drawStraightLinesEarly, previousT, previousX, previousY, t, x, y, color, k_maxNumberOfIterations);
     }
-    jointDots(ctx, rect, xyEvaluation, model, context, drawStraightLinesEarly, previousT, previousX, previousY, t, x, y, color, k_maxNumberOfIterations);
-  } while (true);
+  } while (!reachedEnd);
 }
 
-void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForParameter xyEvaluation, void * model, void * context, KDColor color, bool colorUnderCurve, float colorLowerBound, float colorUpperBound) const {
+void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForParameter xyEvaluation, void * model, void * context, KDColor color, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, EvaluateXYForParameters xyBatchEvaluation, EvaluateYIntervalForXInterval yIntervalEvaluation) const {
   float rectLeft = pixelToFloat(Axis::Horizontal, rect.left() - k_externRectMargin);
   float rectRight = pixelToFloat(Axis::Horizontal, rect.right() + k_externRectMargin);
   float tStart = std::isnan(rectLeft) ? xMin : maxFloat(xMin, rectLeft);
@@ -547,7 +583,135 @@ void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, flo
     return;
   }
   float tStep = pixelWidth();
-  drawCurve(ctx, rect, tStart, tEnd, tStep, xyEvaluation, model, context, true, color, colorUnderCurve, colorLowerBound, colorUpperBound);
+  if (yIntervalEvaluation == nullptr) {
+    drawCurve(ctx, rect, tStart, tEnd, tStep, xyEvaluation, model, context, true, color, colorUnderCurve, colorLowerBound, colorUpperBound, xyBatchEvaluation);
+    return;
+  }
+  if (colorUnderCurve) {
+    float previousX = NAN;
+    for (int i = 0; ; i++) {
+      float x = tStart + i * tStep;
+      if (x > tEnd || x == previousX) {
+        break;
+      }
+      previousX = x;
+      if (colorLowerBound < x && x < colorUpperBound) {
+        float y = xyEvaluation(x, model, context).x2();
+        if (!(std::isnan(y) || std::isinf(y))) {
+          drawSegment(ctx, rect, Axis::Vertical, x, minFloat(0.0f, y), maxFloat(0.0f, y), color, 1);
+        }
+      }
+    }
+  }
+  drawCartesianCurveOnIntervals(ctx, rect, tStart, tEnd, tStep, xyEvaluation, xyBatchEvaluation, yIntervalEvaluation, model, context, color);
+}
+
+void CurveView::drawCartesianCurveOnIntervals(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForParameter xyEvaluation, EvaluateXYForParameters xyBatchEvaluation, EvaluateYIntervalForXInterval yIntervalEvaluation, void * model, void * context, KDColor color) const {
+  /* The curve is sampled at multiples of tStep, which are the same whatever
+   * the horizontal position of the range. */
+  float column = std::floor(tStart/tStep);
+  float lastColumn = std::ceil(tEnd/tStep);
+  float y = NAN;
+  while (column < lastColumn) {
+    float nextColumn = minFloat((std::floor(column/k_numberOfColumnsPerInterval) + 1.0f) * k_numberOfColumnsPerInterval, lastColumn);
+    if (nextColumn <= column) {
+      // tStep is negligible compared to the abscissas
+      return;
+    }
+    y = joinCartesianDotsOnInterval(ctx, rect, xyEvaluation, xyBatchEvaluation, yIntervalEvaluation, model, context, column * tStep, y, nextColumn * tStep, color, nextColumn - column, 0);
+    column = nextColumn;
+  }
+}
+
+float CurveView::joinCartesianDotsOnInterval(KDContext * ctx, KDRect rect, EvaluateXYForParameter xyEvaluation, EvaluateXYForParameters xyBatchEvaluation, EvaluateYIntervalForXInterval yIntervalEvaluation, void * model, void * context, float t, float y, float s, KDColor color, int numberOfColumns, int numberOfSubColumnBisections) const {
+  Poincare::Interval<float> yInterval;
+  if (!yIntervalEvaluation(Poincare::Interval<float>(t, s), &yInterval, model, context)) {
+    return joinCartesianDotsOnColumns(ctx, rect, xyEvaluation, xyBatchEvaluation, model, context, t, y, s, color, numberOfColumns);
+  }
+  if (yInterval.isUndefined()) {
+    return NAN;
+  }
+  float pyMin = floatToPixel(Axis::Vertical, yInterval.upperBound());
+  float pyMax = floatToPixel(Axis::Vertical, yInterval.lowerBound());
+  if (pyMax < rect.top() - stampSize || pyMin > rect.bottom() + stampSize) {
+    // The curve does not cross rect between t and s
+    return NAN;
+  }
+  if (yInterval.isContinuous()) {
+    if (pyMax - pyMin <= 1.0f || numberOfColumns <= 1) {
+      if (std::isnan(y)) {
+        y = xyEvaluation(t, model, context).x2();
+      }
+      float v = xyEvaluation(s, model, context).x2();
+      if (pyMax - pyMin <= 1.0f) {
+        // The curve stays within a pixel of the straight line
+        float pxf = floatToPixel(Axis::Horizontal, t);
+        float pyf = floatToPixel(Axis::Vertical, y);
+        float puf = floatToPixel(Axis::Horizontal, s);
+        float pvf = floatToPixel(Axis::Vertical, v);
+        stampAtLocation(ctx, rect, puf, pvf, color);
+        straightJoinDots(ctx, rect, pxf, pyf, puf, pvf, color);
+      } else {
+        /* The curve is continuous on the column, so jointDots does not
+         * bisect in vain. */
+        jointDots(ctx, rect, xyEvaluation, model, context, true, t, t, y, s, s, v, color, k_maxNumberOfIterations);
+      }
+      return v;
+    }
+  } else if (numberOfSubColumnBisections >= k_maxNumberOfSubColumnBisections) {
+    // Do not join the dots across the discontinuity
+    return NAN;
+  }
+  // Bisect on a column boundary, or within a column
+  int numberOfLeftColumns = numberOfColumns/2;
+  int numberOfRightColumns = numberOfColumns - numberOfLeftColumns;
+  float m;
+  if (numberOfColumns > 1) {
+    m = t + numberOfLeftColumns * ((s - t)/numberOfColumns);
+  } else {
+    numberOfLeftColumns = numberOfRightColumns = 0;
+    numberOfSubColumnBisections++;
+    m = (t + s)/2.0f;
+    if (m > t && m < s && IntervalIsDiscontinuous(yIntervalEvaluation, model, context, t, m) && IntervalIsDiscontinuous(yIntervalEvaluation, model, context, m, s)) {
+      // Do not join the dots across several discontinuities
+      return NAN;
+    }
+  }
+  if (m <= t || m >= s) {
+    return NAN;
+  }
+  float ym = joinCartesianDotsOnInterval(ctx, rect, xyEvaluation, xyBatchEvaluation, yIntervalEvaluation, model, context, t, y, m, color, numberOfLeftColumns, numberOfSubColumnBisections);
+  return joinCartesianDotsOnInterval(ctx, rect, xyEvaluation, xyBatchEvaluation, yIntervalEvaluation, model, context, m, ym, s, color, numberOfRightColumns, numberOfSubColumnBisections);
+}
+
+float CurveView::joinCartesianDotsOnColumns(KDContext * ctx, KDRect rect, EvaluateXYForParameter xyEvaluation, EvaluateXYForParameters xyBatchEvaluation, void * model, void * context, float t, float y, float s, KDColor color, int numberOfColumns) const {
+  if (numberOfColumns < 1) {
+    numberOfColumns = 1;
+  }
+  assert(numberOfColumns < k_numberOfBatchedParameters);
+  float columnWidth = (s - t)/numberOfColumns;
+  // The first parameter is t, the following ones the right edges of the columns
+  float parameters[k_numberOfBatchedParameters];
+  Coordinate2D<float> batchedXY[k_numberOfBatchedParameters];
+  parameters[0] = t;
+  for (int i = 1; i <= numberOfColumns; i++) {
+    parameters[i] = i == numberOfColumns ? s : t + i * columnWidth;
+  }
+  if (xyBatchEvaluation != nullptr) {
+    int firstParameter = std::isnan(y) ? 0 : 1;
+    xyBatchEvaluation(parameters + firstParameter, batchedXY + firstParameter, numberOfColumns + 1 - firstParameter, model, context);
+  }
+  if (std::isnan(y)) {
+    y = xyBatchEvaluation != nullptr ? batchedXY[0].x2() : xyEvaluation(t, model, context).x2();
+  }
+  for (int i = 1; i <= numberOfColumns; i++) {
+    float u = parameters[i];
+    float v = xyBatchEvaluation != nullptr ? batchedXY[i].x2() : xyEvaluation(u, model, context).x2();
+    jointDots(ctx, rect, xyEvaluation, model, context, true, t, t, y, u, u, v, color, k_maxNumberOfIterations);
+    t = u;
+    y = v;
+  }
+  return y;
 }
 
 void CurveView::drawHistogram(KDContext * ctx, KDRect rect, EvaluateYForX yEvaluation, void * model, void * context, float firstBarAbscissa, float barWidth,
@@ -7,6 +7,7 @@
 #include "cursor_view.h"
 #include <poincare/preferences.h>
 #include <poincare/coordinate_2D.h>
+#include <poincare/interval.h>
 #include <cmath>
 
 namespace Shared {
@@ -17,7 +18,9 @@ public:
    * labels appear completely. This gives 3*charWidth/320 = 3*7/320= 0.066 */
   static constexpr float k_labelsHorizontalMarginRatio = 0.066f;
   typedef Poincare::Coordinate2D<float> (*EvaluateXYForParameter)(float t, void * model, void * context);
+  typedef void (*EvaluateXYForParameters)(const float * t, Poincare::Coordinate2D<float> * xy, int numberOfParameters, void * model, void * context);
   typedef float (*EvaluateYForX)(float x, void * model, void * context);
+  typedef bool (*EvaluateYIntervalForXInterval)(Poincare::Interval<float> x, Poincare::Interval<float> * y, void * model, void * context);
   enum class Axis {
     Horizontal = 0,
     Vertical = 1
@@ -66,8 +69,12 @@ protected:
   void drawGrid(KDContext * ctx, KDRect rect) const;
   void drawAxes(KDContext * ctx, KDRect rect) const;
   void drawAxis(KDContext * ctx, KDRect rect, Axis axis) const;
-  void drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f) const;
-  void drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForParameter xyEvaluation, void * model, void * context, KDColor color, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f) const;
+  void drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EvaluateXYForParameters xyBatchEvaluation = nullptr) const;
+  /* If yIntervalEvaluation is provided, the curve is sampled on intervals of
+   * abscissas whose ordinates are enclosed, see drawCartesianCurveOnIntervals.
+   * xyBatchEvaluation then evaluates the columns of the intervals which cannot
+   * be enclosed. */
+  void drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForParameter xyEvaluation, void * model, void * context, KDColor color, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EvaluateXYForParameters xyBatchEvaluation = nullptr, EvaluateYIntervalForXInterval yIntervalEvaluation = nullptr) const;
   void drawHistogram(KDContext * ctx, KDRect rect, EvaluateYForX yEvaluation, void * model, void * context, float firstBarAbscissa, float barWidth,
     bool fillBar, KDColor defaultColor, KDColor highlightColor,  float highlightLowerBound = INFINITY, float highlightUpperBound = -INFINITY) const;
   void computeLabels(Axis axis);
@@ -88,6 +95,19 @@ private:
   /* Recursively join two dots (dichotomy). The method stops when the
    * maxNumberOfRecursion in reached. */
   void jointDots(KDContext * ctx, KDRect rect, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, float t, float x, float y, float s, float u, float v, KDColor color, int maxNumberOfRecursion) const;
+  /* Sample a cartesian curve on intervals of several pixel columns. An
+   * interval is skipped if the curve is undefined or out of rect on it, and
+   * joined with a straight line if the curve stays within a pixel high span.
+   * Otherwise, it is bisected down to a column, where a continuous curve is
+   * drawn with jointDots while a discontinuity is located by bisecting the
+   * column further, without joining the dots across it. */
+  void drawCartesianCurveOnIntervals(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForParameter xyEvaluation, EvaluateXYForParameters xyBatchEvaluation, EvaluateYIntervalForXInterval yIntervalEvaluation, void * model, void * context, KDColor color) const;
+  /* Draw the curve between t and s given y, its value at t or NAN if the curve
+   * is not to be joined from t. Returns the value at s or NAN likewise. */
+  float joinCartesianDotsOnInterval(KDContext * ctx, KDRect rect, EvaluateXYForParameter xyEvaluation, EvaluateXYForParameters xyBatchEvaluation, EvaluateYIntervalForXInterval yIntervalEvaluation, void * model, void * context, float t, float y, float s, KDColor color, int numberOfColumns, int numberOfSubColumnBisections) const;
+  /* Same as joinCartesianDotsOnInterval, without enclosing the curve. The
+   * columns are evaluated at once if xyBatchEvaluation is provided. */
+  float joinCartesianDotsOnColumns(KDContext * ctx, KDRect rect, EvaluateXYForParameter xyEvaluation, EvaluateXYForParameters xyBatchEvaluation, void * model, void * context, float t, float y, float s, KDColor color, int numberOfColumns) const;
   /* Join two dots with a straight line. */
   void straightJoinDots(KDContext * ctx, KDRect rect, float pxf, float pyf, float puf, float pvf, KDColor color) const;
   /* Stamp centered around (pxf, pyf). If pxf and pyf are not round number, the
@@ -16,6 +16,11 @@ void DoublePairStore::set(double f, int series, int i, int j) {
     int otherI = i == 0 ? 1 : 0;
     m_data[series][otherI][j] = defaultValue(series, otherI, j);
     m_numberOfPairs[series]++;
+    if (m_aggregatesAreValid[series]) {
+      addPairToAggregates(series, j);
+    }
+  } else {
+    m_aggregatesAreValid[series] = false;
   }
 }
 
@@ -37,6 +42,7 @@ void DoublePairStore::deletePairOfSeriesAtIndex(int series, int j) {
    * checksum. */
   m_data[series][0][m_numberOfPairs[series]] = 0;
   m_data[series][1][m_numberOfPairs[series]] = 0;
+  m_aggregatesAreValid[series] = false;
 }
 
 void DoublePairStore::deleteAllPairsOfSeries(int series) {
@@ -47,6 +53,8 @@ void DoublePairStore::deleteAllPairsOfSeries(int series) {
     m_data[series][1][k] = 0;
   }
   m_numberOfPairs[series] = 0;
+  m_aggregates[series] = Aggregates();
+  m_aggregatesAreValid[series] = true;
 }
 
 void DoublePairStore::deleteAllPairs() {
@@ -61,6 +69,7 @@ void DoublePairStore::resetColumn(int series, int i) {
   for (int k = 0; k < m_numberOfPairs[series]; k++) {
     m_data[series][i][k] = defaultValue(series, i, k);
   }
+  m_aggregatesAreValid[series] = false;
 }
 
 bool DoublePairStore::isEmpty() const {
@@ -99,13 +108,21 @@ int DoublePairStore::indexOfKthNonEmptySeries(int k) const {
 }
 
 double DoublePairStore::sumOfColumn(int series, int i) const {
-  assert(series >= 0 && series < k_numberOfSeries);
   assert(i == 0 || i == 1);
-  double result = 0;
-  for (int k = 0; k < m_numberOfPairs[series]; k++) {
-    result += m_data[series][i][k];
-  }
-  return result;
+  return aggregatesOfSeries(series)->sumOfColumns[i];
+}
+
+double DoublePairStore::squaredValueSumOfColumn(int series, int i) const {
+  assert(i == 0 || i == 1);
+  return aggregatesOfSeries(series)->squaredValueSumOfColumns[i];
+}
+
+double DoublePairStore::columnProductSum(int series) const {
+  return aggregatesOfSeries(series)->columnProductSum;
+}
+
+double DoublePairStore::weightedSquaredValueSum(int series) const {
+  return aggregatesOfSeries(series)->weightedSquaredValueSum;
 }
 
 bool DoublePairStore::seriesNumberOfAbscissaeGreaterOrEqualTo(int series, int i) const {
@@ -156,6 +173,30 @@ uint32_t DoublePairStore::storeChecksumForSeries(int series) const {
   return Ion::crc32Word(checkSumPerColumn, k_numberOfColumnsPerSeries);
 }
 
+const DoublePairStore::Aggregates * DoublePairStore::aggregatesOfSeries(int series) const {
+  assert(series >= 0 && series < k_numberOfSeries);
+  if (!m_aggregatesAreValid[series]) {
+    m_aggregates[series] = Aggregates();
+    for (int k = 0; k < m_numberOfPairs[series]; k++) {
+      addPairToAggregates(series, k);
+    }
+    m_aggregatesAreValid[series] = true;
+  }
+  return m_aggregates + series;
+}
+
+void DoublePairStore::addPairToAggregates(int series, int j) const {
+  double x = m_data[series][0][j];
+  double y = m_data[series][1][j];
+  Aggregates * aggregates = m_aggregates + series;
+  aggregates->sumOfColumns[0] += x;
+  aggregates->sumOfColumns[1] += y;
+  aggregates->squaredValueSumOfColumns[0] += x*x;
+  aggregates->squaredValueSumOfColumns[1] += y*y;
+  aggregates->columnProductSum += x*y;
+  aggregates->weightedSquaredValueSum += x*x*y;
+}
+
 double DoublePairStore::defaultValue(int series, int i, int j) const {
   assert(series >= 0 && series < k_numberOfSeries);
   if(i == 0 && j > 1) {
@@ -15,7 +15,9 @@ public:
   constexpr static int k_maxNumberOfPairs = 100;
   DoublePairStore() :
     m_data{},
-    m_numberOfPairs{}
+    m_numberOfPairs{},
+    m_aggregates{},
+    m_aggregatesAreValid{}
   {}
   // Delete the implicit copy constructor: the object is heavy
   DoublePairStore(const DoublePairStore&) = delete;
@@ -38,7 +40,7 @@ public:
   virtual void deletePairOfSeriesAtIndex(int series, int j);
   virtual void deleteAllPairsOfSeries(int series);
   void deleteAllPairs();
-  void resetColumn(int series, int i);
+  virtual void resetColumn(int series, int i);
 
   // Series
   virtual bool isEmpty() const;
@@ -48,6 +50,10 @@ public:
 
   // Calculations
   double sumOfColumn(int series, int i) const;
+  double squaredValueSumOfColumn(int series, int i) const;
+  double columnProductSum(int series) const;
+  // Sum of the squared values of the first column weighted by the second one
+  double weightedSquaredValueSum(int series) const;
   bool seriesNumberOfAbscissaeGreaterOrEqualTo(int series, int i) const;
   uint32_t storeChecksum() const;
   uint32_t storeChecksumForSeries(int series) const;
@@ -65,7 +71,20 @@ protected:
   virtual double defaultValue(int series, int i, int j) const;
   double m_data[k_numberOfSeries][k_numberOfColumnsPerSeries][k_maxNumberOfPairs];
 private:
+  /* The sums over the pairs of each series are memoized. They are updated when
+   * a pair is appended, but computed again after a pair is modified or
+   * deleted: subtracting the former values would accumulate rounding errors. */
+  struct Aggregates {
+    double sumOfColumns[k_numberOfColumnsPerSeries];
+    double squaredValueSumOfColumns[k_numberOfColumnsPerSeries];
+    double columnProductSum;
+    double weightedSquaredValueSum;
+  };
+  const Aggregates * aggregatesOfSeries(int series) const;
+  void addPairToAggregates(int series, int j) const;
   int m_numberOfPairs[k_numberOfSeries];
+  mutable Aggregates m_aggregates[k_numberOfSeries];
+  mutable bool m_aggregatesAreValid[k_numberOfSeries];
 };
 
 }
@@ -1,6 +1,7 @@
 #include "expression_model.h"
 #include "global_context.h"
 #include "poincare_helpers.h"
+#include "reduction_cache.h"
 #include <poincare/horizontal_layout.h>
 #include <poincare/undefined.h>
 #include <string.h>
@@ -46,8 +47,7 @@ Expression ExpressionModel::expressionReduced(const Storage::Record * record, Po
     if (isCircularlyDefined(record, context)) {
       m_expression = Undefined::Builder();
     } else {
-      m_expression = Expression::ExpressionFromAddress(expressionAddress(record), expressionSize(record));
-      PoincareHelpers::Simplify(&m_expression, context, ExpressionNode::ReductionTarget::SystemForApproximation);
+      m_expression = ReductionCache::sharedCache()->simplifiedExpression(expressionAddress(record), expressionSize(record), context, ExpressionNode::ReductionTarget::SystemForApproximation);
       // simplify might return an uninitialized Expression if interrupted
       if (m_expression.isUninitialized()) {
         m_expression = Expression::ExpressionFromAddress(expressionAddress(record), expressionSize(record));
@@ -90,7 +90,7 @@ Ion::Storage::Record::ErrorStatus ExpressionModel::setExpressionContent(Ion::Sto
   size_t newExpressionSize = newExpression.isUninitialized() ? 0 : newExpression.size();
   size_t previousDataSize = newData.size;
   size_t newDataSize = previousDataSize - previousExpressionSize + newExpressionSize;
-  void * expAddress = expressionAddress(record);
+  size_t expressionOffset = (char *)expressionAddress(record) - (char *)newData.buffer;
   // Update size of record to maximal size between previous and new data
   newData.size = maxInt(previousDataSize, newDataSize);
   Ion::Storage::Record::ErrorStatus error = record->setValue(newData);
@@ -98,6 +98,9 @@ Ion::Storage::Record::ErrorStatus ExpressionModel::setExpressionContent(Ion::Sto
     assert(error == Ion::Storage::Record::ErrorStatus::NotEnoughSpaceAvailable);
     return error;
   }
+  // Making room for the record may have compressed and moved the previous ones
+  newData.buffer = record->value().buffer;
+  void * expAddress = (char *)newData.buffer + expressionOffset;
   // Prepare the new data content
   /* WARNING: expressionAddress() cannot be used while the metadata is invalid
    * (as it is sometimes computed from metadata). Thus, the expression address
@@ -58,7 +58,9 @@ KDColor Function::color() const {
 }
 
 void Function::setActive(bool active) {
-  recordData()->setActive(active);
+  RecordDataBuffer data = *recordData();
+  data.setActive(active);
+  setRecordData(data);
 }
 
 int Function::printValue(double cursorT, double cursorX, double cursorY, char * buffer, int bufferSize, int precision, Poincare::Context * context) {
@@ -89,4 +91,11 @@ Function::RecordDataBuffer * Function::recordData() const {
   return reinterpret_cast<RecordDataBuffer *>(const_cast<void *>(d.buffer));
 }
 
+void Function::setRecordData(const RecordDataBuffer & data) {
+  // The metadata are patched in place, without moving the expression
+  Ion::Storage::Record::ErrorStatus error = patchValue(0, &data, sizeof(RecordDataBuffer));
+  assert(error == Ion::Storage::Record::ErrorStatus::None);
+  (void)error;
+}
+
 }
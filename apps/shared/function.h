@@ -84,6 +84,7 @@ protected:
   };
 private:
   RecordDataBuffer * recordData() const;
+  void setRecordData(const RecordDataBuffer & data);
 };
 
 }
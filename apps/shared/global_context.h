@@ -29,6 +29,7 @@ public:
    * Otherwise, we would need the context and the angle unit to evaluate it */
   const Poincare::Expression expressionForSymbolAbstract(const Poincare::SymbolAbstract & symbol, bool clone) override;
   void setExpressionForSymbolAbstract(const Poincare::Expression & expression, const Poincare::SymbolAbstract & symbol) override;
+  bool resolvesSymbolsFromStorage() const override { return true; }
 
 private:
   // Expression getters
@@ -4,6 +4,8 @@
 #include <poincare/preferences.h>
 #include <poincare/print_float.h>
 #include <poincare/expression.h>
+#include <poincare/integral.h>
+#include <cmath>
 
 namespace Shared {
 
@@ -42,6 +44,23 @@ inline T ApproximateToScalar(const Poincare::Expression e, Poincare::Context * c
   return e.approximateToScalar<T>(context, complexFormat, preferences->angleUnit());
 }
 
+template <class T>
+inline T ApproximateWithError(const Poincare::Integral e, Poincare::Context * context, T * absoluteError) {
+  Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
+  Poincare::Preferences::ComplexFormat complexFormat = Poincare::Expression::UpdatedComplexFormatWithExpressionInput(preferences->complexFormat(), e, context);
+  return e.approximateWithError<T>(context, complexFormat, preferences->angleUnit(), absoluteError);
+}
+
+/* The digits of an approximation beyond its estimated error are not
+ * significant. */
+inline int NumberOfSignificantDigitsWithError(double value, double absoluteError, int maxNumberOfSignificantDigits) {
+  if (!(absoluteError > 0.0) || value == 0.0 || !std::isfinite(value)) {
+    return maxNumberOfSignificantDigits;
+  }
+  double numberOfSignificantDigits = std::floor(std::log10(std::fabs(value))) - std::floor(std::log10(absoluteError));
+  return numberOfSignificantDigits < 1.0 ? 1 : (numberOfSignificantDigits > maxNumberOfSignificantDigits ? maxNumberOfSignificantDigits : static_cast<int>(numberOfSignificantDigits));
+}
+
 template <class T>
 inline T ApproximateWithValueForSymbol(const Poincare::Expression e, const char * symbol, T x, Poincare::Context * context) {
   Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
@@ -49,6 +68,13 @@ inline T ApproximateWithValueForSymbol(const Poincare::Expression e, const char
   return e.approximateWithValueForSymbol<T>(symbol, x, context, complexFormat, preferences->angleUnit());
 }
 
+template <class T>
+inline void ApproximateWithValuesForSymbol(const Poincare::Expression e, const char * symbol, const T * xs, T * ys, int numberOfValues, Poincare::Context * context, const Poincare::ApproximationProgram * program = nullptr) {
+  Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
+  Poincare::Preferences::ComplexFormat complexFormat = Poincare::Expression::UpdatedComplexFormatWithExpressionInput(preferences->complexFormat(), e, context);
+  e.approximateWithValuesForSymbol<T>(symbol, xs, ys, numberOfValues, context, complexFormat, preferences->angleUnit(), program);
+}
+
 template <class T>
 inline T ApproximateToScalar(const char * text, Poincare::Context * context, bool symbolicComputation = true) {
   Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
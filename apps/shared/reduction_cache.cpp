@@ -0,0 +1,123 @@
+#include "reduction_cache.h"
+#include "global_context.h"
+#include "poincare_helpers.h"
+#include <ion.h>
+#include <string.h>
+#include <assert.h>
+
+using namespace Poincare;
+
+namespace Shared {
+
+ReductionCache * ReductionCache::sharedCache() {
+  static ReductionCache cache;
+  return &cache;
+}
+
+ReductionCache::ReductionCache() {
+  clear();
+}
+
+Expression ReductionCache::simplifiedExpression(const void * expressionAddress, size_t expressionSize, Context * context, ExpressionNode::ReductionTarget target) {
+  if (!context->resolvesSymbolsFromStorage()) {
+    Expression e = Expression::ExpressionFromAddress(expressionAddress, expressionSize);
+    PoincareHelpers::Simplify(&e, context, target);
+    return e;
+  }
+  Preferences * preferences = Preferences::sharedPreferences();
+  Entry key = {
+    .expressionChecksum = Ion::crc32Byte(static_cast<const uint8_t *>(expressionAddress), expressionSize),
+    .dependenciesChecksum = dependenciesChecksum(),
+    .expressionSize = static_cast<uint16_t>(expressionSize),
+    .reducedExpressionSize = 0,
+    .complexFormat = preferences->complexFormat(),
+    .angleUnit = preferences->angleUnit(),
+    .target = target
+  };
+  int index = indexOfEntry(key);
+  if (index >= 0) {
+    m_numberOfHits++;
+    return Expression::ExpressionFromAddress(m_reducedExpressions[index], m_entries[index].reducedExpressionSize);
+  }
+  m_numberOfMisses++;
+  Expression e = Expression::ExpressionFromAddress(expressionAddress, expressionSize);
+  PoincareHelpers::Simplify(&e, context, target);
+  // Simplifications that were interrupted or that are too large are not kept
+  if (e.isUninitialized() || e.size() > k_maxReducedExpressionSize) {
+    return e;
+  }
+  index = m_nextEntryIndex;
+  m_nextEntryIndex = (m_nextEntryIndex + 1) % k_numberOfEntries;
+  m_entries[index] = key;
+  m_entries[index].reducedExpressionSize = e.size();
+  memcpy(m_reducedExpressions[index], e.addressInPool(), e.size());
+  return e;
+}
+
+void ReductionCache::clear() {
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    m_entries[i].reducedExpressionSize = 0;
+  }
+  m_nextEntryIndex = 0;
+  m_numberOfDependencies = -1;
+  m_numberOfHits = 0;
+  m_numberOfMisses = 0;
+}
+
+uint32_t ReductionCache::dependenciesChecksum() {
+  if (!dependenciesDidChange()) {
+    return m_dependenciesChecksum;
+  }
+  Ion::Storage * storage = Ion::Storage::sharedStorage();
+  uint32_t checksums[2] = {0, 0};
+  int numberOfDependencies = 0;
+  for (int i = 0; i < GlobalContext::k_numberOfExtensions; i++) {
+    int index = 0;
+    Ion::Storage::Record record;
+    while (!(record = storage->recordWithExtensionAtIndex(GlobalContext::k_extensions[i], index++)).isNull()) {
+      checksums[1] = record.checksum();
+      checksums[0] = Ion::crc32Word(checksums, 2);
+      numberOfDependencies++;
+    }
+  }
+  m_dependenciesChecksum = checksums[0];
+  m_dependenciesGeneration = storage->changeGeneration();
+  m_numberOfDependencies = numberOfDependencies;
+  return m_dependenciesChecksum;
+}
+
+bool ReductionCache::dependenciesDidChange() const {
+  if (m_numberOfDependencies < 0) {
+    return true;
+  }
+  Ion::Storage * storage = Ion::Storage::sharedStorage();
+  if (storage->changeGeneration() == m_dependenciesGeneration) {
+    return false;
+  }
+  /* A record renamed out of the dependencies is only noticed by their
+   * number. */
+  int numberOfDependencies = 0;
+  for (int i = 0; i < GlobalContext::k_numberOfExtensions; i++) {
+    int index = 0;
+    Ion::Storage::Record record;
+    while (!(record = storage->recordWithExtensionAtIndex(GlobalContext::k_extensions[i], index++)).isNull()) {
+      if (storage->recordDidChangeSince(record, m_dependenciesGeneration)) {
+        return true;
+      }
+      numberOfDependencies++;
+    }
+  }
+  return numberOfDependencies != m_numberOfDependencies;
+}
+
+int ReductionCache::indexOfEntry(const Entry & key) const {
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    const Entry & entry = m_entries[i];
+    if (entry.reducedExpressionSize > 0 && entry.expressionChecksum == key.expressionChecksum && entry.dependenciesChecksum == key.dependenciesChecksum && entry.expressionSize == key.expressionSize && entry.complexFormat == key.complexFormat && entry.angleUnit == key.angleUnit && entry.target == key.target) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+}
@@ -0,0 +1,62 @@
+#ifndef SHARED_REDUCTION_CACHE_H
+#define SHARED_REDUCTION_CACHE_H
+
+#include <poincare/context.h>
+#include <poincare/expression.h>
+#include <poincare/preferences.h>
+#include <stdint.h>
+
+namespace Shared {
+
+/* ReductionCache memoizes the reduced forms of the expressions stored in
+ * records, so that models whose memoized expression is tidied (when leaving
+ * an app or when the storage changes) do not simplify them again.
+ *
+ * An entry is keyed by the checksum of the expression tree, the reduction
+ * parameters and the checksum of the records a symbol may refer to, that is
+ * the expression and function records of the GlobalContext. The cache is thus
+ * only valid for contexts resolving symbols from these records, and other
+ * contexts, which may define symbols of their own, bypass it. Reduced
+ * expressions are kept as dumps of their tree, out of the TreePool, as in the
+ * records. The checksum of the records is only computed again once the change
+ * journal of the storage reports that one of them changed. */
+
+class ReductionCache {
+public:
+  static ReductionCache * sharedCache();
+  ReductionCache();
+  /* Returns the simplification of the expression tree dumped at
+   * expressionAddress, which is uninitialized if the simplification was
+   * interrupted. */
+  Poincare::Expression simplifiedExpression(const void * expressionAddress, size_t expressionSize, Poincare::Context * context, Poincare::ExpressionNode::ReductionTarget target);
+  void clear();
+  int numberOfHits() const { return m_numberOfHits; }
+  int numberOfMisses() const { return m_numberOfMisses; }
+private:
+  constexpr static int k_numberOfEntries = 8;
+  constexpr static size_t k_maxReducedExpressionSize = 384;
+  struct Entry {
+    uint32_t expressionChecksum;
+    uint32_t dependenciesChecksum;
+    uint16_t expressionSize;
+    uint16_t reducedExpressionSize; // 0 if the entry is empty
+    Poincare::Preferences::ComplexFormat complexFormat;
+    Poincare::Preferences::AngleUnit angleUnit;
+    Poincare::ExpressionNode::ReductionTarget target;
+  };
+  uint32_t dependenciesChecksum();
+  bool dependenciesDidChange() const;
+  int indexOfEntry(const Entry & key) const;
+  Entry m_entries[k_numberOfEntries];
+  char m_reducedExpressions[k_numberOfEntries][k_maxReducedExpressionSize];
+  int m_nextEntryIndex;
+  uint32_t m_dependenciesChecksum;
+  uint32_t m_dependenciesGeneration;
+  int m_numberOfDependencies; // -1 if the checksum was not computed
+  int m_numberOfHits;
+  int m_numberOfMisses;
+};
+
+}
+
+#endif
@@ -135,6 +135,7 @@ void SumGraphController::reloadBannerView() {
   m_legendView.setLegendMessage(legendMessageAtStep(m_step), m_step);
   double endSum = NAN;
   double result;
+  int numberOfSignificantDigits = Preferences::LargeNumberOfSignificantDigits;
   Poincare::Layout functionLayout;
   if (m_step == Step::Result) {
     endSum = m_cursor->x();
@@ -143,13 +144,20 @@ void SumGraphController::reloadBannerView() {
     ExpiringPointer<Function> function = myApp->functionStore()->modelForRecord(m_record);
     Poincare::Context * context = myApp->localContext();
     Poincare::Expression sum = function->sumBetweenBounds(m_startSum, endSum, context);
-    result = PoincareHelpers::ApproximateToScalar<double>(sum, context);
+    if (sum.type() == ExpressionNode::Type::Integral) {
+      // Only the digits left by the estimated error of the integral are shown
+      double absoluteError;
+      result = PoincareHelpers::ApproximateWithError<double>(static_cast<Integral &>(sum), context, &absoluteError);
+      numberOfSignificantDigits = PoincareHelpers::NumberOfSignificantDigitsWithError(result, absoluteError, numberOfSignificantDigits);
+    } else {
+      result = PoincareHelpers::ApproximateToScalar<double>(sum, context);
+    }
     functionLayout = createFunctionLayout(function);
   } else {
     m_legendView.setEditableZone(m_cursor->x());
     result = NAN;
   }
-  m_legendView.setSumSymbol(m_step, m_startSum, endSum, result, functionLayout);
+  m_legendView.setSumSymbol(m_step, m_startSum, endSum, result, numberOfSignificantDigits, functionLayout);
 }
 
 /* Legend View */
@@ -185,7 +193,7 @@ void SumGraphController::LegendView::setEditableZone(double d) {
   m_editableZone.setText(buffer);
 }
 
-void SumGraphController::LegendView::setSumSymbol(Step step, double start, double end, double result, Layout functionLayout) {
+void SumGraphController::LegendView::setSumSymbol(Step step, double start, double end, double result, int numberOfSignificantDigits, Layout functionLayout) {
   assert(step == Step::Result || functionLayout.isUninitialized());
   constexpr int sigmaLength = 2;
   const CodePoint sigma[sigmaLength] = {' ', m_sumSymbol};
@@ -214,7 +222,7 @@ void SumGraphController::LegendView::setSumSymbol(Step step, double start, doubl
         start,
         end);
     strlcpy(buffer, "= ", 3);
-    PoincareHelpers::ConvertFloatToText<double>(result, buffer+2, bufferSize-2, precision);
+    PoincareHelpers::ConvertFloatToText<double>(result, buffer+2, bufferSize-2, numberOfSignificantDigits);
     m_sumLayout = HorizontalLayout::Builder(
         m_sumLayout,
         functionLayout,
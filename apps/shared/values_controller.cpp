@@ -302,6 +302,12 @@ void ValuesController::resetMemoization() {
   m_firstMemoizedRow = INT_MAX;
 }
 
+void ValuesController::fillMemoizedBuffersOfColumn(int i, const int * rows, const int * indexes, int numberOfCells) {
+  for (int k = 0; k < numberOfCells; k++) {
+    fillMemoizedBuffer(i, rows[k], indexes[k]);
+  }
+}
+
 char * ValuesController::memoizedBufferForCell(int i, int j) {
   const int nbOfMemoizedColumns = numberOfMemoizedColumn();
   // Conversion of coordinates from absolute table to values table
@@ -339,14 +345,20 @@ char * ValuesController::memoizedBufferForCell(int i, int j) {
     int maxI = numberOfValuesColumns() - m_firstMemoizedColumn;
     for (int ii = 0; ii < minInt(nbOfMemoizedColumns, maxI); ii++) {
       int maxJ = numberOfElementsInColumn(absoluteColumnForValuesColumn(ii+m_firstMemoizedColumn)) - m_firstMemoizedRow;
+      int rows[k_maxNumberOfDisplayableRows];
+      int indexes[k_maxNumberOfDisplayableRows];
+      int numberOfCells = 0;
       for (int jj = 0; jj < minInt(k_maxNumberOfDisplayableRows, maxJ); jj++) {
         // Escape if already filled
         if (ii >= -offsetI && ii < -offsetI + nbOfMemoizedColumns && jj >= -offsetJ && jj < -offsetJ + k_maxNumberOfDisplayableRows) {
           continue;
         }
-        fillMemoizedBuffer(absoluteColumnForValuesColumn(m_firstMemoizedColumn + ii),
-            absoluteRowForValuesRow(m_firstMemoizedRow + jj),
-            jj * nbOfMemoizedColumns + ii);
+        rows[numberOfCells] = absoluteRowForValuesRow(m_firstMemoizedRow + jj);
+        indexes[numberOfCells] = jj * nbOfMemoizedColumns + ii;
+        numberOfCells++;
+      }
+      if (numberOfCells > 0) {
+        fillMemoizedBuffersOfColumn(absoluteColumnForValuesColumn(m_firstMemoizedColumn + ii), rows, indexes, numberOfCells);
       }
     }
   }
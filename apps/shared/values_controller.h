@@ -111,6 +111,9 @@ private:
   // Coordinates of fillMemoizedBuffer refer to the absolute table but the index
   // refers to the memoized table
   virtual void fillMemoizedBuffer(int i, int j, int index) = 0;
+  /* Fills the buffers of numberOfCells cells of column i at once, so that the
+   * values of a column can be computed in a batch. */
+  virtual void fillMemoizedBuffersOfColumn(int i, const int * rows, const int * indexes, int numberOfCells);
   /* m_firstMemoizedColumn and m_firstMemoizedRow are coordinates of the table
    * of values cells.*/
   virtual int numberOfColumnsForAbscissaColumn(int column) { assert(column == 0); return numberOfColumns(); }
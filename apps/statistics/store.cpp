@@ -2,7 +2,6 @@
 #include <assert.h>
 #include <float.h>
 #include <cmath>
-#include <string.h>
 #include <ion.h>
 
 using namespace Shared;
@@ -17,7 +16,8 @@ Store::Store() :
   m_barWidth(1.0),
   m_firstDrawnBarAbscissa(0.0),
   m_seriesEmpty{true, true, true},
-  m_numberOfNonEmptySeries(0)
+  m_numberOfNonEmptySeries(0),
+  m_sortedIndexIsValid{false, false, false}
 {
 }
 
@@ -124,25 +124,27 @@ double Store::minValueForAllSeries() const {
 }
 
 double Store::maxValue(int series) const {
-  double max = -DBL_MAX;
   int numberOfPairs = numberOfPairsOfSeries(series);
-  for (int k = 0; k < numberOfPairs; k++) {
-    if (m_data[series][0][k] > max && m_data[series][1][k] > 0) {
-      max = m_data[series][0][k];
-    }
+  if (numberOfPairs == 0) {
+    return -DBL_MAX;
+  }
+  buildSortedIndexIfNeeded(series);
+  double total = m_cumulatedOccurrences[series][numberOfPairs-1];
+  if (total <= 0.0) {
+    return -DBL_MAX;
   }
-  return max;
+  // The last value of non-null frequency completes the occurrences
+  return valueAtSortedPosition(series, sortedPositionOfCumulatedOccurrences(series, total, false));
 }
 
 double Store::minValue(int series) const {
-  double min = DBL_MAX;
   int numberOfPairs = numberOfPairsOfSeries(series);
-  for (int k = 0; k < numberOfPairs; k++) {
-    if (m_data[series][0][k] < min && m_data[series][1][k] > 0) {
-      min = m_data[series][0][k];
-    }
+  if (numberOfPairs == 0) {
+    return DBL_MAX;
   }
-  return min;
+  buildSortedIndexIfNeeded(series);
+  int position = sortedPositionOfCumulatedOccurrences(series, 0.0, true);
+  return position < numberOfPairs ? valueAtSortedPosition(series, position) : DBL_MAX;
 }
 
 double Store::range(int series) const {
@@ -185,41 +187,41 @@ double Store::median(int series) const {
 }
 
 double Store::sum(int series) const {
-  double result = 0;
-  int numberOfPairs = numberOfPairsOfSeries(series);
-  for (int k = 0; k < numberOfPairs; k++) {
-    result += m_data[series][0][k]*m_data[series][1][k];
-  }
-  return result;
+  return columnProductSum(series);
 }
 
 double Store::squaredValueSum(int series) const {
-  double result = 0;
-  int numberOfPairs = numberOfPairsOfSeries(series);
-  for (int k = 0; k < numberOfPairs; k++) {
-    result += m_data[series][0][k]*m_data[series][0][k]*m_data[series][1][k];
-  }
-  return result;
+  return weightedSquaredValueSum(series);
 }
 
 void Store::set(double f, int series, int i, int j) {
   DoublePairStore::set(f, series, i, j);
+  invalidateSortedIndex(series);
   m_seriesEmpty[series] = sumOfOccurrences(series) == 0;
   updateNonEmptySeriesCount();
 }
 
 void Store::deletePairOfSeriesAtIndex(int series, int j) {
   DoublePairStore::deletePairOfSeriesAtIndex(series, j);
+  invalidateSortedIndex(series);
   m_seriesEmpty[series] = sumOfOccurrences(series) == 0;
   updateNonEmptySeriesCount();
 }
 
 void Store::deleteAllPairsOfSeries(int series) {
   DoublePairStore::deleteAllPairsOfSeries(series);
+  invalidateSortedIndex(series);
   m_seriesEmpty[series] = true;
   updateNonEmptySeriesCount();
 }
 
+void Store::resetColumn(int series, int i) {
+  DoublePairStore::resetColumn(series, i);
+  invalidateSortedIndex(series);
+  m_seriesEmpty[series] = sumOfOccurrences(series) == 0;
+  updateNonEmptySeriesCount();
+}
+
 void Store::updateNonEmptySeriesCount() {
   int nonEmptySeriesCount = 0;
   for (int i = 0; i< k_numberOfSeries; i++) {
@@ -237,57 +239,126 @@ double Store::defaultValue(int series, int i, int j) const {
 }
 
 double Store::sumOfValuesBetween(int series, double x1, double x2) const {
-  double result = 0;
   int numberOfPairs = numberOfPairsOfSeries(series);
-  for (int k = 0; k < numberOfPairs; k++) {
-    if (m_data[series][0][k] < x2 && x1 <= m_data[series][0][k]) {
-      result += m_data[series][1][k];
-    }
+  if (numberOfPairs == 0 || !(x1 < x2)) {
+    return 0.0;
   }
-  return result;
+  buildSortedIndexIfNeeded(series);
+  int firstPosition = sortedPositionOfValue(series, x1);
+  int endPosition = sortedPositionOfValue(series, x2);
+  if (firstPosition >= endPosition) {
+    return 0.0;
+  }
+  double previousOccurrences = firstPosition > 0 ? m_cumulatedOccurrences[series][firstPosition-1] : 0.0;
+  return m_cumulatedOccurrences[series][endPosition-1] - previousOccurrences;
 }
 
 double Store::sortedElementAtCumulatedFrequency(int series, double k, bool createMiddleElement) const {
-  // TODO: use an other algorithm (ex quickselect) to avoid quadratic complexity
   assert(k >= 0.0 && k <= 1.0);
-  double totalNumberOfElements = sumOfOccurrences(series);
-  double numberOfElementsAtFrequencyK = totalNumberOfElements * k;
   int numberOfPairs = numberOfPairsOfSeries(series);
-  double bufferValues[numberOfPairs];
-  memcpy(bufferValues, m_data[series][0], numberOfPairs*sizeof(double));
-  int sortedElementIndex = 0;
-  double cumulatedNumberOfElements = 0.0;
-  while (cumulatedNumberOfElements < numberOfElementsAtFrequencyK-DBL_EPSILON) {
-    sortedElementIndex = minIndex(bufferValues, numberOfPairs);
-    bufferValues[sortedElementIndex] = DBL_MAX;
-    cumulatedNumberOfElements += m_data[series][1][sortedElementIndex];
+  if (numberOfPairs == 0) {
+    return NAN;
+  }
+  buildSortedIndexIfNeeded(series);
+  double numberOfElementsAtFrequencyK = m_cumulatedOccurrences[series][numberOfPairs-1] * k;
+  int sortedPosition = sortedPositionOfCumulatedOccurrences(series, numberOfElementsAtFrequencyK-DBL_EPSILON, false);
+  if (sortedPosition == numberOfPairs) {
+    sortedPosition = numberOfPairs - 1;
   }
 
-  if (createMiddleElement && std::fabs(cumulatedNumberOfElements - numberOfElementsAtFrequencyK) < DBL_EPSILON) {
+  if (createMiddleElement && std::fabs(m_cumulatedOccurrences[series][sortedPosition] - numberOfElementsAtFrequencyK) < DBL_EPSILON) {
     /* There is an element of cumulated frequency k, so the result is the mean
      * between this element and the next element (in terms of cumulated
      * frequency) that has a non-null frequency. */
-    int nextElementIndex = minIndex(bufferValues, numberOfPairs);
-    while (m_data[series][1][nextElementIndex] == 0 && bufferValues[nextElementIndex] != DBL_MAX) {
-      bufferValues[nextElementIndex] = DBL_MAX;
-      nextElementIndex = minIndex(bufferValues, numberOfPairs);
-    }
-    if (bufferValues[nextElementIndex] != DBL_MAX) {
-      return (m_data[series][0][sortedElementIndex] + m_data[series][0][nextElementIndex]) / 2.0;
+    int nextPosition = sortedPositionOfCumulatedOccurrences(series, m_cumulatedOccurrences[series][sortedPosition], true);
+    if (nextPosition < numberOfPairs) {
+      return (valueAtSortedPosition(series, sortedPosition) + valueAtSortedPosition(series, nextPosition)) / 2.0;
     }
   }
 
-  return m_data[series][0][sortedElementIndex];
+  return valueAtSortedPosition(series, sortedPosition);
+}
+
+/* Pairs are ordered by value, then by index so that the order of equal values
+ * does not depend on the sorting algorithm. */
+static bool IsSortedBefore(const double * values, uint16_t index1, uint16_t index2) {
+  return values[index1] < values[index2] || (values[index1] == values[index2] && index1 < index2);
+}
+
+static void SiftDown(const double * values, uint16_t * indices, int root, int length) {
+  while (2*root + 1 < length) {
+    int child = 2*root + 1;
+    if (child + 1 < length && IsSortedBefore(values, indices[child], indices[child+1])) {
+      child++;
+    }
+    if (!IsSortedBefore(values, indices[root], indices[child])) {
+      return;
+    }
+    uint16_t swap = indices[root];
+    indices[root] = indices[child];
+    indices[child] = swap;
+    root = child;
+  }
 }
 
-int Store::minIndex(double * bufferValues, int bufferLength) const {
-  int index = 0;
-  for (int i = 1; i < bufferLength; i++) {
-    if (bufferValues[index] > bufferValues[i]) {
-      index = i;
+void Store::buildSortedIndexIfNeeded(int series) const {
+  if (m_sortedIndexIsValid[series]) {
+    return;
+  }
+  int numberOfPairs = numberOfPairsOfSeries(series);
+  const double * values = m_data[series][0];
+  uint16_t * indices = m_sortedIndex[series];
+  for (int k = 0; k < numberOfPairs; k++) {
+    indices[k] = k;
+  }
+  // Heap sort, which needs no additional memory
+  for (int k = numberOfPairs/2 - 1; k >= 0; k--) {
+    SiftDown(values, indices, k, numberOfPairs);
+  }
+  for (int k = numberOfPairs - 1; k > 0; k--) {
+    uint16_t swap = indices[0];
+    indices[0] = indices[k];
+    indices[k] = swap;
+    SiftDown(values, indices, 0, k);
+  }
+  double cumulatedOccurrences = 0.0;
+  for (int k = 0; k < numberOfPairs; k++) {
+    cumulatedOccurrences += m_data[series][1][indices[k]];
+    m_cumulatedOccurrences[series][k] = cumulatedOccurrences;
+  }
+  m_sortedIndexIsValid[series] = true;
+}
+
+int Store::sortedPositionOfValue(int series, double x) const {
+  assert(m_sortedIndexIsValid[series]);
+  int lower = 0;
+  int upper = numberOfPairsOfSeries(series);
+  while (lower < upper) {
+    int middle = (lower + upper) / 2;
+    if (valueAtSortedPosition(series, middle) < x) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
+  return lower;
+}
+
+int Store::sortedPositionOfCumulatedOccurrences(int series, double c, bool strict) const {
+  assert(m_sortedIndexIsValid[series]);
+  // Frequencies are non-negative, so the cumulated occurrences are increasing
+  const double * cumulatedOccurrences = m_cumulatedOccurrences[series];
+  int lower = 0;
+  int upper = numberOfPairsOfSeries(series);
+  while (lower < upper) {
+    int middle = (lower + upper) / 2;
+    if (cumulatedOccurrences[middle] < c || (strict && cumulatedOccurrences[middle] == c)) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
     }
   }
-  return index;
+  return lower;
 }
 
 }
@@ -53,6 +53,7 @@ public:
   void set(double f, int series, int i, int j) override;
   void deletePairOfSeriesAtIndex(int series, int j) override;
   void deleteAllPairsOfSeries(int series) override;
+  void resetColumn(int series, int i) override;
 
   void updateNonEmptySeriesCount();
 
@@ -60,12 +61,28 @@ private:
   double defaultValue(int series, int i, int j) const override;
   double sumOfValuesBetween(int series, double x1, double x2) const;
   double sortedElementAtCumulatedFrequency(int series, double k, bool createMiddleElement = false) const;
-  int minIndex(double * bufferValues, int bufferLength) const;
+  /* The sorted index of a series lists the indices of its pairs by increasing
+   * value, along with the cumulated occurrences of the sorted pairs. It is
+   * built when first needed and invalidated whenever the series changes, so
+   * that order statistics and bar heights are found by binary search. */
+  void invalidateSortedIndex(int series) { m_sortedIndexIsValid[series] = false; }
+  void buildSortedIndexIfNeeded(int series) const;
+  double valueAtSortedPosition(int series, int position) const { return m_data[series][0][m_sortedIndex[series][position]]; }
+  // First position whose value is greater than or equal to x
+  int sortedPositionOfValue(int series, double x) const;
+  /* First position whose cumulated occurrences are greater than (or equal to,
+   * if not strict) c. */
+  int sortedPositionOfCumulatedOccurrences(int series, double c, bool strict) const;
   // Histogram bars
   double m_barWidth;
   double m_firstDrawnBarAbscissa;
   bool m_seriesEmpty[k_numberOfSeries];
   int m_numberOfNonEmptySeries;
+  // Sorted index
+  static_assert(k_maxNumberOfPairs <= UINT16_MAX, "Sorted indices do not fit in uint16_t");
+  mutable uint16_t m_sortedIndex[k_numberOfSeries][k_maxNumberOfPairs];
+  mutable double m_cumulatedOccurrences[k_numberOfSeries][k_maxNumberOfPairs];
+  mutable bool m_sortedIndexIsValid[k_numberOfSeries];
 };
 
 typedef double (Store::*CalculPointer)(int) const;
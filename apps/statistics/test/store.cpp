@@ -244,4 +244,61 @@ QUIZ_CASE(data_statistics) {
       /* squaredValueSum */ 20.0);
 }
 
+QUIZ_CASE(data_statistics_after_edition) {
+  Store store;
+  int seriesIndex = 0;
+  double values[] = {5.0, 1.0, 4.0, 2.0, 3.0};
+  for (int i = 0; i < 5; i++) {
+    store.set(values[i], seriesIndex, 0, i);
+    store.set(1.0, seriesIndex, 1, i);
+  }
+  assert_value_approximately_equal_to(store.median(seriesIndex), 3.0);
+  assert_value_approximately_equal_to(store.heightOfBarAtIndex(seriesIndex, 0), 1.0);
+
+  // Values and frequencies changed after a computation are taken into account
+  store.set(0.5, seriesIndex, 0, 0);
+  store.set(3.0, seriesIndex, 1, 1);
+  assert_value_approximately_equal_to(store.minValue(seriesIndex), 0.5);
+  assert_value_approximately_equal_to(store.maxValue(seriesIndex), 4.0);
+  assert_value_approximately_equal_to(store.median(seriesIndex), 1.0);
+  assert_value_approximately_equal_to(store.heightOfBarAtValue(seriesIndex, 1.0), 3.0);
+
+  store.deletePairOfSeriesAtIndex(seriesIndex, 1);
+  assert_value_approximately_equal_to(store.firstQuartile(seriesIndex), 0.5);
+  assert_value_approximately_equal_to(store.median(seriesIndex), 2.5);
+  assert_value_approximately_equal_to(store.thirdQuartile(seriesIndex), 3.0);
+  assert_value_approximately_equal_to(store.heightOfBarAtValue(seriesIndex, 1.0), 0.0);
+
+  store.resetColumn(seriesIndex, 1);
+  store.set(0.0, seriesIndex, 1, 3);
+  assert_value_approximately_equal_to(store.maxValue(seriesIndex), 4.0);
+  assert_value_approximately_equal_to(store.median(seriesIndex), 2.0);
+}
+
+QUIZ_CASE(data_statistics_memoized_sums) {
+  Store store;
+  int seriesIndex = 1;
+  double values[] = {1.0, 2.5, -15.0, 0.4};
+  double occurrences[] = {2.0, 1.0, 0.5, 10.0};
+  for (int j = 0; j < 4; j++) {
+    store.set(values[j], seriesIndex, 0, j);
+    store.set(occurrences[j], seriesIndex, 1, j);
+  }
+  quiz_assert(store.numberOfPairsOfSeries(seriesIndex) == 4);
+  assert_value_approximately_equal_to(store.sumOfOccurrences(seriesIndex), 13.5);
+  assert_value_approximately_equal_to(store.sum(seriesIndex), 1.0*2.0 + 2.5 - 15.0*0.5 + 0.4*10.0);
+  assert_value_approximately_equal_to(store.squaredValueSum(seriesIndex), 1.0*2.0 + 2.5*2.5 + 225.0*0.5 + 0.16*10.0);
+
+  // Sums are updated when a pair is appended
+  store.set(3.0, seriesIndex, 0, 4);
+  assert_value_approximately_equal_to(store.sumOfOccurrences(seriesIndex), 14.5);
+  assert_value_approximately_equal_to(store.sum(seriesIndex), 1.0*2.0 + 2.5 - 15.0*0.5 + 0.4*10.0 + 3.0);
+
+  // Sums are computed again once a pair is modified
+  store.set(2.0, seriesIndex, 1, 3);
+  assert_value_approximately_equal_to(store.sumOfOccurrences(seriesIndex), 6.5);
+  store.deletePairOfSeriesAtIndex(seriesIndex, 2);
+  assert_value_approximately_equal_to(store.sum(seriesIndex), 1.0*2.0 + 2.5 + 0.4*2.0 + 3.0);
+}
+
 }
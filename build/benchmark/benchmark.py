@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+# Replays the scenarios of build/benchmark/scenarios on a headless simulator
+# built with ION_PROFILING=1 and compares their profile with a baseline.
+#
+# A scenario is a text file listing events by name, as in
+# ion/include/ion/keyboard/layout_B2/layout_events.h. "Name*N" repeats an
+# event N times, a double-quoted string types its characters one by one, and
+# everything after a '#' is a comment.
+#
+# The baseline holds the best of several runs of each scenario on the machine
+# it was recorded on: times are only comparable on that machine, while the
+# counters do not depend on it. Record it again with "make benchmark_baseline"
+# on the machine that runs "make benchmark", from a commit known to be good,
+# and whenever a change is expected to alter the counters. Lines of the
+# baseline starting with '#' are comments, and the recording machine is noted
+# in them.
+#
+# Usage:
+#   benchmark.py run BINARY SCENARIOS_DIR BASELINE [--update] [--runs N]
+#       [--time-tolerance T] [--time-margin US] [--counter-tolerance C]
+#   benchmark.py compile SCENARIO > scenario.esc
+
+import argparse
+import csv
+import io
+import os
+import platform
+import re
+import subprocess
+import sys
+
+LAYOUT_EVENTS = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'ion', 'include', 'ion', 'keyboard', 'layout_B2', 'layout_events.h')
+
+TIME_METRICS = ['dispatch_us', 'layout_us', 'draw_rect_us', 'push_rect_us', 'decompress_us', 'total_us']
+COUNTER_METRICS = ['events', 'pushed_pixels', 'tree_pool_peak_bytes', 'reductions']
+METRICS = TIME_METRICS + COUNTER_METRICS
+
+# Characters typed with a key of another text, like '*' in the Python editor
+CHARACTER_ALIASES = {'*': 'Multiplication'}
+
+def table_entries(source, table_name):
+  start = source.index(table_name)
+  table = source[source.index('{', start) + 1:source.index('};', start)]
+  table = re.sub(r'//[^\n]*', '', table)
+  return re.findall(r'T\("((?:[^"\\]|\\.)*)"\)|TL\(\)|U\(\)|"(\w+)"|nullptr', table)
+
+def event_tables():
+  source = open(LAYOUT_EVENTS, encoding='utf-8').read()
+  ids = {}
+  for i, (_, name) in enumerate(table_entries(source, 's_nameForEvent')):
+    if name:
+      ids[name] = i
+  characters = {}
+  for i, (text, _) in enumerate(table_entries(source, 's_dataForEvent')):
+    if len(text) == 1 and text not in characters:
+      characters[text] = i
+  for character, name in CHARACTER_ALIASES.items():
+    characters[character] = ids[name]
+  return ids, characters
+
+def compile_scenario(path):
+  ids, characters = event_tables()
+  events = bytearray()
+  text = open(path, encoding='utf-8').read()
+  text = '\n'.join(line.split('#')[0] for line in text.split('\n'))
+  for token in re.findall(r'"[^"]*"|\S+', text):
+    if token.startswith('"'):
+      for character in token[1:-1]:
+        if character not in characters:
+          sys.exit('%s: no event types "%s"' % (path, character))
+        events.append(characters[character])
+      continue
+    name, _, repetitions = token.partition('*')
+    if name not in ids:
+      sys.exit('%s: unknown event "%s"' % (path, name))
+    events.extend([ids[name]] * int(repetitions or 1))
+  return bytes(events)
+
+def profile(binary, events):
+  result = subprocess.run([binary], input=events, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+  lines = result.stdout.decode('utf-8', 'replace').splitlines()
+  csv_lines = [line for line in lines if line.startswith('scenario,') or line.startswith('stdin,')]
+  if result.returncode != 0 or not csv_lines:
+    return None
+  totals = dict.fromkeys(METRICS, 0)
+  for row in csv.DictReader(io.StringIO('\n'.join(csv_lines))):
+    totals['events'] += 1
+    for metric in TIME_METRICS[:-1] + ['pushed_pixels', 'reductions']:
+      totals[metric] += int(row[metric])
+    totals['tree_pool_peak_bytes'] = max(totals['tree_pool_peak_bytes'], int(row['tree_pool_peak_bytes']))
+  totals['total_us'] = sum(totals[metric] for metric in TIME_METRICS[:-1])
+  return totals
+
+def best_profile(binary, events, runs):
+  # Keep the fastest run, the counters being the same for every run
+  best = None
+  for _ in range(runs):
+    totals = profile(binary, events)
+    if totals is None:
+      return None
+    if best is None or totals['total_us'] < best['total_us']:
+      best = totals
+  return best
+
+def read_baseline(path):
+  if not os.path.exists(path):
+    return {}
+  with open(path, newline='') as f:
+    rows = csv.DictReader(line for line in f if not line.startswith('#'))
+    return {row['scenario']: {metric: int(row[metric]) for metric in METRICS} for row in rows}
+
+def machine_description():
+  try:
+    with open('/proc/cpuinfo') as f:
+      for line in f:
+        if line.startswith('model name'):
+          return '%s, %s' % (line.split(':', 1)[1].strip(), platform.system())
+  except OSError:
+    pass
+  return '%s, %s' % (platform.machine(), platform.system())
+
+def write_baseline(path, profiles):
+  with open(path, 'w', newline='') as f:
+    f.write('# Recorded by "make benchmark_baseline" on %s\n' % machine_description())
+    f.write('# Times depend on the machine: record the baseline again on the machine running "make benchmark"\n')
+    writer = csv.writer(f, lineterminator='\n')
+    writer.writerow(['scenario'] + METRICS)
+    for scenario in sorted(profiles):
+      writer.writerow([scenario] + [profiles[scenario][metric] for metric in METRICS])
+
+def regressions(current, baseline, args):
+  result = []
+  for metric in METRICS:
+    if metric in TIME_METRICS:
+      limit = baseline[metric] * (1 + args.time_tolerance) + args.time_margin
+    else:
+      limit = baseline[metric] * (1 + args.counter_tolerance)
+    if current[metric] > limit:
+      result.append('%s %d -> %d' % (metric, baseline[metric], current[metric]))
+  return result
+
+def run(args):
+  baseline = read_baseline(args.baseline)
+  profiles = {}
+  failed = False
+  for file_name in sorted(os.listdir(args.scenarios)):
+    if not file_name.endswith('.txt'):
+      continue
+    scenario = file_name[:-len('.txt')]
+    totals = best_profile(args.binary, compile_scenario(os.path.join(args.scenarios, file_name)), args.runs)
+    if totals is None:
+      print('CRASH   %s' % scenario)
+      failed = True
+      continue
+    profiles[scenario] = totals
+    if args.update:
+      print('RECORD  %s %d us' % (scenario, totals['total_us']))
+    elif scenario not in baseline:
+      print('MISSING %s has no baseline' % scenario)
+      failed = True
+    else:
+      scenario_regressions = regressions(totals, baseline[scenario], args)
+      print('%s %s %d us (baseline %d us)' % ('SLOWER ' if scenario_regressions else 'OK     ', scenario, totals['total_us'], baseline[scenario]['total_us']))
+      for regression in scenario_regressions:
+        print('          %s' % regression)
+      failed = failed or len(scenario_regressions) > 0
+  if args.update and not failed:
+    write_baseline(args.baseline, profiles)
+  return 1 if failed else 0
+
+def main():
+  parser = argparse.ArgumentParser(description='Scenario-based performance regression suite')
+  subparsers = parser.add_subparsers(dest='command')
+  run_parser = subparsers.add_parser('run', help='replay the scenarios and compare them with the baseline')
+  run_parser.add_argument('binary', help='headless simulator built with ION_PROFILING=1')
+  run_parser.add_argument('scenarios', help='directory of the scenarios')
+  run_parser.add_argument('baseline', help='CSV file of the baseline')
+  run_parser.add_argument('--update', action='store_true', help='record the baseline instead of comparing with it')
+  run_parser.add_argument('--runs', type=int, default=3, help='number of runs of each scenario, the fastest being kept')
+  run_parser.add_argument('--time-tolerance', type=float, default=0.25, help='relative increase of a time allowed')
+  run_parser.add_argument('--time-margin', type=int, default=2000, help='increase of a time allowed in microseconds')
+  run_parser.add_argument('--counter-tolerance', type=float, default=0.0, help='relative increase of a counter allowed')
+  compile_parser = subparsers.add_parser('compile', help='print the events of a scenario, as read by the headless simulator')
+  compile_parser.add_argument('scenario')
+  args = parser.parse_args()
+  if args.command == 'run':
+    return run(args)
+  if args.command == 'compile':
+    sys.stdout.buffer.write(compile_scenario(args.scenario))
+    return 0
+  parser.print_help()
+  return 1
+
+if __name__ == '__main__':
+  sys.exit(main())
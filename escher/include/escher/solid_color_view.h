@@ -9,6 +9,7 @@ public:
   void reload();
   virtual void setColor(KDColor color);
   void drawRect(KDContext * ctx, KDRect rect) const override;
+  bool isOpaque() const override { return true; }
 protected:
 #if ESCHER_VIEW_LOGGING
   const char * className() const override;
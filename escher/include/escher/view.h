@@ -50,6 +50,10 @@ public:
    * typical drawRect implementation, a subclass will make drawing calls to the
    * Kandinsky library using the provided context. */
   virtual void drawRect(KDContext * ctx, KDRect rect) const;
+  /* A view is opaque if its drawRect paints every pixel of the rect it is
+   * given. The drawing of a superview is skipped where it is fully covered by
+   * an opaque subview. Views are not opaque by default. */
+  virtual bool isOpaque() const { return false; }
 
   void setSize(KDSize size);
   void setFrame(KDRect frame);
@@ -89,6 +93,7 @@ private:
   virtual void layoutSubviews();
   virtual const Window * window() const;
   KDRect redraw(KDRect rect, KDRect forceRedrawRect = KDRectZero);
+  bool isCoveredByOpaqueSubview(KDRect rect);
   KDPoint absoluteOrigin() const;
   KDRect absoluteVisibleFrame() const;
 
@@ -5,8 +5,9 @@
 
 class Window : public View {
 public:
-  Window() : m_contentView(nullptr) {}
+  Window() : m_contentView(nullptr), m_numberOfPixelsPushedByLastRedraw(0) {}
   void redraw(bool force = false);
+  uint32_t numberOfPixelsPushedByLastRedraw() const { return m_numberOfPixelsPushedByLastRedraw; }
   void setContentView(View * contentView);
 protected:
 #if ESCHER_VIEW_LOGGING
@@ -18,6 +19,7 @@ protected:
   View * m_contentView;
 private:
   const Window * window() const override;
+  uint32_t m_numberOfPixelsPushedByLastRedraw;
 };
 
 #endif
@@ -1,4 +1,5 @@
 #include <escher/run_loop.h>
+#include <ion/profiling.h>
 #include <assert.h>
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
@@ -50,6 +51,7 @@ bool RunLoop::step() {
     for (int i=0; i<numberOfTimers(); i++) {
       Timer * timer = timerAtIndex(i);
       if (timer->tick()) {
+        Ion::Profiling::SectionScope dispatchScope(Ion::Profiling::Section::EventDispatch);
         dispatchEvent(Ion::Events::TimerFire);
       }
     }
@@ -67,6 +69,7 @@ bool RunLoop::step() {
 #endif
 
   if (event != Ion::Events::None) {
+    Ion::Profiling::SectionScope dispatchScope(Ion::Profiling::Section::EventDispatch);
     dispatchEvent(event);
   }
 
@@ -2,6 +2,7 @@ extern "C" {
 #include <assert.h>
 }
 #include <escher/view.h>
+#include <ion/profiling.h>
 
 View::View() :
   m_frame(KDRectZero),
@@ -27,6 +28,37 @@ void View::markRectAsDirty(KDRect rect) {
   m_dirtyRect = m_dirtyRect.unionedWith(rect);
 }
 
+/* The area redrawn by a view and its subviews is kept as a few rects, the
+ * overlapping ones being merged. A subview is thus only forced to redraw the
+ * parts of the area it overlaps, and not the whole bounding rect of the area:
+ * a view redrawn at the top of its superview and another at its bottom do not
+ * force the sister views between them to be redrawn. */
+constexpr static int k_maxNumberOfRedrawnRects = 4;
+
+static int AddRedrawnRect(KDRect * redrawnRects, int numberOfRedrawnRects, KDRect rect) {
+  if (rect.isEmpty()) {
+    return numberOfRedrawnRects;
+  }
+  int i = 0;
+  while (i < numberOfRedrawnRects) {
+    if (redrawnRects[i].intersects(rect)) {
+      // Merge the overlapping rect and check the other rects again
+      rect = rect.unionedWith(redrawnRects[i]);
+      redrawnRects[i] = redrawnRects[--numberOfRedrawnRects];
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+  if (numberOfRedrawnRects == k_maxNumberOfRedrawnRects) {
+    // No rect left: merge with the last one, even if they do not overlap
+    redrawnRects[numberOfRedrawnRects-1] = redrawnRects[numberOfRedrawnRects-1].unionedWith(rect);
+    return numberOfRedrawnRects;
+  }
+  redrawnRects[numberOfRedrawnRects] = rect;
+  return numberOfRedrawnRects + 1;
+}
+
 KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
   /* View::redraw recursively redraws the rectangle 'rect' of the view and all
    * its subviews.
@@ -52,18 +84,22 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
     .unionedWith(forceRedrawRect
       .intersectedWith(bounds()));
 
-  // This redraws the rectNeedingRedraw calling drawRect.
-  if (!rectNeedingRedraw.isEmpty()) {
+  /* This redraws the rectNeedingRedraw calling drawRect, unless an opaque
+   * subview will paint over all of it. The rectangle still counts as redrawn,
+   * so that the subviews are forced to redraw it. */
+  if (!rectNeedingRedraw.isEmpty() && !isCoveredByOpaqueSubview(rectNeedingRedraw)) {
     KDPoint absOrigin = absoluteOrigin();
     KDRect absRect = rectNeedingRedraw.translatedBy(absOrigin);
     KDRect absClippingRect = absoluteVisibleFrame().intersectedWith(absRect);
     KDContext * ctx = KDIonContext::sharedContext();
     ctx->setOrigin(absOrigin);
     ctx->setClippingRect(absClippingRect);
+    Ion::Profiling::SectionScope drawRectScope(Ion::Profiling::Section::DrawRect);
     this->drawRect(ctx, rectNeedingRedraw);
   }
   // This initializes the area that has been redrawn.
-  KDRect redrawnArea = rectNeedingRedraw;
+  KDRect redrawnRects[k_maxNumberOfRedrawnRects] = {KDRectZero, KDRectZero, KDRectZero, KDRectZero};
+  int numberOfRedrawnRects = AddRedrawnRect(redrawnRects, 0, rectNeedingRedraw);
 
   // Then, let's recursively draw our children over ourself
   for (uint8_t i=0; i<numberOfSubviews(); i++) {
@@ -77,7 +113,11 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
     KDRect intersectionInSubview = rect
       .intersectedWith(subview->m_frame)
       .translatedBy(subview->m_frame.origin().opposite());
-    KDRect forcedRedrawAreaInSubview = redrawnArea
+    KDRect forcedRedrawArea = KDRectZero;
+    for (int j = 0; j < numberOfRedrawnRects; j++) {
+      forcedRedrawArea = forcedRedrawArea.unionedWith(redrawnRects[j].intersectedWith(subview->m_frame));
+    }
+    KDRect forcedRedrawAreaInSubview = forcedRedrawArea
       .translatedBy(subview->m_frame.origin().opposite());
 
     // We redraw the current subview by passing the rectangle previously redrawn
@@ -86,15 +126,29 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
       subview->redraw(intersectionInSubview, forcedRedrawAreaInSubview);
 
     // We expand the redrawn area to include the area just drawn.
-    redrawnArea = redrawnArea.unionedWith(subviewRedrawnArea.translatedBy(subview->m_frame.origin()));
+    numberOfRedrawnRects = AddRedrawnRect(redrawnRects, numberOfRedrawnRects, subviewRedrawnArea.translatedBy(subview->m_frame.origin()));
   }
   // Eventually, mark that we don't need to be redrawn
   m_dirtyRect = KDRectZero;
 
   // The function returns the total area that have been redrawn.
+  KDRect redrawnArea = KDRectZero;
+  for (int j = 0; j < numberOfRedrawnRects; j++) {
+    redrawnArea = redrawnArea.unionedWith(redrawnRects[j]);
+  }
   return redrawnArea;
 }
 
+bool View::isCoveredByOpaqueSubview(KDRect rect) {
+  for (int i = 0; i < numberOfSubviews(); i++) {
+    View * subview = this->subview(i);
+    if (subview != nullptr && subview->isOpaque() && subview->m_frame.containsRect(rect)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 View * View::subview(int index) {
   assert(index >= 0 && index < numberOfSubviews());
   View * subview = subviewAtIndex(index);
@@ -133,6 +187,7 @@ void View::setFrame(KDRect frame) {
   // FIXME: m_dirtyRect = bounds(); would be more correct (in case the view is being shrinked)
 
   if (!m_frame.isEmpty()) {
+    Ion::Profiling::SectionScope layoutScope(Ion::Profiling::Section::Layout);
     layoutSubviews();
   }
 }
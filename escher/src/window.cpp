@@ -9,7 +9,9 @@ void Window::redraw(bool force) {
     markRectAsDirty(bounds());
   }
   Ion::Display::waitForVBlank();
+  uint32_t numberOfPushedPixels = KDIonContext::sharedContext()->numberOfPushedPixels();
   View::redraw(bounds());
+  m_numberOfPixelsPushedByLastRedraw = KDIonContext::sharedContext()->numberOfPushedPixels() - numberOfPushedPixels;
 }
 
 void Window::setContentView(View * contentView) {
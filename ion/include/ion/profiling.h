@@ -0,0 +1,80 @@
+#ifndef ION_PROFILING_H
+#define ION_PROFILING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Profiling measures where the time of the run loop goes. It is only compiled
+ * in when building the simulator with ION_PROFILING=1, and the profile of each
+ * event is then printed as a line of CSV on the console. The events are read
+ * from the standard input by the headless simulator, or replayed from the
+ * scenarios of events_benchmark when building with ION_EVENTS_BENCHMARK=1.
+ * Otherwise, every hook is an empty inline function.
+ *
+ * The time of a section does not include the time of the sections entered
+ * within it: the time spent drawing a view does not include the time spent
+ * pushing its pixels to the display, and the time spent dispatching an event
+ * does not include the time spent redrawing the window. The time spent
+ * decompressing records of the Storage is not included in any other section. */
+
+namespace Ion {
+namespace Profiling {
+
+enum class Section : uint8_t {
+  EventDispatch,
+  Layout,
+  DrawRect,
+  PushRect,
+  Decompression,
+  NumberOfSections
+};
+
+enum class Counter : uint8_t {
+  PushedPixels,
+  Reductions,
+  NumberOfCounters
+};
+
+enum class Gauge : uint8_t {
+  TreePoolLiveBytes,
+  NumberOfGauges
+};
+
+#if ION_PROFILING
+
+void enterSection(Section section);
+void exitSection(Section section);
+void increment(Counter counter, uint32_t value = 1);
+// Keeps the maximal value of the gauge
+void record(Gauge gauge, size_t value);
+
+/* The profile of an event spans from the moment it is returned to the run
+ * loop until the next event is requested, once the event has been dispatched
+ * and the window redrawn. startEvent resets the times, counters and gauges,
+ * and printEvent prints them after the scenario name, the index of the event
+ * in the scenario and its id. */
+void printHeader();
+void startEvent();
+void printEvent(const char * scenarioName, int eventIndex, uint8_t eventId);
+
+#else
+
+inline void enterSection(Section section) {}
+inline void exitSection(Section section) {}
+inline void increment(Counter counter, uint32_t value = 1) {}
+inline void record(Gauge gauge, size_t value) {}
+
+#endif
+
+class SectionScope {
+public:
+  SectionScope(Section section) : m_section(section) { enterSection(section); }
+  ~SectionScope() { exitSection(m_section); }
+private:
+  Section m_section;
+};
+
+}
+}
+
+#endif
@@ -9,7 +9,31 @@ namespace Ion {
 /* Storage : | Magic |             Record1                 |            Record2                  | ... | Magic |
  *           | Magic | Size1(uint16_t) | FullName1 | Body1 | Size2(uint16_t) | FullName2 | Body2 | ... | Magic |
  *
- * A record's fullName is baseName.extension. */
+ * A record's fullName is baseName.extension.
+ *
+ * The most significant bit of the size of a record flags a compressed body:
+ *           | Size | FullName | UncompressedSize(uint16_t) | LZ4 block |
+ * Only Python scripts are compressed: they are the largest records, and are
+ * only written through the Storage. When less than k_minAvailableSize bytes
+ * are available after a record is written, or when a record does not fit, the
+ * scripts which were accessed the least recently are compressed. The value of
+ * a compressed record is read from a copy decompressed at the end of the free
+ * space, which always keeps room for the largest compressed value, and is
+ * written uncompressed.
+ *
+ * Compression changes the format of the storage: while it holds compressed
+ * records, it is framed by CompressedMagic instead of Magic, so that readers
+ * unaware of the flag reject it instead of misreading it. Compression is thus
+ * disabled unless the firmware is built with ION_STORAGE_COMPRESSION=1, which
+ * should only be done once the DFU readers support this format: they have to
+ * accept CompressedMagic, mask the flag to walk the records and decompress the
+ * flagged bodies. Without compression, a storage with compressed records, for
+ * instance restored from a backup, is still read, and its records are written
+ * uncompressed.
+ *
+ * Compressing a record moves the records following it, as writing a record
+ * does, so a write may move any record: values have to be fetched again after
+ * a write. */
 
 class StorageDelegate;
 
@@ -24,6 +48,7 @@ public:
   static constexpr char expExtension[] = "exp";
   static constexpr char funcExtension[] = "func";
   static constexpr char seqExtension[] = "seq";
+  static constexpr char pyExtension[] = "py";
 
   class Record {
     /* A Record is identified by the CRC32 on its fullName because:
@@ -69,12 +94,32 @@ public:
     ErrorStatus setName(const char * fullName) {
       return Storage::sharedStorage()->setFullNameOfRecord(*this, fullName);
     }
+    /* The value of a record remains valid until a record is written, and the
+     * value of a compressed record until another record is decompressed. */
     Data value() const {
       return Storage::sharedStorage()->valueOfRecord(*this);
     }
+    /* Only the bytes of the value which differ from data are written, and
+     * setting the value it already has does not change the record. */
     ErrorStatus setValue(Data data) {
       return Storage::sharedStorage()->setValueOfRecord(*this, data);
     }
+    /* Overwrite size bytes of the value at offset, like the fixed-size
+     * metadata at the beginning of some values. The change is journaled but
+     * the delegate is not notified, as no other record depends on them. */
+    ErrorStatus patchValue(size_t offset, const void * data, size_t size) {
+      return Storage::sharedStorage()->patchValueOfRecord(*this, offset, data, size);
+    }
+    /* Replace removedSize bytes of the value at offset with insertedSize bytes
+     * of data. Only the end of the buffer following them is moved. */
+    ErrorStatus replaceValueRange(size_t offset, size_t removedSize, const void * data, size_t insertedSize) {
+      return Storage::sharedStorage()->replaceValueRangeOfRecord(*this, offset, removedSize, data, insertedSize);
+    }
+    /* Write the value uncompressed, without changing it. Other records are
+     * compressed to make room if needed. */
+    ErrorStatus decompress() {
+      return Storage::sharedStorage()->decompressRecord(*this);
+    }
     void destroy() {
       return Storage::sharedStorage()->destroyRecord(*this);
     }
@@ -96,6 +141,28 @@ public:
   void setDelegate(StorageDelegate * delegate) { m_delegate = delegate; }
   void notifyChangeToDelegate(const Record r = Record()) const;
   Record::ErrorStatus notifyFullnessToDelegate() const;
+  /* The buffer can be written from outside of the Storage, through DFU. The
+   * addresses of records remembered by the Storage are then discarded. */
+  void bufferWasModifiedExternally();
+
+  /* The change journal counts the changes to the records and remembers the
+   * records changed by the last k_changeJournalLength ones. An observer keeps
+   * the generation it is up to date with, and asks which records changed
+   * since then. */
+  uint32_t changeGeneration() const { return m_changeGeneration; }
+  bool recordDidChangeSince(const Record record, uint32_t generation) const;
+
+  // Compression
+  void setCompressionEnabled(bool enabled) { m_compressionEnabled = enabled; }
+  bool compressionEnabled() const { return m_compressionEnabled; }
+  struct CompressionStatistics {
+    int numberOfCompressedRecords;
+    size_t compressedSize;
+    size_t uncompressedSize;
+    uint32_t numberOfDecompressions;
+    uint32_t numberOfCacheHits;
+  };
+  CompressionStatistics compressionStatistics();
 
   int numberOfRecordsWithExtension(const char * extension);
   static bool FullNameHasExtension(const char * fullName, const char * extension, size_t extensionLength);
@@ -117,7 +184,16 @@ public:
 
 private:
   constexpr static uint32_t Magic = 0xEE0BDDBA;
-  constexpr static size_t k_maxRecordSize = (1 << sizeof(record_size_t)*8);
+  constexpr static uint32_t CompressedMagic = 0xEE0BDDBB;
+  // The most significant bit of the size flags compressed records
+  constexpr static record_size_t k_compressedRecordFlag = 1 << (sizeof(record_size_t)*8-1);
+  constexpr static size_t k_maxRecordSize = k_compressedRecordFlag;
+  constexpr static size_t k_minAvailableSize = k_storageSize/4;
+  constexpr static size_t k_minCompressibleValueSize = 128;
+  constexpr static int k_numberOfIncompressibleRecords = 8;
+  constexpr static int k_maxNumberOfIndexedRecords = 128;
+  // A power of two, for the journal to survive the wrap of the generation
+  constexpr static uint32_t k_changeJournalLength = 16;
 
   /* Getters/Setters on recordID */
   const char * fullNameOfRecord(const Record record);
@@ -125,16 +201,20 @@ private:
   Record::ErrorStatus setBaseNameWithExtensionOfRecord(const Record record, const char * baseName, const char * extension);
   Record::Data valueOfRecord(const Record record);
   Record::ErrorStatus setValueOfRecord(const Record record, Record::Data data);
+  Record::ErrorStatus patchValueOfRecord(const Record record, size_t offset, const void * data, size_t size);
+  Record::ErrorStatus replaceValueRangeOfRecord(const Record record, size_t offset, size_t removedSize, const void * data, size_t insertedSize);
+  Record::ErrorStatus decompressRecord(const Record record);
   void destroyRecord(const Record record);
 
   /* Getters on address in buffer */
   char * pointerOfRecord(const Record record) const;
   record_size_t sizeOfRecordStarting(char * start) const;
+  bool recordIsCompressedStarting(char * start) const;
   const char * fullNameOfRecordStarting(char * start) const;
   const void * valueOfRecordStarting(char * start) const;
 
   /* Overriders */
-  size_t overrideSizeAtPosition(char * position, record_size_t size);
+  size_t overrideSizeAtPosition(char * position, record_size_t size, bool compressed = false);
   size_t overrideFullNameAtPosition(char * position, const char * fullName);
   size_t overrideBaseNameWithExtensionAtPosition(char * position, const char * baseName, const char * extension);
   size_t overrideValueAtPosition(char * position, const void * data, record_size_t size);
@@ -148,6 +228,69 @@ private:
   size_t sizeOfRecordWithBaseNameAndExtension(const char * baseName, const char * extension, size_t size) const;
   size_t sizeOfRecordWithFullName(const char * fullName, size_t size) const;
   bool slideBuffer(char * position, int delta);
+  // A null record stands for a change to every record
+  void journalChange(const Record record) const;
+  /* Replace a range of the body of a record, which is then uncompressed, and
+   * make room for it by compressing other records if needed. */
+  Record::ErrorStatus replaceBodyRangeOfRecord(const Record record, size_t offset, size_t removedSize, const void * data, size_t insertedSize, bool valueChanges = true);
+
+  // Compression
+  size_t freeSize();
+  /* The available size for a write of record, which is written uncompressed
+   * and thus no longer needs room to be decompressed. */
+  size_t availableSizeToWrite(const Record record);
+  // The room kept to decompress the compressed records but recordToExclude
+  size_t decompressionReserve(const Record recordToExclude = Record());
+  size_t uncompressedSizeOfRecordStarting(char * start) const;
+  bool recordIsCompressible(char * start) const;
+  /* Write the compressed body of the record in scratch and return its size,
+   * or 0 if it does not save room. */
+  size_t compressRecordStarting(char * start, char * scratch, size_t scratchSize) const;
+  void writeCompressedBodyOfRecordStarting(char * start, const char * body, size_t bodySize);
+  /* Return the record to compress after the one of key minKey - 1, in the
+   * order of their last access and then of the buffer, and write its key. */
+  char * coldRecordStarting(uint32_t minKey, uint32_t * key, const Record recordToKeep, const void * data);
+  /* Compress the coldest records other than recordToKeep until size bytes are
+   * available to write it. Returns false if they are not. *data, which is
+   * about to be written, follows the records it lies in. As the free space is
+   * used as scratch, nothing is compressed while data lies in it. */
+  bool compressColdRecords(size_t size, const Record recordToKeep, const void ** data = nullptr);
+  // Make room for the value of a compressed record before decompressing it
+  bool makeRoomToDecompressRecordStarting(char * start, const Record record);
+  // Write the value of a compressed record uncompressed in place
+  void decompressRecordStarting(char * start);
+  bool isInFreeSpace(const void * data);
+  bool recordIsIncompressible(const Record record) const;
+  Record::Data decompressedValueOfRecordStarting(char * start, const Record record);
+  void updateMagic();
+  void recordWasAccessed(const Record record) const;
+
+  /* The index lists the records in the order of the buffer, with their offset,
+   * the CRC32s of their full name and extension, and the generation of their
+   * last access, which orders the records to compress. Lookups compare these
+   * CRC32s instead of walking the buffer and hashing every name. The index is
+   * updated along with the buffer, and rebuilt from the buffer after it has
+   * been invalidated. When there are more than k_maxNumberOfIndexedRecords
+   * records, or names with several dots, lookups walk the buffer, and records
+   * are compressed in the order of the buffer. */
+  struct IndexEntry {
+    uint32_t fullNameCRC32;
+    uint32_t extensionCRC32;
+    uint16_t offset;
+    uint16_t lastAccess;
+  };
+  enum class IndexStatus : uint8_t {
+    Valid,
+    Invalid,
+    Unavailable
+  };
+  static uint32_t ExtensionCRC32(const char * extension);
+  // Returns false if the buffer has to be walked
+  bool updateIndex() const;
+  int indexOfRecordInIndex(const Record record) const;
+  // Returns false if the name of the record has several dots
+  bool fillIndexEntry(IndexEntry * entry, char * start, uint32_t fullNameCRC32) const;
+  void indexRecordStarting(char * start, uint32_t fullNameCRC32) const;
   class RecordIterator {
   public:
     RecordIterator(char * start) : m_recordStart(start) {}
@@ -171,6 +314,26 @@ private:
   StorageDelegate * m_delegate;
   mutable Record m_lastRecordRetrieved;
   mutable char * m_lastRecordRetrievedPointer;
+  mutable IndexEntry m_index[k_maxNumberOfIndexedRecords];
+  mutable uint16_t m_numberOfIndexedRecords;
+  mutable IndexStatus m_indexStatus;
+  mutable uint32_t m_changeJournal[k_changeJournalLength];
+  mutable uint32_t m_changeGeneration;
+  /* The record whose value was decompressed at the end of the free space, or
+   * 0 once the free space has been written. */
+  mutable uint32_t m_decompressedRecordCRC32;
+  /* Records which did not compress enough are remembered until they change,
+   * so that they are not compressed again after every write. */
+  mutable uint32_t m_incompressibleRecords[k_numberOfIncompressibleRecords];
+  uint8_t m_nextIncompressibleRecord;
+  mutable uint32_t m_numberOfDecompressions;
+  mutable uint32_t m_numberOfCacheHits;
+  /* The access generation is only incremented when a record other than the
+   * last one accessed is, with compression enabled. It wraps, which only
+   * makes the oldest records look recent. */
+  mutable uint16_t m_accessGeneration;
+  mutable Record m_lastAccessedRecord;
+  bool m_compressionEnabled;
 };
 
 /* Some apps memoize records and need to be notified when a record might have
@@ -1,6 +1,7 @@
 #include <ion/events.h>
 #include <ion/timing.h>
 #include <ion/display.h>
+#include <ion/profiling.h>
 #include <kandinsky.h>
 #include "../../../poincare/include/poincare/print_int.h"
 #include <assert.h>
@@ -63,12 +64,22 @@ Event getEvent(int * timeout) {
   static int eventIndex = 0;
   static uint64_t startTime = Ion::Timing::millis();
   static int timings[numberOfScenari];
+#if ION_PROFILING
+  if (eventIndex > 0) {
+    Profiling::printEvent(scenari[scenariIndex].name(), eventIndex - 1, scenari[scenariIndex].eventAtIndex(eventIndex - 1).id());
+  } else if (scenariIndex == 0) {
+    Profiling::printHeader();
+  }
+#endif
   if (eventIndex >= scenari[scenariIndex].numberOfEvents()) {
     timings[scenariIndex++] = Ion::Timing::millis() - startTime;
     eventIndex = 0;
     startTime = Ion::Timing::millis();
   }
   if (scenariIndex >= numberOfScenari) {
+#if ION_PROFILING
+    return Termination;
+#else
     // Display results
     int line_y = 1;
     KDContext * ctx = KDIonContext::sharedContext();
@@ -80,7 +91,7 @@ Event getEvent(int * timeout) {
     for (int i = 0; i < numberOfScenari; i++) {
       constexpr int bufferLength = 50;
       char buffer[bufferLength];
-      Poincare::PrintInt::Left(timings[i], buffer, bufferLength);
+      buffer[Poincare::PrintInt::Left(timings[i], buffer, bufferLength - 1)] = 0;
       //buffer[50-1-3] = 0; // convert from ms to s without generating _udivmoddi4 (long long division)
       ctx->drawString(scenari[i].name(), KDPoint(0, line_y), font);
       ctx->drawString(buffer, KDPoint(200, line_y), font);
@@ -88,7 +99,11 @@ Event getEvent(int * timeout) {
     }
     while (1) {
     }
+#endif
   }
+#if ION_PROFILING
+  Profiling::startEvent();
+#endif
   return scenari[scenariIndex].eventAtIndex(eventIndex++);
 }
 
@@ -0,0 +1,117 @@
+#include <ion/profiling.h>
+#include <ion/console.h>
+#include <chrono>
+#include <assert.h>
+
+namespace Ion {
+namespace Profiling {
+
+constexpr static int k_numberOfSections = static_cast<int>(Section::NumberOfSections);
+constexpr static int k_numberOfCounters = static_cast<int>(Counter::NumberOfCounters);
+constexpr static int k_numberOfGauges = static_cast<int>(Gauge::NumberOfGauges);
+constexpr static int k_maxSectionDepth = 32;
+
+static uint64_t sMicroseconds[k_numberOfSections];
+static uint32_t sCounts[k_numberOfCounters];
+static size_t sMaxima[k_numberOfGauges];
+
+/* The sections entered and not exited yet. The time elapsed since the last
+ * section was entered or exited is charged to the innermost one. */
+static Section sSections[k_maxSectionDepth];
+static int sSectionDepth = 0;
+static uint64_t sLastTransition = 0;
+
+static uint64_t Now() {
+  static auto start = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+static void ChargeInnermostSection(uint64_t now) {
+  if (sSectionDepth > 0 && sSectionDepth <= k_maxSectionDepth) {
+    sMicroseconds[static_cast<int>(sSections[sSectionDepth-1])] += now - sLastTransition;
+  }
+  sLastTransition = now;
+}
+
+void enterSection(Section section) {
+  ChargeInnermostSection(Now());
+  if (sSectionDepth < k_maxSectionDepth) {
+    sSections[sSectionDepth] = section;
+  }
+  // Sections deeper than k_maxSectionDepth are charged to their ancestor
+  sSectionDepth++;
+}
+
+void exitSection(Section section) {
+  assert(sSectionDepth > 0);
+  assert(sSectionDepth > k_maxSectionDepth || sSections[sSectionDepth-1] == section);
+  ChargeInnermostSection(Now());
+  sSectionDepth--;
+}
+
+void increment(Counter counter, uint32_t value) {
+  sCounts[static_cast<int>(counter)] += value;
+}
+
+void record(Gauge gauge, size_t value) {
+  size_t * maximum = sMaxima + static_cast<int>(gauge);
+  if (value > *maximum) {
+    *maximum = value;
+  }
+}
+
+void printHeader() {
+  Console::writeLine("scenario,event_index,event_id,dispatch_us,layout_us,draw_rect_us,push_rect_us,decompress_us,pushed_pixels,tree_pool_peak_bytes,reductions");
+}
+
+void startEvent() {
+  for (int i = 0; i < k_numberOfSections; i++) {
+    sMicroseconds[i] = 0;
+  }
+  for (int i = 0; i < k_numberOfCounters; i++) {
+    sCounts[i] = 0;
+  }
+  for (int i = 0; i < k_numberOfGauges; i++) {
+    sMaxima[i] = 0;
+  }
+  sLastTransition = Now();
+}
+
+constexpr static int k_lineLength = 128;
+
+static void AppendField(char * line, int * length, uint64_t value) {
+  line[(*length)++] = ',';
+  char digits[20];
+  int numberOfDigits = 0;
+  do {
+    digits[numberOfDigits++] = '0' + value % 10;
+    value /= 10;
+  } while (value > 0);
+  assert(*length + numberOfDigits < k_lineLength);
+  while (numberOfDigits > 0) {
+    line[(*length)++] = digits[--numberOfDigits];
+  }
+}
+
+void printEvent(const char * scenarioName, int eventIndex, uint8_t eventId) {
+  char line[k_lineLength];
+  int length = 0;
+  // Leave room for the fields
+  for (const char * c = scenarioName; *c != 0 && length < k_lineLength / 2; c++) {
+    line[length++] = *c;
+  }
+  AppendField(line, &length, eventIndex);
+  AppendField(line, &length, eventId);
+  for (int i = 0; i < k_numberOfSections; i++) {
+    AppendField(line, &length, sMicroseconds[i]);
+  }
+  AppendField(line, &length, sCounts[static_cast<int>(Counter::PushedPixels)]);
+  AppendField(line, &length, sMaxima[static_cast<int>(Gauge::TreePoolLiveBytes)]);
+  AppendField(line, &length, sCounts[static_cast<int>(Counter::Reductions)]);
+  line[length] = 0;
+  Console::writeLine(line);
+}
+
+}
+}
@@ -1,4 +1,6 @@
 #include <ion.h>
+#include <ion/profiling.h>
+#include "../external/lz4/lz4.h"
 #include <string.h>
 #include <assert.h>
 #include <new>
@@ -6,6 +8,10 @@
 #include<iostream>
 #endif
 
+#ifndef ION_STORAGE_COMPRESSION
+#define ION_STORAGE_COMPRESSION 0
+#endif
+
 namespace Ion {
 
 /* We want to implement a simple singleton pattern, to make sure the storage is
@@ -26,6 +32,7 @@ constexpr char Storage::expExtension[];
 constexpr char Storage::funcExtension[];
 constexpr char Storage::seqExtension[];
 constexpr char Storage::eqExtension[];
+constexpr char Storage::pyExtension[];
 
 Storage * Storage::sharedStorage() {
   static Storage * storage = nullptr;
@@ -96,7 +103,20 @@ Storage::Storage() :
   m_magicFooter(Magic),
   m_delegate(nullptr),
   m_lastRecordRetrieved(nullptr),
-  m_lastRecordRetrievedPointer(nullptr)
+  m_lastRecordRetrievedPointer(nullptr),
+  m_index(),
+  m_numberOfIndexedRecords(0),
+  m_indexStatus(IndexStatus::Valid),
+  m_changeJournal(),
+  m_changeGeneration(0),
+  m_decompressedRecordCRC32(0),
+  m_incompressibleRecords(),
+  m_nextIncompressibleRecord(0),
+  m_numberOfDecompressions(0),
+  m_numberOfCacheHits(0),
+  m_accessGeneration(0),
+  m_lastAccessedRecord(),
+  m_compressionEnabled(ION_STORAGE_COMPRESSION)
 {
   assert(m_magicHeader == Magic);
   assert(m_magicFooter == Magic);
@@ -114,7 +134,7 @@ void Storage::log() {
 #endif
 
 size_t Storage::availableSize() {
-  return k_storageSize-(endBuffer()-m_buffer)-sizeof(record_size_t);
+  return availableSizeToWrite(Record());
 }
 
 uint32_t Storage::checksum() {
@@ -122,6 +142,7 @@ uint32_t Storage::checksum() {
 }
 
 void Storage::notifyChangeToDelegate(const Record record) const {
+  journalChange(record);
   m_lastRecordRetrieved = Record(nullptr);
   m_lastRecordRetrievedPointer = nullptr;
   if (m_delegate != nullptr) {
@@ -129,6 +150,26 @@ void Storage::notifyChangeToDelegate(const Record record) const {
   }
 }
 
+void Storage::bufferWasModifiedExternally() {
+  m_indexStatus = IndexStatus::Invalid;
+  updateMagic();
+  notifyChangeToDelegate();
+}
+
+bool Storage::recordDidChangeSince(const Record record, uint32_t generation) const {
+  if (m_changeGeneration - generation > k_changeJournalLength) {
+    // The oldest changes are forgotten
+    return true;
+  }
+  for (uint32_t g = generation; g != m_changeGeneration; g++) {
+    uint32_t changedRecordCRC32 = m_changeJournal[g % k_changeJournalLength];
+    if (changedRecordCRC32 == 0 || changedRecordCRC32 == record.m_fullNameCRC32) {
+      return true;
+    }
+  }
+  return false;
+}
+
 Storage::Record::ErrorStatus Storage::notifyFullnessToDelegate() const {
   if (m_delegate != nullptr) {
     m_delegate->storageIsFull();
@@ -138,7 +179,7 @@ Storage::Record::ErrorStatus Storage::notifyFullnessToDelegate() const {
 
 Storage::Record::ErrorStatus Storage::createRecordWithFullName(const char * fullName, const void * data, size_t size) {
   size_t recordSize = sizeOfRecordWithFullName(fullName, size);
-  if (recordSize >= k_maxRecordSize || recordSize > availableSize()) {
+  if (recordSize >= k_maxRecordSize || (recordSize > availableSize() && !compressColdRecords(recordSize, Record(), &data))) {
    return notifyFullnessToDelegate();
   }
   if (isFullNameTaken(fullName)) {
@@ -156,15 +197,21 @@ Storage::Record::ErrorStatus Storage::createRecordWithFullName(const char * full
   // Next Record is null-sized
   overrideSizeAtPosition(newRecord, 0);
   Record r = Record(fullName);
+  if (m_indexStatus == IndexStatus::Valid) {
+    indexRecordStarting(newRecordAddress, r.m_fullNameCRC32);
+  }
   notifyChangeToDelegate(r);
   m_lastRecordRetrieved = r;
   m_lastRecordRetrievedPointer = newRecordAddress;
+  if (availableSize() < k_minAvailableSize) {
+    compressColdRecords(k_minAvailableSize, r);
+  }
   return Record::ErrorStatus::None;
 }
 
 Storage::Record::ErrorStatus Storage::createRecordWithExtension(const char * baseName, const char * extension, const void * data, size_t size) {
   size_t recordSize = sizeOfRecordWithBaseNameAndExtension(baseName, extension, size);
-  if (recordSize >= k_maxRecordSize || recordSize > availableSize()) {
+  if (recordSize >= k_maxRecordSize || (recordSize > availableSize() && !compressColdRecords(recordSize, Record(), &data))) {
    return notifyFullnessToDelegate();
   }
   if (isBaseNameWithExtensionTaken(baseName, extension)) {
@@ -182,14 +229,29 @@ Storage::Record::ErrorStatus Storage::createRecordWithExtension(const char * bas
   // Next Record is null-sized
   overrideSizeAtPosition(newRecord, 0);
   Record r = Record(fullNameOfRecordStarting(newRecordAddress));
+  if (m_indexStatus == IndexStatus::Valid) {
+    indexRecordStarting(newRecordAddress, r.m_fullNameCRC32);
+  }
   notifyChangeToDelegate(r);
   m_lastRecordRetrieved = r;
   m_lastRecordRetrievedPointer = newRecordAddress;
+  if (availableSize() < k_minAvailableSize) {
+    compressColdRecords(k_minAvailableSize, r);
+  }
   return Record::ErrorStatus::None;
 }
 
 int Storage::numberOfRecordsWithExtension(const char * extension) {
   int count = 0;
+  if (updateIndex()) {
+    uint32_t extensionCRC32 = ExtensionCRC32(extension);
+    for (int i = 0; i < m_numberOfIndexedRecords; i++) {
+      if (m_index[i].extensionCRC32 == extensionCRC32) {
+        count++;
+      }
+    }
+    return count;
+  }
   size_t extensionLength = strlen(extension);
   for (char * p : *this) {
     const char * name = fullNameOfRecordStarting(p);
@@ -201,6 +263,20 @@ int Storage::numberOfRecordsWithExtension(const char * extension) {
 }
 
 Storage::Record Storage::recordWithExtensionAtIndex(const char * extension, int index) {
+  if (updateIndex()) {
+    uint32_t extensionCRC32 = ExtensionCRC32(extension);
+    int currentIndex = -1;
+    for (int i = 0; i < m_numberOfIndexedRecords; i++) {
+      if (m_index[i].extensionCRC32 == extensionCRC32 && ++currentIndex == index) {
+        Record r;
+        r.m_fullNameCRC32 = m_index[i].fullNameCRC32;
+        m_lastRecordRetrieved = r;
+        m_lastRecordRetrievedPointer = m_buffer + m_index[i].offset;
+        return r;
+      }
+    }
+    return Record();
+  }
   int currentIndex = -1;
   const char * name = nullptr;
   size_t extensionLength = strlen(extension);
@@ -255,6 +331,24 @@ Storage::Record Storage::recordBaseNamedWithExtensions(const char * baseName, co
       }
     }
   }
+  if (updateIndex()) {
+    // Keep the first record in the buffer, as when walking the buffer
+    int firstIndex = -1;
+    for (size_t i = 0; i < numberOfExtensions; i++) {
+      int index = indexOfRecordInIndex(Record(baseName, extensions[i]));
+      if (index >= 0 && (firstIndex < 0 || index < firstIndex)) {
+        firstIndex = index;
+      }
+    }
+    if (firstIndex < 0) {
+      return Record();
+    }
+    Record r;
+    r.m_fullNameCRC32 = m_index[firstIndex].fullNameCRC32;
+    m_lastRecordRetrieved = r;
+    m_lastRecordRetrievedPointer = m_buffer + m_index[firstIndex].offset;
+    return r;
+  }
   for (char * p : *this) {
     const char * currentName = fullNameOfRecordStarting(p);
     if (strncmp(baseName, currentName, nameLength) == 0) {
@@ -271,6 +365,9 @@ Storage::Record Storage::recordBaseNamedWithExtensions(const char * baseName, co
 
 void Storage::destroyAllRecords() {
   overrideSizeAtPosition(m_buffer, 0);
+  m_numberOfIndexedRecords = 0;
+  m_indexStatus = IndexStatus::Valid;
+  updateMagic();
   notifyChangeToDelegate();
 }
 
@@ -318,13 +415,24 @@ Storage::Record::ErrorStatus Storage::setFullNameOfRecord(const Record record, c
     size_t previousNameSize = strlen(fullNameOfRecordStarting(p))+1;
     record_size_t previousRecordSize = sizeOfRecordStarting(p);
     size_t newRecordSize = previousRecordSize-previousNameSize+nameSize;
-    if (newRecordSize >= k_maxRecordSize || !slideBuffer(p+sizeof(record_size_t)+previousNameSize, nameSize-previousNameSize)) {
+    if (newRecordSize >= k_maxRecordSize || (nameSize > previousNameSize && nameSize-previousNameSize > availableSize()) || !slideBuffer(p+sizeof(record_size_t)+previousNameSize, nameSize-previousNameSize)) {
       return notifyFullnessToDelegate();
     }
-    overrideSizeAtPosition(p, newRecordSize);
+    overrideSizeAtPosition(p, newRecordSize, recordIsCompressedStarting(p));
     overrideFullNameAtPosition(p+sizeof(record_size_t), fullName);
+    Record renamedRecord = Record(fullName);
+    if (m_indexStatus == IndexStatus::Valid) {
+      int index = indexOfRecordInIndex(record);
+      assert(index >= 0);
+      if (!fillIndexEntry(m_index + index, p, renamedRecord.m_fullNameCRC32)) {
+        m_indexStatus = IndexStatus::Unavailable;
+      }
+    } else {
+      m_indexStatus = IndexStatus::Invalid;
+    }
+    journalChange(renamedRecord);
     notifyChangeToDelegate(record);
-    m_lastRecordRetrieved = record;
+    m_lastRecordRetrieved = renamedRecord;
     m_lastRecordRetrievedPointer = p;
     return Record::ErrorStatus::None;
   }
@@ -341,12 +449,22 @@ Storage::Record::ErrorStatus Storage::setBaseNameWithExtensionOfRecord(Record re
     size_t previousNameSize = strlen(fullNameOfRecordStarting(p))+1;
     record_size_t previousRecordSize = sizeOfRecordStarting(p);
     size_t newRecordSize = previousRecordSize-previousNameSize+nameSize;
-    if (newRecordSize >= k_maxRecordSize || !slideBuffer(p+sizeof(record_size_t)+previousNameSize, nameSize-previousNameSize)) {
+    if (newRecordSize >= k_maxRecordSize || (nameSize > previousNameSize && nameSize-previousNameSize > availableSize()) || !slideBuffer(p+sizeof(record_size_t)+previousNameSize, nameSize-previousNameSize)) {
       return notifyFullnessToDelegate();
     }
-    overrideSizeAtPosition(p, newRecordSize);
+    overrideSizeAtPosition(p, newRecordSize, recordIsCompressedStarting(p));
     char * fullNamePosition = p + sizeof(record_size_t);
     overrideBaseNameWithExtensionAtPosition(fullNamePosition, baseName, extension);
+    if (m_indexStatus == IndexStatus::Valid) {
+      int index = indexOfRecordInIndex(record);
+      assert(index >= 0);
+      if (!fillIndexEntry(m_index + index, p, Record(fullNamePosition).m_fullNameCRC32)) {
+        m_indexStatus = IndexStatus::Unavailable;
+      }
+    } else {
+      m_indexStatus = IndexStatus::Invalid;
+    }
+    journalChange(record);
     // Recompute the CRC32
     record = Record(fullNamePosition);
     notifyChangeToDelegate(record);
@@ -360,6 +478,10 @@ Storage::Record::ErrorStatus Storage::setBaseNameWithExtensionOfRecord(Record re
 Storage::Record::Data Storage::valueOfRecord(const Record record) {
   char * p = pointerOfRecord(record);
   if (p != nullptr) {
+    recordWasAccessed(record);
+    if (recordIsCompressedStarting(p)) {
+      return decompressedValueOfRecordStarting(p, record);
+    }
     const char * fullName = fullNameOfRecordStarting(p);
     record_size_t size = sizeOfRecordStarting(p);
     const void * value = valueOfRecordStarting(p);
@@ -370,22 +492,100 @@ Storage::Record::Data Storage::valueOfRecord(const Record record) {
 
 Storage::Record::ErrorStatus Storage::setValueOfRecord(Record record, Record::Data data) {
   char * p = pointerOfRecord(record);
-  if (p != nullptr) {
-    record_size_t previousRecordSize = sizeOfRecordStarting(p);
-    const char * fullName = fullNameOfRecordStarting(p);
-    size_t newRecordSize = sizeOfRecordWithFullName(fullName, data.size);
-    if (newRecordSize >= k_maxRecordSize || !slideBuffer(p+previousRecordSize, newRecordSize-previousRecordSize)) {
-      return notifyFullnessToDelegate();
+  if (p == nullptr) {
+    return Record::ErrorStatus::RecordDoesNotExist;
+  }
+  const char * previousValue = static_cast<const char *>(valueOfRecordStarting(p));
+  size_t previousSize = sizeOfRecordStarting(p) - (previousValue - p);
+  if (recordIsCompressedStarting(p)) {
+    /* The compressed body is replaced, unless the value is the same. The value
+     * is not decompressed over data, the decompressed value of another record. */
+    if (!isInFreeSpace(data.buffer) || m_decompressedRecordCRC32 == record.m_fullNameCRC32) {
+      Record::Data decompressedData = decompressedValueOfRecordStarting(p, record);
+      if (data.size == decompressedData.size && memcmp(data.buffer, decompressedData.buffer, data.size) == 0) {
+        return Record::ErrorStatus::None;
+      }
     }
-    record_size_t fullNameSize = strlen(fullName)+1;
-    overrideSizeAtPosition(p, newRecordSize);
-    overrideValueAtPosition(p+sizeof(record_size_t)+fullNameSize, data.buffer, data.size);
-    notifyChangeToDelegate(record);
-    m_lastRecordRetrieved = record;
-    m_lastRecordRetrievedPointer = p;
+    return replaceBodyRangeOfRecord(record, 0, previousSize, data.buffer, data.size);
+  }
+  const char * value = static_cast<const char *>(data.buffer);
+  size_t commonSize = previousSize < data.size ? previousSize : data.size;
+  if (value == previousValue) {
+    /* The value was written in place and cannot be compared with the previous
+     * one: only its size is updated. */
+    return replaceBodyRangeOfRecord(record, commonSize, previousSize - commonSize, value + commonSize, data.size - commonSize);
+  }
+  // Only replace the bytes between the common prefix and suffix of the values
+  size_t prefixSize = 0;
+  while (prefixSize < commonSize && value[prefixSize] == previousValue[prefixSize]) {
+    prefixSize++;
+  }
+  if (prefixSize == previousSize && prefixSize == data.size) {
     return Record::ErrorStatus::None;
   }
-  return Record::ErrorStatus::RecordDoesNotExist;
+  size_t suffixSize = 0;
+  while (suffixSize < commonSize - prefixSize && value[data.size - 1 - suffixSize] == previousValue[previousSize - 1 - suffixSize]) {
+    suffixSize++;
+  }
+  return replaceBodyRangeOfRecord(record, prefixSize, previousSize - prefixSize - suffixSize, value + prefixSize, data.size - prefixSize - suffixSize);
+}
+
+Storage::Record::ErrorStatus Storage::patchValueOfRecord(Record record, size_t offset, const void * data, size_t size) {
+  char * p = pointerOfRecord(record);
+  if (p == nullptr) {
+    return Record::ErrorStatus::RecordDoesNotExist;
+  }
+  if (recordIsCompressedStarting(p)) {
+    // The value is written uncompressed before it is patched
+    Record::ErrorStatus error = decompressRecord(record);
+    if (error != Record::ErrorStatus::None) {
+      return error;
+    }
+    p = pointerOfRecord(record);
+  }
+  char * position = static_cast<char *>(const_cast<void *>(valueOfRecordStarting(p))) + offset;
+  assert(position + size <= p + sizeOfRecordStarting(p));
+  if (memcmp(position, data, size) != 0) {
+    memcpy(position, data, size);
+    journalChange(record);
+  }
+  return Record::ErrorStatus::None;
+}
+
+Storage::Record::ErrorStatus Storage::replaceValueRangeOfRecord(Record record, size_t offset, size_t removedSize, const void * data, size_t insertedSize) {
+  char * p = pointerOfRecord(record);
+  if (p == nullptr) {
+    return Record::ErrorStatus::RecordDoesNotExist;
+  }
+  // The value is written uncompressed before its range is replaced
+  Record::ErrorStatus error = decompressRecord(record);
+  if (error != Record::ErrorStatus::None) {
+    return error;
+  }
+  return replaceBodyRangeOfRecord(record, offset, removedSize, data, insertedSize);
+}
+
+Storage::Record::ErrorStatus Storage::decompressRecord(Record record) {
+  char * p = pointerOfRecord(record);
+  if (p == nullptr) {
+    return Record::ErrorStatus::RecordDoesNotExist;
+  }
+  if (!recordIsCompressedStarting(p)) {
+    return Record::ErrorStatus::None;
+  }
+  if (!makeRoomToDecompressRecordStarting(p, record)) {
+    return notifyFullnessToDelegate();
+  }
+  p = pointerOfRecord(record);
+  decompressRecordStarting(p);
+  updateMagic();
+  // The records following the decompressed one have moved
+  m_lastRecordRetrieved = record;
+  m_lastRecordRetrievedPointer = p;
+  if (availableSize() < k_minAvailableSize) {
+    compressColdRecords(k_minAvailableSize, record);
+  }
+  return Record::ErrorStatus::None;
 }
 
 void Storage::destroyRecord(Record record) {
@@ -395,7 +595,20 @@ void Storage::destroyRecord(Record record) {
   char * p = pointerOfRecord(record);
   if (p != nullptr) {
     record_size_t previousRecordSize = sizeOfRecordStarting(p);
+    bool wasCompressed = recordIsCompressedStarting(p);
     slideBuffer(p+previousRecordSize, -previousRecordSize);
+    if (wasCompressed) {
+      updateMagic();
+    }
+    // The index is updated after sliding the buffer, which looks for its end
+    if (m_indexStatus == IndexStatus::Valid) {
+      int index = indexOfRecordInIndex(record);
+      assert(index >= 0);
+      m_numberOfIndexedRecords--;
+      memmove(m_index + index, m_index + index + 1, (m_numberOfIndexedRecords - index) * sizeof(IndexEntry));
+    } else {
+      m_indexStatus = IndexStatus::Invalid;
+    }
     notifyChangeToDelegate();
   }
 }
@@ -408,6 +621,16 @@ char * Storage::pointerOfRecord(const Record record) const {
     assert(m_lastRecordRetrievedPointer != nullptr);
     return m_lastRecordRetrievedPointer;
   }
+  if (updateIndex()) {
+    int index = indexOfRecordInIndex(record);
+    if (index < 0) {
+      return nullptr;
+    }
+    char * p = (char *)m_buffer + m_index[index].offset;
+    m_lastRecordRetrieved = record;
+    m_lastRecordRetrievedPointer = p;
+    return p;
+  }
   for (char * p : *this) {
     Record currentRecord(fullNameOfRecordStarting(p));
     if (record == currentRecord) {
@@ -420,7 +643,11 @@ char * Storage::pointerOfRecord(const Record record) const {
 }
 
 Storage::record_size_t Storage::sizeOfRecordStarting(char * start) const {
-  return StorageHelper::unalignedShort(start);
+  return StorageHelper::unalignedShort(start) & ~k_compressedRecordFlag;
+}
+
+bool Storage::recordIsCompressedStarting(char * start) const {
+  return (StorageHelper::unalignedShort(start) & k_compressedRecordFlag) != 0;
 }
 
 const char * Storage::fullNameOfRecordStarting(char * start) const {
@@ -433,8 +660,9 @@ const void * Storage::valueOfRecordStarting(char * start) const {
   return currentChar+fullNameLength+1;
 }
 
-size_t Storage::overrideSizeAtPosition(char * position, record_size_t size) {
-  StorageHelper::writeUnalignedShort(size, position);
+size_t Storage::overrideSizeAtPosition(char * position, record_size_t size, bool compressed) {
+  assert(size < k_maxRecordSize);
+  StorageHelper::writeUnalignedShort(compressed ? size | k_compressedRecordFlag : size, position);
   return sizeof(record_size_t);
 }
 
@@ -473,6 +701,14 @@ bool Storage::isNameOfRecordTaken(Record r, const Record * recordToExclude) {
      * name is nullptr. */
     return true;
   }
+  if (updateIndex()) {
+    for (int i = 0; i < m_numberOfIndexedRecords; i++) {
+      if (m_index[i].fullNameCRC32 == r.m_fullNameCRC32 && !(recordToExclude && r == *recordToExclude)) {
+        return true;
+      }
+    }
+    return false;
+  }
   for (char * p : *this) {
     Record s(fullNameOfRecordStarting(p));
     if (recordToExclude && s == *recordToExclude) {
@@ -512,6 +748,13 @@ bool Storage::FullNameHasExtension(const char * fullName, const char * extension
 }
 
 char * Storage::endBuffer() {
+  if (updateIndex()) {
+    if (m_numberOfIndexedRecords == 0) {
+      return m_buffer;
+    }
+    char * lastRecord = m_buffer + m_index[m_numberOfIndexedRecords-1].offset;
+    return lastRecord + sizeOfRecordStarting(lastRecord);
+  }
   char * currentBuffer = m_buffer;
   for (char * p : *this) {
     currentBuffer += sizeOfRecordStarting(p);
@@ -534,18 +777,442 @@ size_t Storage::sizeOfRecordWithFullName(const char * fullName, size_t dataSize)
 }
 
 bool Storage::slideBuffer(char * position, int delta) {
-  if (delta > (int)availableSize()) {
+  // The callers check that the room to decompress records is kept
+  if (delta > (int)freeSize()) {
     return false;
   }
+  if (delta == 0) {
+    return true;
+  }
   memmove(position+delta, position, endBuffer()+sizeof(record_size_t)-position);
+  if (m_indexStatus == IndexStatus::Valid) {
+    for (int i = 0; i < m_numberOfIndexedRecords; i++) {
+      if (m_buffer + m_index[i].offset >= position) {
+        m_index[i].offset += delta;
+      }
+    }
+  }
+  return true;
+}
+
+void Storage::journalChange(const Record record) const {
+  m_changeJournal[m_changeGeneration % k_changeJournalLength] = record.m_fullNameCRC32;
+  m_changeGeneration++;
+  if (record.isNull() || m_decompressedRecordCRC32 == record.m_fullNameCRC32) {
+    m_decompressedRecordCRC32 = 0;
+  }
+  if (!record.isNull()) {
+    recordWasAccessed(record);
+  }
+  for (int i = 0; i < k_numberOfIncompressibleRecords; i++) {
+    if (record.isNull() || m_incompressibleRecords[i] == record.m_fullNameCRC32) {
+      m_incompressibleRecords[i] = 0;
+    }
+  }
+}
+
+Storage::Record::ErrorStatus Storage::replaceBodyRangeOfRecord(Record record, size_t offset, size_t removedSize, const void * data, size_t insertedSize, bool valueChanges) {
+  char * p = pointerOfRecord(record);
+  assert(p != nullptr);
+  record_size_t previousRecordSize = sizeOfRecordStarting(p);
+  size_t newRecordSize = previousRecordSize - removedSize + insertedSize;
+  if (newRecordSize >= k_maxRecordSize) {
+    return notifyFullnessToDelegate();
+  }
+  if (insertedSize > removedSize && insertedSize - removedSize > availableSizeToWrite(record)) {
+    if (!compressColdRecords(insertedSize - removedSize, record, &data)) {
+      return notifyFullnessToDelegate();
+    }
+    p = pointerOfRecord(record);
+  }
+  bool wasCompressed = recordIsCompressedStarting(p);
+  char * position = static_cast<char *>(const_cast<void *>(valueOfRecordStarting(p))) + offset;
+  assert(position + removedSize <= p + previousRecordSize);
+  // A compressed body can only be replaced as a whole
+  assert(!recordIsCompressedStarting(p) || (offset == 0 && position + removedSize == p + previousRecordSize));
+  if (!slideBuffer(position + removedSize, insertedSize - removedSize)) {
+    return notifyFullnessToDelegate();
+  }
+  overrideSizeAtPosition(p, newRecordSize);
+  if (insertedSize > 0) {
+    // data may be the value itself, written in place
+    memmove(position, data, insertedSize);
+  }
+  if (wasCompressed) {
+    updateMagic();
+  }
+  if (valueChanges) {
+    notifyChangeToDelegate(record);
+  }
+  m_lastRecordRetrieved = record;
+  m_lastRecordRetrievedPointer = p;
+  if (availableSize() < k_minAvailableSize) {
+    compressColdRecords(k_minAvailableSize, record);
+  }
+  return Record::ErrorStatus::None;
+}
+
+Storage::CompressionStatistics Storage::compressionStatistics() {
+  CompressionStatistics statistics = {
+    .numberOfCompressedRecords = 0,
+    .compressedSize = 0,
+    .uncompressedSize = 0,
+    .numberOfDecompressions = m_numberOfDecompressions,
+    .numberOfCacheHits = m_numberOfCacheHits
+  };
+  for (char * p : *this) {
+    if (recordIsCompressedStarting(p)) {
+      const char * body = static_cast<const char *>(valueOfRecordStarting(p));
+      statistics.numberOfCompressedRecords++;
+      statistics.compressedSize += p + sizeOfRecordStarting(p) - body;
+      statistics.uncompressedSize += uncompressedSizeOfRecordStarting(p);
+    }
+  }
+  return statistics;
+}
+
+size_t Storage::freeSize() {
+  return k_storageSize-(endBuffer()-m_buffer)-sizeof(record_size_t);
+}
+
+size_t Storage::availableSizeToWrite(const Record record) {
+  size_t size = freeSize();
+  size_t reserve = decompressionReserve(record);
+  return size > reserve ? size - reserve : 0;
+}
+
+size_t Storage::decompressionReserve(const Record recordToExclude) {
+  // The magic tells whether there are compressed records
+  if (m_magicHeader != CompressedMagic) {
+    return 0;
+  }
+  size_t reserve = 0;
+  for (char * p : *this) {
+    if (recordIsCompressedStarting(p) && (recordToExclude.isNull() || Record(fullNameOfRecordStarting(p)) != recordToExclude)) {
+      size_t valueSize = uncompressedSizeOfRecordStarting(p);
+      reserve = valueSize > reserve ? valueSize : reserve;
+    }
+  }
+  return reserve;
+}
+
+size_t Storage::uncompressedSizeOfRecordStarting(char * start) const {
+  assert(recordIsCompressedStarting(start));
+  return StorageHelper::unalignedShort(static_cast<char *>(const_cast<void *>(valueOfRecordStarting(start))));
+}
+
+bool Storage::recordIsCompressible(char * start) const {
+  if (!FullNameHasExtension(fullNameOfRecordStarting(start), pyExtension, strlen(pyExtension))) {
+    return false;
+  }
+  size_t valueSize = start + sizeOfRecordStarting(start) - static_cast<const char *>(valueOfRecordStarting(start));
+  return valueSize >= k_minCompressibleValueSize;
+}
+
+size_t Storage::compressRecordStarting(char * start, char * scratch, size_t scratchSize) const {
+  const char * value = static_cast<const char *>(valueOfRecordStarting(start));
+  size_t valueSize = start + sizeOfRecordStarting(start) - value;
+  // The compressed body, with the uncompressed size, must be smaller
+  size_t maxBodySize = valueSize - 1 < scratchSize ? valueSize - 1 : scratchSize;
+  if (maxBodySize <= sizeof(record_size_t)) {
+    return 0;
+  }
+  LZ4_stream_t state;
+  // lz4.c has to be built with the same LZ4_MEMORY_USAGE
+  assert(LZ4_sizeofState() == sizeof(state));
+  int compressedSize = LZ4_compress_fast_extState(&state, value, scratch + sizeof(record_size_t), valueSize, maxBodySize - sizeof(record_size_t), 1);
+  if (compressedSize <= 0) {
+    return 0;
+  }
+  StorageHelper::writeUnalignedShort(valueSize, scratch);
+  return sizeof(record_size_t) + compressedSize;
+}
+
+void Storage::writeCompressedBodyOfRecordStarting(char * start, const char * body, size_t bodySize) {
+  char * value = static_cast<char *>(const_cast<void *>(valueOfRecordStarting(start)));
+  record_size_t recordSize = sizeOfRecordStarting(start);
+  size_t valueSize = start + recordSize - value;
+  assert(bodySize < valueSize);
+  memcpy(value, body, bodySize);
+  slideBuffer(value + valueSize, bodySize - valueSize);
+  overrideSizeAtPosition(start, recordSize - valueSize + bodySize, true);
+}
+
+char * Storage::coldRecordStarting(uint32_t minKey, uint32_t * key, const Record recordToKeep, const void * data) {
+  bool indexIsValid = updateIndex();
+  const char * d = static_cast<const char *>(data);
+  char * coldRecord = nullptr;
+  int ordinal = 0;
+  for (char * p : *this) {
+    /* Records are keyed by the age of their last access, the oldest first, and
+     * then by their position. */
+    uint16_t age = indexIsValid ? m_accessGeneration - m_index[ordinal].lastAccess : 0;
+    uint32_t currentKey = (static_cast<uint32_t>(UINT16_MAX - age) << 16) | ordinal;
+    ordinal++;
+    if (currentKey < minKey || (coldRecord != nullptr && currentKey >= *key) || recordIsCompressedStarting(p) || !recordIsCompressible(p) || (d >= p && d < p + sizeOfRecordStarting(p))) {
+      continue;
+    }
+    Record currentRecord;
+    if (indexIsValid) {
+      currentRecord.m_fullNameCRC32 = m_index[ordinal - 1].fullNameCRC32;
+    } else {
+      currentRecord = Record(fullNameOfRecordStarting(p));
+    }
+    if (currentRecord == recordToKeep || recordIsIncompressible(currentRecord)) {
+      continue;
+    }
+    coldRecord = p;
+    *key = currentKey;
+  }
+  return coldRecord;
+}
+
+bool Storage::compressColdRecords(size_t size, const Record recordToKeep, const void ** data) {
+  if (availableSizeToWrite(recordToKeep) >= size) {
+    return true;
+  }
+  const char * d = data == nullptr ? nullptr : static_cast<const char *>(*data);
+  if (!m_compressionEnabled || isInFreeSpace(d)) {
+    return false;
+  }
+  /* As the free space keeps room to decompress the largest compressed value,
+   * compressing a larger one first costs room. The coldest records are thus
+   * compressed in the free space first, to find how many of them are worth
+   * compressing, and only then written. */
+  m_decompressedRecordCRC32 = 0;
+  size_t initialFreeSize = freeSize();
+  char * scratch = endBuffer() + sizeof(record_size_t);
+  size_t reserve = decompressionReserve(recordToKeep);
+  size_t savedSize = 0;
+  size_t bestAvailableSize = availableSizeToWrite(recordToKeep);
+  bool shouldCompress = false;
+  uint32_t lastKey = 0;
+  uint32_t minKey = 0;
+  uint32_t key;
+  char * p;
+  while ((p = coldRecordStarting(minKey, &key, recordToKeep, d)) != nullptr) {
+    minKey = key + 1;
+    size_t valueSize = p + sizeOfRecordStarting(p) - static_cast<const char *>(valueOfRecordStarting(p));
+    size_t bodySize = compressRecordStarting(p, scratch, initialFreeSize);
+    if (bodySize == 0) {
+      if (initialFreeSize >= valueSize) {
+        // The scratch did not limit the compression
+        m_incompressibleRecords[m_nextIncompressibleRecord] = Record(fullNameOfRecordStarting(p)).m_fullNameCRC32;
+        m_nextIncompressibleRecord = (m_nextIncompressibleRecord + 1) % k_numberOfIncompressibleRecords;
+      }
+      continue;
+    }
+    savedSize += valueSize - bodySize;
+    reserve = valueSize > reserve ? valueSize : reserve;
+    size_t availableSize = initialFreeSize + savedSize > reserve ? initialFreeSize + savedSize - reserve : 0;
+    if (availableSize > bestAvailableSize) {
+      bestAvailableSize = availableSize;
+      shouldCompress = true;
+      lastKey = key;
+    }
+    if (availableSize >= size) {
+      break;
+    }
+  }
+  if (!shouldCompress) {
+    return false;
+  }
+  minKey = 0;
+  while ((p = coldRecordStarting(minKey, &key, recordToKeep, d)) != nullptr && key <= lastKey) {
+    minKey = key + 1;
+    scratch = endBuffer() + sizeof(record_size_t);
+    size_t bodySize = compressRecordStarting(p, scratch, freeSize());
+    if (bodySize == 0) {
+      continue;
+    }
+    const char * value = static_cast<const char *>(valueOfRecordStarting(p));
+    size_t valueSize = p + sizeOfRecordStarting(p) - value;
+    if (d != nullptr && d > p) {
+      // data follows the compressed record
+      d -= valueSize - bodySize;
+    }
+    writeCompressedBodyOfRecordStarting(p, scratch, bodySize);
+  }
+  if (data != nullptr) {
+    *data = d;
+  }
+  // The records following a compressed one have moved
+  m_lastRecordRetrieved = Record();
+  m_lastRecordRetrievedPointer = nullptr;
+  updateMagic();
+  return availableSizeToWrite(recordToKeep) >= size;
+}
+
+bool Storage::makeRoomToDecompressRecordStarting(char * start, const Record record) {
+  const char * body = static_cast<const char *>(valueOfRecordStarting(start));
+  size_t bodySize = start + sizeOfRecordStarting(start) - body;
+  size_t valueSize = uncompressedSizeOfRecordStarting(start);
+  return valueSize <= bodySize || compressColdRecords(valueSize - bodySize, record);
+}
+
+static void reverse(char * first, char * last) {
+  while (first + 1 < last) {
+    last--;
+    char c = *first;
+    *first = *last;
+    *last = c;
+    first++;
+  }
+}
+
+void Storage::decompressRecordStarting(char * start) {
+  char * body = static_cast<char *>(const_cast<void *>(valueOfRecordStarting(start)));
+  record_size_t recordSize = sizeOfRecordStarting(start);
+  size_t bodySize = start + recordSize - body;
+  char * end = endBuffer();
+  // The free space keeps room for the value
+  assert(freeSize() >= uncompressedSizeOfRecordStarting(start));
+  m_decompressedRecordCRC32 = 0;
+  int size;
+  {
+    Profiling::SectionScope decompressionScope(Profiling::Section::Decompression);
+    size = LZ4_decompress_safe(body + sizeof(record_size_t), end, bodySize - sizeof(record_size_t), uncompressedSizeOfRecordStarting(start));
+  }
+  // The buffer may have been corrupted from outside of the Storage
+  assert(size == (int)uncompressedSizeOfRecordStarting(start));
+  size_t valueSize = size < 0 ? 0 : size;
+  m_numberOfDecompressions++;
+  /* | Body | Following records | Value | is rotated into
+   * | Body | Value | Following records |, and the body is removed. */
+  reverse(body + bodySize, end);
+  reverse(end, end + valueSize);
+  reverse(body + bodySize, end + valueSize);
+  memmove(body, body + bodySize, end + valueSize - (body + bodySize));
+  int delta = valueSize - bodySize;
+  if (m_indexStatus == IndexStatus::Valid) {
+    for (int i = 0; i < m_numberOfIndexedRecords; i++) {
+      if (m_buffer + m_index[i].offset > start) {
+        m_index[i].offset += delta;
+      }
+    }
+  }
+  overrideSizeAtPosition(start, recordSize + delta);
+  overrideSizeAtPosition(end + delta, 0);
+}
+
+bool Storage::isInFreeSpace(const void * data) {
+  const char * d = static_cast<const char *>(data);
+  return d >= endBuffer() && d < m_buffer + k_storageSize;
+}
+
+bool Storage::recordIsIncompressible(const Record record) const {
+  for (int i = 0; i < k_numberOfIncompressibleRecords; i++) {
+    if (m_incompressibleRecords[i] == record.m_fullNameCRC32) {
+      return true;
+    }
+  }
+  return false;
+}
+
+Storage::Record::Data Storage::decompressedValueOfRecordStarting(char * start, const Record record) {
+  size_t valueSize = uncompressedSizeOfRecordStarting(start);
+  // The value is decompressed at the end of the free space, which keeps room for it
+  char * value = m_buffer + k_storageSize - valueSize;
+  if (m_decompressedRecordCRC32 == record.m_fullNameCRC32) {
+    m_numberOfCacheHits++;
+    return {.buffer = value, .size = valueSize};
+  }
+  if (valueSize > freeSize()) {
+    // The buffer was corrupted from outside of the Storage
+    return {.buffer = nullptr, .size = 0};
+  }
+  Profiling::SectionScope decompressionScope(Profiling::Section::Decompression);
+  const char * body = static_cast<const char *>(valueOfRecordStarting(start));
+  int compressedSize = start + sizeOfRecordStarting(start) - body - sizeof(record_size_t);
+  int size = LZ4_decompress_safe(body + sizeof(record_size_t), value, compressedSize, valueSize);
+  // The buffer may have been corrupted from outside of the Storage
+  assert(size == (int)valueSize);
+  m_decompressedRecordCRC32 = record.m_fullNameCRC32;
+  m_numberOfDecompressions++;
+  return {.buffer = value, .size = size < 0 ? 0 : valueSize};
+}
+
+void Storage::updateMagic() {
+  uint32_t magic = Magic;
+  for (char * p : *this) {
+    if (recordIsCompressedStarting(p)) {
+      magic = CompressedMagic;
+      break;
+    }
+  }
+  m_magicHeader = magic;
+  m_magicFooter = magic;
+}
+
+void Storage::recordWasAccessed(const Record record) const {
+  if (!m_compressionEnabled || record == m_lastAccessedRecord || !updateIndex()) {
+    return;
+  }
+  int index = indexOfRecordInIndex(record);
+  if (index >= 0) {
+    m_index[index].lastAccess = ++m_accessGeneration;
+    m_lastAccessedRecord = record;
+  }
+}
+
+uint32_t Storage::ExtensionCRC32(const char * extension) {
+  return Ion::crc32Byte((const uint8_t *)extension, strlen(extension));
+}
+
+bool Storage::updateIndex() const {
+  if (m_indexStatus == IndexStatus::Invalid) {
+    m_numberOfIndexedRecords = 0;
+    m_indexStatus = IndexStatus::Valid;
+    for (char * p : *this) {
+      indexRecordStarting(p, Record(fullNameOfRecordStarting(p)).m_fullNameCRC32);
+      if (m_indexStatus != IndexStatus::Valid) {
+        break;
+      }
+    }
+  }
+  return m_indexStatus == IndexStatus::Valid;
+}
+
+int Storage::indexOfRecordInIndex(const Record record) const {
+  assert(m_indexStatus == IndexStatus::Valid);
+  for (int i = 0; i < m_numberOfIndexedRecords; i++) {
+    if (m_index[i].fullNameCRC32 == record.m_fullNameCRC32) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+bool Storage::fillIndexEntry(IndexEntry * entry, char * start, uint32_t fullNameCRC32) const {
+  /* With a single dot in each name, a record has an extension if and only if
+   * it follows the dot, and its CRC32 is the one of the Record built from its
+   * base name and extension. */
+  const char * fullName = fullNameOfRecordStarting(start);
+  const char * dotChar = strchr(fullName, k_dotChar);
+  if (dotChar == nullptr || strchr(dotChar+1, k_dotChar) != nullptr) {
+    return false;
+  }
+  entry->fullNameCRC32 = fullNameCRC32;
+  entry->extensionCRC32 = ExtensionCRC32(dotChar+1);
+  entry->offset = start - m_buffer;
   return true;
 }
 
+void Storage::indexRecordStarting(char * start, uint32_t fullNameCRC32) const {
+  assert(m_indexStatus == IndexStatus::Valid);
+  if (m_numberOfIndexedRecords >= k_maxNumberOfIndexedRecords || !fillIndexEntry(m_index + m_numberOfIndexedRecords, start, fullNameCRC32)) {
+    m_indexStatus = IndexStatus::Unavailable;
+    return;
+  }
+  m_index[m_numberOfIndexedRecords].lastAccess = m_accessGeneration;
+  m_numberOfIndexedRecords++;
+}
+
 Storage::RecordIterator & Storage::RecordIterator::operator++() {
   assert(m_recordStart);
-  record_size_t size = StorageHelper::unalignedShort(m_recordStart);
+  record_size_t size = StorageHelper::unalignedShort(m_recordStart) & ~k_compressedRecordFlag;
   char * nextRecord = m_recordStart+size;
-  record_size_t newRecordSize = StorageHelper::unalignedShort(nextRecord);
+  record_size_t newRecordSize = StorageHelper::unalignedShort(nextRecord) & ~k_compressedRecordFlag;
   m_recordStart = (newRecordSize == 0 ? nullptr : nextRecord);
   return *this;
 }
@@ -4,6 +4,7 @@
 #include "events.h"
 
 #include <ion/events.h>
+#include <ion/profiling.h>
 #include <layout_events.h>
 
 #include <string.h>
@@ -19,6 +20,15 @@ namespace Ion {
 namespace Events {
 
 Event getPlatformEvent() {
+#if ION_PROFILING
+  static Ion::Events::Event sLastEvent = Ion::Events::None;
+  static int sNumberOfProfiledEvents = 0;
+  if (sNumberOfProfiledEvents == 0) {
+    Profiling::printHeader();
+  } else {
+    Profiling::printEvent("stdin", sNumberOfProfiledEvents - 1, sLastEvent.id());
+  }
+#endif
   Ion::Events::Event event = Ion::Events::None;
   while (!(event.isDefined() && event.isKeyboardEvent())) {
     int c = getchar();
@@ -38,6 +48,11 @@ Event getPlatformEvent() {
     printf("Event %d is %s\n", sEventCount, event.name());
 #endif
   }
+#endif
+#if ION_PROFILING
+  sLastEvent = event;
+  sNumberOfProfiledEvents++;
+  Profiling::startEvent();
 #endif
   return event;
 }
@@ -141,3 +141,357 @@ QUIZ_CASE(ion_storage_valid_renaming) {
   quiz_assert(newRetreivedRecord == Storage::Record());
   quiz_assert(Storage::sharedStorage()->availableSize() == initialStorageAvailableStage);
 }
+
+/* The records are looked up in the index of the storage when it is available,
+ * and by walking the buffer otherwise. The expected names are listed in the
+ * order of the buffer. */
+static void assert_records_with_extension_are(const char * extension, const char * const * fullNames, int numberOfFullNames) {
+  Storage * storage = Storage::sharedStorage();
+  quiz_assert(storage->numberOfRecordsWithExtension(extension) == numberOfFullNames);
+  for (int i = 0; i < numberOfFullNames; i++) {
+    Storage::Record record = storage->recordWithExtensionAtIndex(extension, i);
+    quiz_assert(strcmp(record.fullName(), fullNames[i]) == 0);
+    quiz_assert(storage->recordNamed(fullNames[i]) == record);
+    quiz_assert(strcmp(static_cast<const char *>(record.value().buffer), fullNames[i]) == 0);
+  }
+  quiz_assert(storage->recordWithExtensionAtIndex(extension, numberOfFullNames).isNull());
+}
+
+static void put_record_named_after_itself(const char * fullName) {
+  // The value of the record is its name, with its null terminating char
+  quiz_assert(Storage::sharedStorage()->createRecordWithFullName(fullName, fullName, strlen(fullName) + 1) == Storage::Record::ErrorStatus::None);
+}
+
+QUIZ_CASE(ion_storage_index) {
+  Storage * storage = Storage::sharedStorage();
+  size_t initialStorageAvailableStage = storage->availableSize();
+
+  put_record_named_after_itself("a.idx1");
+  put_record_named_after_itself("b.idx2");
+  put_record_named_after_itself("c.idx1");
+  put_record_named_after_itself("d.idx2");
+  {
+    const char * idx1[] = {"a.idx1", "c.idx1"};
+    const char * idx2[] = {"b.idx2", "d.idx2"};
+    assert_records_with_extension_are("idx1", idx1, 2);
+    assert_records_with_extension_are("idx2", idx2, 2);
+    quiz_assert(storage->createRecordWithFullName("c.idx1", "", 1) == Storage::Record::ErrorStatus::NameTaken);
+  }
+
+  // Renaming keeps the position of the record in the buffer
+  quiz_assert(storage->recordNamed("a.idx1").setName("aa.idx2") == Storage::Record::ErrorStatus::None);
+  quiz_assert(storage->recordNamed("a.idx1").isNull());
+  {
+    const char * value = "aa.idx2";
+    quiz_assert(storage->recordNamed("aa.idx2").setValue({.buffer = value, .size = strlen(value) + 1}) == Storage::Record::ErrorStatus::None);
+    const char * idx1[] = {"c.idx1"};
+    const char * idx2[] = {"aa.idx2", "b.idx2", "d.idx2"};
+    assert_records_with_extension_are("idx1", idx1, 1);
+    assert_records_with_extension_are("idx2", idx2, 3);
+    const char * extensions[] = {"idx1", "idx2"};
+    quiz_assert(storage->recordBaseNamedWithExtensions("aa", extensions, 2) == storage->recordNamed("aa.idx2"));
+  }
+
+  // Destroying a record moves the next ones
+  storage->recordNamed("b.idx2").destroy();
+  {
+    const char * idx2[] = {"aa.idx2", "d.idx2"};
+    assert_records_with_extension_are("idx2", idx2, 2);
+  }
+
+  // Names with several dots are looked up by walking the buffer
+  put_record_named_after_itself("e.f.idx1");
+  {
+    const char * idx1[] = {"c.idx1", "e.f.idx1"};
+    assert_records_with_extension_are("idx1", idx1, 2);
+    assert_records_with_extension_are("f.idx1", idx1 + 1, 1);
+  }
+  storage->recordNamed("e.f.idx1").destroy();
+
+  storage->destroyRecordsWithExtension("idx1");
+  storage->destroyRecordsWithExtension("idx2");
+  quiz_assert(storage->numberOfRecordsWithExtension("idx1") == 0);
+  quiz_assert(storage->availableSize() == initialStorageAvailableStage);
+}
+
+QUIZ_CASE(ion_storage_index_overflow) {
+  Storage * storage = Storage::sharedStorage();
+  size_t initialStorageAvailableStage = storage->availableSize();
+  constexpr int numberOfRecords = 150;
+  char fullNames[numberOfRecords][8];
+  const char * names[numberOfRecords];
+  for (int i = 0; i < numberOfRecords; i++) {
+    fullNames[i][0] = 'r';
+    fullNames[i][1] = '0' + i / 100;
+    fullNames[i][2] = '0' + (i / 10) % 10;
+    fullNames[i][3] = '0' + i % 10;
+    strlcpy(fullNames[i] + 4, ".ix", 4);
+    names[i] = fullNames[i];
+    put_record_named_after_itself(names[i]);
+  }
+  // There are more records than the index can hold
+  assert_records_with_extension_are("ix", names, numberOfRecords);
+
+  // The index is rebuilt once enough records are destroyed
+  for (int i = 0; i < numberOfRecords - 10; i++) {
+    storage->recordNamed(names[i]).destroy();
+  }
+  assert_records_with_extension_are("ix", names + numberOfRecords - 10, 10);
+
+  storage->destroyRecordsWithExtension("ix");
+  quiz_assert(storage->availableSize() == initialStorageAvailableStage);
+}
+
+static void assert_value_is(Storage::Record record, const char * value) {
+  quiz_assert(record.value().size == strlen(value) + 1);
+  quiz_assert(strcmp(static_cast<const char *>(record.value().buffer), value) == 0);
+}
+
+QUIZ_CASE(ion_storage_partial_updates) {
+  Storage * storage = Storage::sharedStorage();
+  size_t initialStorageAvailableStage = storage->availableSize();
+  put_record_named_after_itself("a.edit");
+  put_record_named_after_itself("b.edit");
+  Storage::Record a = storage->recordNamed("a.edit");
+  Storage::Record b = storage->recordNamed("b.edit");
+
+  // Setting the value a record already has changes nothing
+  uint32_t generation = storage->changeGeneration();
+  const char * value = "a.edit";
+  quiz_assert(a.setValue({.buffer = value, .size = strlen(value) + 1}) == Storage::Record::ErrorStatus::None);
+  quiz_assert(storage->changeGeneration() == generation);
+  quiz_assert(!storage->recordDidChangeSince(a, generation));
+
+  // Values are edited in the middle, at their ends, and grow and shrink
+  const char * values[] = {"abc.edit", "ab.edit", "xab.edit", "xab.edit2", "x", "", "x.edit"};
+  for (const char * v : values) {
+    quiz_assert(a.setValue({.buffer = v, .size = strlen(v) + 1}) == Storage::Record::ErrorStatus::None);
+    assert_value_is(a, v);
+    assert_value_is(b, "b.edit");
+  }
+  quiz_assert(storage->recordDidChangeSince(a, generation));
+  quiz_assert(!storage->recordDidChangeSince(b, generation));
+
+  // Ranges of the value are replaced with data of another size
+  quiz_assert(a.replaceValueRange(1, 0, "yz", 2) == Storage::Record::ErrorStatus::None);
+  assert_value_is(a, "xyz.edit");
+  quiz_assert(a.replaceValueRange(0, 4, "w", 1) == Storage::Record::ErrorStatus::None);
+  assert_value_is(a, "wedit");
+  assert_value_is(b, "b.edit");
+  quiz_assert(b.replaceValueRange(0, 0, nullptr, storage->availableSize() + 1) == Storage::Record::ErrorStatus::NotEnoughSpaceAvailable);
+  assert_value_is(b, "b.edit");
+
+  // Patches overwrite the value in place and are journaled
+  generation = storage->changeGeneration();
+  quiz_assert(b.patchValue(1, "_", 1) == Storage::Record::ErrorStatus::None);
+  assert_value_is(b, "b_edit");
+  quiz_assert(storage->recordDidChangeSince(b, generation));
+  quiz_assert(!storage->recordDidChangeSince(a, generation));
+  generation = storage->changeGeneration();
+  quiz_assert(b.patchValue(1, "_", 1) == Storage::Record::ErrorStatus::None);
+  quiz_assert(storage->changeGeneration() == generation);
+
+  // Renaming changes both names, destroying a record changes every record
+  quiz_assert(a.setName("c.edit") == Storage::Record::ErrorStatus::None);
+  quiz_assert(storage->recordDidChangeSince(a, generation));
+  quiz_assert(storage->recordDidChangeSince(storage->recordNamed("c.edit"), generation));
+  quiz_assert(!storage->recordDidChangeSince(b, generation));
+  storage->recordNamed("c.edit").destroy();
+  quiz_assert(storage->recordDidChangeSince(b, generation));
+
+  // The oldest changes are forgotten
+  generation = storage->changeGeneration();
+  for (int i = 0; i < 20; i++) {
+    char c = 'a' + i;
+    quiz_assert(storage->recordNamed("b.edit").patchValue(0, &c, 1) == Storage::Record::ErrorStatus::None);
+  }
+  quiz_assert(storage->recordDidChangeSince(Storage::Record("d.edit"), generation));
+
+  storage->destroyRecordsWithExtension("edit");
+  quiz_assert(storage->availableSize() == initialStorageAvailableStage);
+}
+
+static void fill_script(char * buffer, size_t size, int index) {
+  // Scripts are made of repeated lines, shifted by their index
+  const char * line = "for i in range(10):\n  print(i)\n";
+  size_t lineLength = strlen(line);
+  buffer[0] = 0;
+  for (size_t i = 1; i < size - 1; i++) {
+    buffer[i] = line[(i + index) % lineLength];
+  }
+  buffer[size - 1] = 0;
+}
+
+namespace Ion {
+extern uint32_t staticStorageArea[];
+}
+
+static uint32_t storage_magic() {
+  // The storage starts with its magic
+  return staticStorageArea[0];
+}
+
+static bool script_is_intact(const char * fullName, int index, size_t size) {
+  char expected[4000];
+  assert(size <= sizeof(expected));
+  fill_script(expected, size, index);
+  Storage::Record::Data value = Storage::sharedStorage()->recordNamed(fullName).value();
+  return value.size == size && memcmp(value.buffer, expected, size) == 0;
+}
+
+static bool script_is_compressed(const char * fullName) {
+  // Reading a compressed record decompresses it, unless it was the last one read
+  Storage * storage = Storage::sharedStorage();
+  Storage::CompressionStatistics statistics = storage->compressionStatistics();
+  storage->recordNamed(fullName).value();
+  Storage::CompressionStatistics newStatistics = storage->compressionStatistics();
+  return newStatistics.numberOfDecompressions + newStatistics.numberOfCacheHits > statistics.numberOfDecompressions + statistics.numberOfCacheHits;
+}
+
+QUIZ_CASE(ion_storage_compression) {
+  Storage * storage = Storage::sharedStorage();
+  size_t initialStorageAvailableStage = storage->availableSize();
+  uint32_t uncompressedMagic = storage_magic();
+  bool compressionEnabled = storage->compressionEnabled();
+  constexpr int numberOfScripts = 8;
+  // Larger than a kilobyte, for the value of the largest script to be kept free
+  constexpr size_t scriptSize = 3000;
+  quiz_assert(numberOfScripts * scriptSize > initialStorageAvailableStage);
+  char fullNames[numberOfScripts][8] = {"s0.py", "s1.py", "s2.py", "s3.py", "s4.py", "s5.py", "s6.py", "s7.py"};
+  char script[scriptSize];
+
+  // Without compression, the scripts do not fit and the format is kept
+  storage->setCompressionEnabled(false);
+  int numberOfCreatedScripts = 0;
+  for (int i = 0; i < numberOfScripts; i++) {
+    fill_script(script, scriptSize, i);
+    if (storage->createRecordWithFullName(fullNames[i], script, scriptSize) == Storage::Record::ErrorStatus::None) {
+      numberOfCreatedScripts++;
+    }
+  }
+  quiz_assert(numberOfCreatedScripts < numberOfScripts);
+  quiz_assert(storage->compressionStatistics().numberOfCompressedRecords == 0);
+  quiz_assert(storage_magic() == uncompressedMagic);
+  storage->destroyRecordsWithExtension("py");
+
+  // The scripts fit once the previous ones are compressed
+  storage->setCompressionEnabled(true);
+  for (int i = 0; i < numberOfScripts; i++) {
+    fill_script(script, scriptSize, i);
+    quiz_assert(storage->createRecordWithFullName(fullNames[i], script, scriptSize) == Storage::Record::ErrorStatus::None);
+  }
+  Storage::CompressionStatistics statistics = storage->compressionStatistics();
+  quiz_assert(statistics.numberOfCompressedRecords > 0);
+  quiz_assert(statistics.compressedSize < statistics.uncompressedSize);
+  // Readers unaware of compression reject the storage
+  quiz_assert(storage_magic() != uncompressedMagic);
+  for (int i = 0; i < numberOfScripts; i++) {
+    quiz_assert(script_is_intact(fullNames[i], i, scriptSize));
+  }
+
+  // Compressed values are decompressed once while they are read
+  Storage::Record s0 = storage->recordNamed(fullNames[0]);
+  quiz_assert(script_is_compressed(fullNames[0]));
+  s0.value();
+  statistics = storage->compressionStatistics();
+  s0.value();
+  quiz_assert(storage->compressionStatistics().numberOfDecompressions == statistics.numberOfDecompressions);
+  quiz_assert(storage->compressionStatistics().numberOfCacheHits == statistics.numberOfCacheHits + 1);
+
+  // Compressed values are written uncompressed
+  uint32_t generation = storage->changeGeneration();
+  char importationStatus = 1;
+  quiz_assert(s0.patchValue(0, &importationStatus, 1) == Storage::Record::ErrorStatus::None);
+  quiz_assert(storage->recordDidChangeSince(s0, generation));
+  quiz_assert(!script_is_compressed(fullNames[0]));
+  quiz_assert(static_cast<const char *>(s0.value().buffer)[0] == 1);
+  quiz_assert(s0.replaceValueRange(0, 1, "", 0) == Storage::Record::ErrorStatus::None);
+  fill_script(script, scriptSize, 0);
+  quiz_assert(s0.value().size == scriptSize - 1 && memcmp(s0.value().buffer, script + 1, scriptSize - 1) == 0);
+
+  // Compressed records keep their value when renamed or decompressed
+  Storage::Record s1 = storage->recordNamed(fullNames[1]);
+  quiz_assert(script_is_compressed(fullNames[1]));
+  quiz_assert(s1.setName("t1.py") == Storage::Record::ErrorStatus::None);
+  strlcpy(fullNames[1], "t1.py", sizeof(fullNames[1]));
+  quiz_assert(script_is_intact(fullNames[1], 1, scriptSize));
+  generation = storage->changeGeneration();
+  quiz_assert(storage->recordNamed(fullNames[1]).decompress() == Storage::Record::ErrorStatus::None);
+  quiz_assert(!storage->recordDidChangeSince(storage->recordNamed(fullNames[1]), generation));
+  quiz_assert(!script_is_compressed(fullNames[1]));
+  quiz_assert(script_is_intact(fullNames[1], 1, scriptSize));
+
+  // A compressed record can be copied from its decompressed value
+  for (int i = 2; i < numberOfScripts; i++) {
+    if (script_is_compressed(fullNames[i])) {
+      Storage::Record::Data value = storage->recordNamed(fullNames[i]).value();
+      quiz_assert(storage->createRecordWithFullName("u.py", value.buffer, value.size) == Storage::Record::ErrorStatus::None);
+      quiz_assert(script_is_intact("u.py", i, scriptSize));
+      break;
+    }
+  }
+  quiz_assert(!storage->recordNamed("u.py").isNull());
+
+  storage->destroyRecordsWithExtension("py");
+  storage->setCompressionEnabled(compressionEnabled);
+  quiz_assert(storage->compressionStatistics().numberOfCompressedRecords == 0);
+  quiz_assert(storage_magic() == uncompressedMagic);
+  quiz_assert(storage->availableSize() == initialStorageAvailableStage);
+}
+
+QUIZ_CASE(ion_storage_compression_order) {
+  Storage * storage = Storage::sharedStorage();
+  size_t initialStorageAvailableStage = storage->availableSize();
+  bool compressionEnabled = storage->compressionEnabled();
+  storage->setCompressionEnabled(true);
+  constexpr int numberOfScripts = 4;
+  constexpr size_t scriptSize = 2000;
+  const char * fullNames[numberOfScripts] = {"c0.py", "c1.py", "c2.py", "c3.py"};
+  char script[scriptSize];
+  for (int i = 0; i < numberOfScripts; i++) {
+    fill_script(script, scriptSize, i);
+    quiz_assert(storage->createRecordWithFullName(fullNames[i], script, scriptSize) == Storage::Record::ErrorStatus::None);
+  }
+  quiz_assert(storage->compressionStatistics().numberOfCompressedRecords == 0);
+  storage->recordNamed(fullNames[0]).value();
+  storage->recordNamed(fullNames[2]).value();
+
+  // The records read the least recently are compressed first
+  char filler[10000];
+  size_t fillerSize = storage->availableSize() - 1600 - strlen("filler.bin") - 1 - sizeof(Storage::record_size_t);
+  assert(fillerSize <= sizeof(filler));
+  memset(filler, 0, fillerSize);
+  quiz_assert(storage->createRecordWithFullName("filler.bin", filler, fillerSize) == Storage::Record::ErrorStatus::None);
+  quiz_assert(script_is_compressed(fullNames[1]));
+  quiz_assert(script_is_compressed(fullNames[3]));
+  quiz_assert(!script_is_compressed(fullNames[2]));
+  for (int i = 0; i < numberOfScripts; i++) {
+    quiz_assert(script_is_intact(fullNames[i], i, scriptSize));
+  }
+  storage->destroyRecordsWithExtension("py");
+  storage->destroyRecordsWithExtension("bin");
+
+  /* d2 is copied from its value, which moves when the records preceding it are
+   * compressed to make room for the copy. */
+  const char * otherFullNames[3] = {"d0.py", "d1.py", "d2.py"};
+  storage->setCompressionEnabled(false);
+  for (int i = 0; i < 3; i++) {
+    fill_script(script, scriptSize, i);
+    quiz_assert(storage->createRecordWithFullName(otherFullNames[i], script, scriptSize) == Storage::Record::ErrorStatus::None);
+  }
+  fillerSize = storage->availableSize() - 1000 - strlen("filler.bin") - 1 - sizeof(Storage::record_size_t);
+  assert(fillerSize <= sizeof(filler));
+  quiz_assert(storage->createRecordWithFullName("filler.bin", filler, fillerSize) == Storage::Record::ErrorStatus::None);
+  storage->setCompressionEnabled(true);
+  Storage::Record::Data value = storage->recordNamed(otherFullNames[2]).value();
+  quiz_assert(storage->createRecordWithFullName("copy.py", value.buffer, value.size) == Storage::Record::ErrorStatus::None);
+  quiz_assert(script_is_intact("copy.py", 2, scriptSize));
+  for (int i = 0; i < 3; i++) {
+    quiz_assert(script_is_intact(otherFullNames[i], i, scriptSize));
+  }
+
+  storage->destroyRecordsWithExtension("py");
+  storage->destroyRecordsWithExtension("bin");
+  storage->setCompressionEnabled(compressionEnabled);
+  quiz_assert(storage->availableSize() == initialStorageAvailableStage);
+}
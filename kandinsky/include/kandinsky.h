@@ -7,9 +7,11 @@
 #include <kandinsky/font.h>
 #include <kandinsky/framebuffer.h>
 #include <kandinsky/framebuffer_context.h>
+#include <kandinsky/glyph_cache.h>
 #include <kandinsky/ion_context.h>
 #include <kandinsky/point.h>
 #include <kandinsky/rect.h>
 #include <kandinsky/size.h>
+#include <kandinsky/tile_buffer.h>
 
 #endif
@@ -36,6 +36,8 @@ protected:
 private:
   KDRect absoluteFillRect(KDRect rect);
   KDPoint pushOrPullString(const char * text, KDPoint p, const KDFont * font, KDColor textColor, KDColor backgroundColor, int maxByteLength, bool push, int * result = nullptr);
+  // Push the runLength glyphs of a run of pushOrPullString
+  void pushRun(KDPoint position, KDSize glyphSize, KDColor * runBuffer, int runLength);
   KDPoint m_origin;
   KDRect m_clippingRect;
 };
@@ -24,9 +24,12 @@
  * code points in the CodePoints table. This table is create in rasterizer.c. */
 
 class KDFont {
+  friend class KDGlyphCache;
+public:
+  static constexpr int k_maxGlyphPixelCount = 180; //TODO: Should be generated by the rasterizer
 private:
   static constexpr int k_bitsPerPixel = 4; // TODO: Should be generated by the rasterizer
-  static constexpr int k_maxGlyphPixelCount = 180; //TODO: Should be generated by the rasterizer
+  static constexpr int k_maxGlyphGreyscaleSize = k_maxGlyphPixelCount * k_bitsPerPixel / 8;
   static const KDFont privateLargeFont;
   static const KDFont privateSmallFont;
 public:
@@ -0,0 +1,56 @@
+#ifndef KANDINSKY_GLYPH_CACHE_H
+#define KANDINSKY_GLYPH_CACHE_H
+
+#include <kandinsky/color.h>
+#include <kandinsky/font.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* KDGlyphCache keeps the greyscales of the glyphs drawn last, so that
+ * redrawing text does not decompress them again. Colorizing cached greyscales
+ * with the palette of the text only takes a lookup per pixel, and a colorized
+ * glyph takes 4 times the memory of its greyscales, so colors are not cached.
+ * The cache is a small array looked up linearly, the least recently used
+ * entry being replaced on a miss. Its 40 entries on the device hold more
+ * distinct glyphs than a line of text. */
+
+class KDGlyphCache {
+public:
+  struct Statistics {
+    int numberOfHits;
+    int numberOfMisses;
+  };
+
+  static KDGlyphCache * sharedCache();
+  KDGlyphCache();
+
+  /* Returns the colors of the glyph of codePoint in font, rendered with
+   * palette. The colors are only valid until the next call. */
+  const KDColor * glyphColors(const KDFont * font, CodePoint codePoint, const KDFont::RenderPalette * palette);
+  void clear();
+
+  const Statistics & statistics() const { return m_statistics; }
+  void resetStatistics() { m_statistics = Statistics{0, 0}; }
+private:
+  constexpr static size_t k_cacheSize = 4*1024;
+
+  struct Entry {
+    const KDFont * font; // nullptr if the entry is empty
+    uint32_t lastUse;
+    KDFont::GlyphIndex glyphIndex;
+    uint8_t greyscales[KDFont::k_maxGlyphGreyscaleSize];
+  };
+
+  constexpr static int k_numberOfEntries = k_cacheSize / sizeof(Entry);
+
+  const uint8_t * greyscales(const KDFont * font, KDFont::GlyphIndex glyphIndex);
+  // Returns the index of the entry to replace
+  int leastRecentlyUsedEntry() const;
+
+  Entry m_entries[k_numberOfEntries];
+  KDFont::GlyphBuffer m_glyphBuffer;
+  uint32_t m_clock;
+  Statistics m_statistics;
+};
+
+#endif
@@ -6,11 +6,15 @@
 class KDIonContext : public KDContext {
 public:
   static KDIonContext * sharedContext();
+  /* Counts the pixels sent to the display, to measure what a redraw costs.
+   * The count wraps around when it overflows. */
+  uint32_t numberOfPushedPixels() const { return m_numberOfPushedPixels; }
 private:
   KDIonContext();
   void pushRect(KDRect rect, const KDColor * pixels) override;
   void pushRectUniform(KDRect rect, KDColor color) override;
   void pullRect(KDRect rect, KDColor * pixels) override;
+  uint32_t m_numberOfPushedPixels;
 };
 
 #endif
@@ -0,0 +1,42 @@
+#ifndef KANDINSKY_TILE_BUFFER_H
+#define KANDINSKY_TILE_BUFFER_H
+
+#include <kandinsky/context.h>
+#include <stdint.h>
+
+/* KDTileBuffer accumulates the pixels set in a square tile of a context, and
+ * pushes them to the context at once when it is flushed. Tiles are aligned on
+ * a grid of k_size pixels: setting a pixel out of the current tile flushes it
+ * and moves it to the tile of the pixel, so that pixels set along a row or a
+ * column are pushed k_size by k_size.
+ * Only the pixels that were set are pushed: the rectangle they span is pushed
+ * at once if all its pixels were set, and row by row runs of set pixels
+ * otherwise. The coordinates are the ones of the context, which must keep the
+ * same origin and clipping rect until the tile is flushed. */
+
+class KDTileBuffer {
+public:
+  constexpr static KDCoordinate k_size = 32;
+  KDTileBuffer(KDContext * context);
+  void setPixel(KDPoint p, KDColor c);
+  // Returns false if the pixel was not set since the last flush
+  bool getPixel(KDPoint p, KDColor * c) const;
+  void flush();
+  // Forget the pixels set since the last flush
+  void discard();
+  bool isEmpty() const { return m_numberOfSetPixels == 0; }
+private:
+  constexpr static int k_numberOfPixels = k_size * k_size;
+  constexpr static int k_bitsPerWord = 32;
+  static KDCoordinate TileOrigin(KDCoordinate x);
+  int indexOfPixel(KDPoint p) const;
+  bool pixelIsSet(int index) const { return (m_setPixels[index / k_bitsPerWord] >> (index % k_bitsPerWord)) & 1; }
+  KDContext * m_context;
+  KDPoint m_origin;
+  KDRect m_dirtyRect;
+  int m_numberOfSetPixels;
+  KDColor m_pixels[k_numberOfPixels];
+  uint32_t m_setPixels[k_numberOfPixels / k_bitsPerWord];
+};
+
+#endif
@@ -1,11 +1,33 @@
 #include <assert.h>
 #include <kandinsky/context.h>
 #include <kandinsky/font.h>
+#include <kandinsky/glyph_cache.h>
 #include <ion/unicode/utf8_decoder.h>
 #include <ion/display.h>
+#include <string.h>
 
 constexpr static int k_tabCharacterWidth = 4;
 
+/* Consecutive glyphs of a line are gathered in a run and pushed at once, each
+ * push setting up a drawing area on the display. The rows of the glyphs of a
+ * run are stored with the stride of a full run. A run holds as many glyphs as
+ * fit in the pixels of 8 of the largest glyphs: buffering a whole line of 320
+ * pixels would take more than 11KB of the 32KB stack, while runs of 8 to 14
+ * glyphs already make the set up of the drawing area negligible. */
+constexpr static int k_runPixelCount = 8 * KDFont::k_maxGlyphPixelCount;
+
+static int NumberOfGlyphsPerRun(KDSize glyphSize) {
+  return k_runPixelCount / (glyphSize.width() * glyphSize.height());
+}
+
+static void AppendGlyphToRun(const KDColor * glyphColors, KDSize glyphSize, KDColor * runBuffer, int runLength) {
+  assert(runLength < NumberOfGlyphsPerRun(glyphSize));
+  int stride = NumberOfGlyphsPerRun(glyphSize) * glyphSize.width();
+  for (int j = 0; j < glyphSize.height(); j++) {
+    memcpy(runBuffer + j * stride + runLength * glyphSize.width(), glyphColors + j * glyphSize.width(), glyphSize.width() * sizeof(KDColor));
+  }
+}
+
 KDPoint KDContext::drawString(const char * text, KDPoint p, const KDFont * font, KDColor textColor, KDColor backgroundColor, int maxByteLength) {
   return pushOrPullString(text, p, font, textColor, backgroundColor, maxByteLength, true);
 }
@@ -21,12 +43,20 @@ KDPoint KDContext::pushOrPullString(const char * text, KDPoint p, const KDFont *
   KDSize glyphSize = font->glyphSize();
   KDFont::RenderPalette palette = font->renderPalette(textColor, backgroundColor);
   KDFont::GlyphBuffer glyphBuffer;
+  KDColor runBuffer[k_runPixelCount];
+  int numberOfGlyphsPerRun = NumberOfGlyphsPerRun(glyphSize);
+  KDPoint runPosition = position;
+  int runLength = 0;
 
   UTF8Decoder decoder(text);
   const char * codePointPointer = decoder.stringPosition();
   CodePoint codePoint = decoder.nextCodePoint();
   while (codePoint != UCodePointNull && (maxByteLength < 0 || codePointPointer < text + maxByteLength)) {
     codePointPointer = decoder.stringPosition();
+    if (codePoint == UCodePointLineFeed || codePoint == UCodePointTabulation) {
+      pushRun(runPosition, glyphSize, runBuffer, runLength);
+      runLength = 0;
+    }
     if (codePoint == UCodePointLineFeed) {
       position = KDPoint(0, position.y() + glyphSize.height());
       codePoint = decoder.nextCodePoint();
@@ -35,28 +65,39 @@ KDPoint KDContext::pushOrPullString(const char * text, KDPoint p, const KDFont *
       codePoint = decoder.nextCodePoint();
     } else {
       assert(!codePoint.isCombining());
-      font->setGlyphGreyscalesForCodePoint(codePoint, &glyphBuffer);
+      CodePoint baseCodePoint = codePoint;
       codePoint = decoder.nextCodePoint();
-      while (codePoint.isCombining()) {
-        font->accumulateGlyphGreyscalesForCodePoint(codePoint, &glyphBuffer);
-        codePointPointer = decoder.stringPosition();
-        codePoint = decoder.nextCodePoint();
+      const KDColor * glyphColors;
+      if (codePoint.isCombining()) {
+        // Glyphs superimposing several code points are not cached
+        font->setGlyphGreyscalesForCodePoint(baseCodePoint, &glyphBuffer);
+        while (codePoint.isCombining()) {
+          font->accumulateGlyphGreyscalesForCodePoint(codePoint, &glyphBuffer);
+          codePointPointer = decoder.stringPosition();
+          codePoint = decoder.nextCodePoint();
+        }
+        font->colorizeGlyphBuffer(&palette, &glyphBuffer);
+        glyphColors = glyphBuffer.colorBuffer();
+      } else {
+        glyphColors = KDGlyphCache::sharedCache()->glyphColors(font, baseCodePoint, &palette);
       }
-      font->colorizeGlyphBuffer(&palette, &glyphBuffer);
       if (push) {
-        // Push the character on the screen
-        fillRectWithPixels(
-            KDRect(position, glyphSize),
-            glyphBuffer.colorBuffer(),
-            glyphBuffer.colorBuffer() // It's OK to trash the content of the color buffer since we'll re-fetch it for the next char anyway
-            );
+        // Append the character to the run pushed on the screen
+        if (runLength == 0) {
+          runPosition = position;
+        }
+        AppendGlyphToRun(glyphColors, glyphSize, runBuffer, runLength++);
+        if (runLength == numberOfGlyphsPerRun) {
+          pushRun(runPosition, glyphSize, runBuffer, runLength);
+          runLength = 0;
+        }
       } else {
         // Pull and compare the character from the screen
         assert(result != nullptr);
         *result = 0;
         KDFont::GlyphBuffer workingGlyphBuffer;
         KDColor * workingColorBuffer = workingGlyphBuffer.colorBuffer();
-        KDColor * colorBuffer = glyphBuffer.colorBuffer();
+        const KDColor * colorBuffer = glyphColors;
         for (int i = 0; i < glyphSize.height() * glyphSize.width(); i++) {
           workingColorBuffer[i] = KDColorRed;
         }
@@ -73,6 +114,24 @@ KDPoint KDContext::pushOrPullString(const char * text, KDPoint p, const KDFont *
       position = position.translatedBy(KDPoint(glyphSize.width(), 0));
     }
   }
+  pushRun(runPosition, glyphSize, runBuffer, runLength);
 
   return position;
 }
+
+void KDContext::pushRun(KDPoint position, KDSize glyphSize, KDColor * runBuffer, int runLength) {
+  if (runLength == 0) {
+    return;
+  }
+  int runWidth = runLength * glyphSize.width();
+  int stride = NumberOfGlyphsPerRun(glyphSize) * glyphSize.width();
+  // Make the rows of a partial run contiguous
+  if (runWidth < stride) {
+    for (int j = 1; j < glyphSize.height(); j++) {
+      memmove(runBuffer + j * runWidth, runBuffer + j * stride, runWidth * sizeof(KDColor));
+    }
+  }
+  /* The run buffer can be trashed since the run is over. It is enough for
+   * fillRectWithPixels to push the clipped part of the run at once. */
+  fillRectWithPixels(KDRect(position, runWidth, glyphSize.height()), runBuffer, runBuffer);
+}
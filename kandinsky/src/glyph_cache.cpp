@@ -0,0 +1,59 @@
+#include <kandinsky/glyph_cache.h>
+#include <string.h>
+#include <assert.h>
+
+KDGlyphCache * KDGlyphCache::sharedCache() {
+  static KDGlyphCache cache;
+  return &cache;
+}
+
+KDGlyphCache::KDGlyphCache() {
+  clear();
+}
+
+const KDColor * KDGlyphCache::glyphColors(const KDFont * font, CodePoint codePoint, const KDFont::RenderPalette * palette) {
+  KDFont::GlyphIndex glyphIndex = font->indexForCodePoint(codePoint);
+  KDSize glyphSize = font->glyphSize();
+  memcpy(m_glyphBuffer.greyscaleBuffer(), greyscales(font, glyphIndex), glyphSize.width() * glyphSize.height() * KDFont::k_bitsPerPixel / 8);
+  font->colorizeGlyphBuffer(palette, &m_glyphBuffer);
+  return m_glyphBuffer.colorBuffer();
+}
+
+void KDGlyphCache::clear() {
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    m_entries[i].font = nullptr;
+    m_entries[i].lastUse = 0;
+  }
+  m_clock = 0;
+  resetStatistics();
+}
+
+const uint8_t * KDGlyphCache::greyscales(const KDFont * font, KDFont::GlyphIndex glyphIndex) {
+  m_clock++;
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    Entry * entry = m_entries + i;
+    if (entry->font == font && entry->glyphIndex == glyphIndex) {
+      m_statistics.numberOfHits++;
+      entry->lastUse = m_clock;
+      return entry->greyscales;
+    }
+  }
+  m_statistics.numberOfMisses++;
+  Entry * entry = m_entries + leastRecentlyUsedEntry();
+  entry->font = font;
+  entry->lastUse = m_clock;
+  entry->glyphIndex = glyphIndex;
+  font->fetchGreyscaleGlyphAtIndex(glyphIndex, entry->greyscales);
+  return entry->greyscales;
+}
+
+int KDGlyphCache::leastRecentlyUsedEntry() const {
+  // Empty entries were last used at 0, before any other entry
+  int result = 0;
+  for (int i = 1; i < k_numberOfEntries; i++) {
+    if (m_entries[i].lastUse < m_entries[result].lastUse) {
+      result = i;
+    }
+  }
+  return result;
+}
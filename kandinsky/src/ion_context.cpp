@@ -1,5 +1,6 @@
 #include <kandinsky/ion_context.h>
 #include <ion.h>
+#include <ion/profiling.h>
 
 KDIonContext * KDIonContext::sharedContext() {
   static KDIonContext context;
@@ -8,15 +9,22 @@ KDIonContext * KDIonContext::sharedContext() {
 
 KDIonContext::KDIonContext() :
 KDContext(KDPointZero,
-    KDRect(0, 0, Ion::Display::Width, Ion::Display::Height))
+    KDRect(0, 0, Ion::Display::Width, Ion::Display::Height)),
+  m_numberOfPushedPixels(0)
 {
 }
 
 void KDIonContext::pushRect(KDRect rect, const KDColor * pixels) {
+  Ion::Profiling::SectionScope pushRectScope(Ion::Profiling::Section::PushRect);
+  m_numberOfPushedPixels += rect.width() * rect.height();
+  Ion::Profiling::increment(Ion::Profiling::Counter::PushedPixels, rect.width() * rect.height());
   Ion::Display::pushRect(rect, pixels);
 }
 
 void KDIonContext::pushRectUniform(KDRect rect, KDColor color) {
+  Ion::Profiling::SectionScope pushRectScope(Ion::Profiling::Section::PushRect);
+  m_numberOfPushedPixels += rect.width() * rect.height();
+  Ion::Profiling::increment(Ion::Profiling::Counter::PushedPixels, rect.width() * rect.height());
   Ion::Display::pushRectUniform(rect, color);
 }
 
@@ -0,0 +1,93 @@
+#include <kandinsky/tile_buffer.h>
+#include <assert.h>
+#include <string.h>
+
+KDTileBuffer::KDTileBuffer(KDContext * context) :
+  m_context(context),
+  m_origin(KDPointZero),
+  m_dirtyRect(KDRectZero),
+  m_numberOfSetPixels(0),
+  m_setPixels{}
+{
+}
+
+void KDTileBuffer::setPixel(KDPoint p, KDColor c) {
+  int index = indexOfPixel(p);
+  if (index < 0) {
+    flush();
+    m_origin = KDPoint(TileOrigin(p.x()), TileOrigin(p.y()));
+    index = indexOfPixel(p);
+    assert(index >= 0);
+  }
+  m_pixels[index] = c;
+  if (!pixelIsSet(index)) {
+    m_setPixels[index / k_bitsPerWord] |= 1u << (index % k_bitsPerWord);
+    m_numberOfSetPixels++;
+    m_dirtyRect = m_dirtyRect.unionedWith(KDRect(p, 1, 1));
+  }
+}
+
+bool KDTileBuffer::getPixel(KDPoint p, KDColor * c) const {
+  int index = indexOfPixel(p);
+  if (index < 0 || !pixelIsSet(index)) {
+    return false;
+  }
+  *c = m_pixels[index];
+  return true;
+}
+
+void KDTileBuffer::flush() {
+  if (isEmpty()) {
+    return;
+  }
+  KDCoordinate left = m_dirtyRect.x() - m_origin.x();
+  KDCoordinate top = m_dirtyRect.y() - m_origin.y();
+  KDCoordinate width = m_dirtyRect.width();
+  KDCoordinate height = m_dirtyRect.height();
+  if (m_numberOfSetPixels == width * height) {
+    /* Pack the rows of the rectangle at the beginning of the tile to push them
+     * at once. Rows only move backwards, so they are never overwritten before
+     * being moved. */
+    for (KDCoordinate j = 0; j < height; j++) {
+      memmove(m_pixels + j * width, m_pixels + (top + j) * k_size + left, width * sizeof(KDColor));
+    }
+    m_context->fillRectWithPixels(m_dirtyRect, m_pixels, m_pixels);
+  } else {
+    for (KDCoordinate j = top; j < top + height; j++) {
+      KDCoordinate i = left;
+      while (i < left + width) {
+        if (!pixelIsSet(j * k_size + i)) {
+          i++;
+          continue;
+        }
+        KDCoordinate runStart = i;
+        while (i < left + width && pixelIsSet(j * k_size + i)) {
+          i++;
+        }
+        KDRect run(m_origin.x() + runStart, m_origin.y() + j, i - runStart, 1);
+        m_context->fillRectWithPixels(run, m_pixels + j * k_size + runStart, nullptr);
+      }
+    }
+  }
+  discard();
+}
+
+void KDTileBuffer::discard() {
+  memset(m_setPixels, 0, sizeof(m_setPixels));
+  m_numberOfSetPixels = 0;
+  m_dirtyRect = KDRectZero;
+}
+
+KDCoordinate KDTileBuffer::TileOrigin(KDCoordinate x) {
+  // Round towards minus infinity, for the tiles to be aligned on a grid
+  return (x >= 0 ? x : x - (k_size - 1)) / k_size * k_size;
+}
+
+int KDTileBuffer::indexOfPixel(KDPoint p) const {
+  int i = p.x() - m_origin.x();
+  int j = p.y() - m_origin.y();
+  if (i < 0 || i >= k_size || j < 0 || j >= k_size) {
+    return -1;
+  }
+  return j * k_size + i;
+}
@@ -0,0 +1,87 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <assert.h>
+#include <string.h>
+
+class CountingContext : public KDFrameBufferContext {
+public:
+  CountingContext(KDFrameBuffer * frameBuffer) : KDFrameBufferContext(frameBuffer), m_numberOfPushes(0) {}
+  int numberOfPushes() const { return m_numberOfPushes; }
+protected:
+  void pushRect(KDRect rect, const KDColor * pixels) override {
+    m_numberOfPushes++;
+    KDFrameBufferContext::pushRect(rect, pixels);
+  }
+private:
+  int m_numberOfPushes;
+};
+
+constexpr KDCoordinate k_width = 120;
+constexpr KDCoordinate k_height = 40;
+
+static KDColor glyph_pixel(const KDFont * font, CodePoint codePoint, KDPoint p) {
+  KDFont::GlyphBuffer glyphBuffer;
+  KDFont::RenderPalette palette = font->renderPalette(KDColorBlack, KDColorWhite);
+  font->setGlyphGreyscalesForCodePoint(codePoint, &glyphBuffer);
+  font->colorizeGlyphBuffer(&palette, &glyphBuffer);
+  return glyphBuffer.colorBuffer()[p.y() * font->glyphSize().width() + p.x()];
+}
+
+/* Check that the line of text starting at origin is drawn, and that the
+ * pixels of the frame buffer outside of the clipping rect are white. */
+static bool line_is_drawn(const KDColor * pixels, const char * text, KDPoint origin, KDRect clippingRect, const KDFont * font) {
+  KDSize glyphSize = font->glyphSize();
+  int length = strlen(text);
+  for (int j = 0; j < glyphSize.height(); j++) {
+    for (int i = 0; i < length * glyphSize.width(); i++) {
+      KDPoint p(origin.x() + i, origin.y() + j);
+      if (p.x() >= k_width) {
+        break;
+      }
+      KDColor expected = clippingRect.contains(p) ? glyph_pixel(font, text[i / glyphSize.width()], KDPoint(i % glyphSize.width(), j)) : KDColorWhite;
+      if (pixels[p.y() * k_width + p.x()] != expected) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+QUIZ_CASE(kandinsky_context_text_runs) {
+  KDColor pixels[k_width * k_height];
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_width, k_height));
+  const KDFont * font = KDFont::SmallFont;
+  KDCoordinate glyphWidth = font->glyphSize().width();
+  KDCoordinate glyphHeight = font->glyphSize().height();
+  KDRect bounds(0, 0, k_width, k_height);
+
+  // Runs of glyphs are interrupted by tabulations and line feeds
+  CountingContext context(&frameBuffer);
+  context.fillRect(bounds, KDColorWhite);
+  context.drawString("0123456789ab\tc\nxy", KDPointZero, font);
+  quiz_assert(context.numberOfPushes() == 3);
+  quiz_assert(line_is_drawn(pixels, "0123456789ab", KDPointZero, bounds, font));
+  quiz_assert(line_is_drawn(pixels, "c", KDPoint(16 * glyphWidth, 0), bounds, font));
+  quiz_assert(line_is_drawn(pixels, "xy", KDPoint(0, glyphHeight), bounds, font));
+
+  // Runs hold as many glyphs as 8 glyphs of the largest size
+  CountingContext longContext(&frameBuffer);
+  longContext.fillRect(bounds, KDColorWhite);
+  longContext.drawString("0123456789abcdef", KDPointZero, font);
+  quiz_assert(longContext.numberOfPushes() == 2);
+  quiz_assert(line_is_drawn(pixels, "0123456789abcdef", KDPointZero, bounds, font));
+  CountingContext largeContext(&frameBuffer);
+  largeContext.fillRect(bounds, KDColorWhite);
+  largeContext.drawString("0123456789", KDPointZero, KDFont::LargeFont);
+  quiz_assert(largeContext.numberOfPushes() == 2);
+  quiz_assert(line_is_drawn(pixels, "0123456789", KDPointZero, bounds, KDFont::LargeFont));
+
+  // Clipped runs are pushed at once
+  CountingContext clippedContext(&frameBuffer);
+  clippedContext.fillRect(bounds, KDColorWhite);
+  KDRect clippingRect(10, 2, 30, 10);
+  clippedContext.setClippingRect(clippingRect);
+  clippedContext.drawString("0123456789", KDPointZero, font);
+  quiz_assert(clippedContext.numberOfPushes() == 1);
+  quiz_assert(line_is_drawn(pixels, "0123456789", KDPointZero, clippingRect, font));
+}
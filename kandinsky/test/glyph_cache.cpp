@@ -0,0 +1,60 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <assert.h>
+
+static bool glyph_colors_are_rendered(const KDColor * colors, const KDFont * font, CodePoint codePoint, const KDFont::RenderPalette * palette) {
+  KDFont::GlyphBuffer glyphBuffer;
+  font->setGlyphGreyscalesForCodePoint(codePoint, &glyphBuffer);
+  font->colorizeGlyphBuffer(palette, &glyphBuffer);
+  KDSize glyphSize = font->glyphSize();
+  for (int i = 0; i < glyphSize.width() * glyphSize.height(); i++) {
+    if (colors[i] != glyphBuffer.colorBuffer()[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+QUIZ_CASE(kandinsky_glyph_cache) {
+  static KDGlyphCache cache;
+  cache.clear();
+  const KDFont * font = KDFont::LargeFont;
+  KDFont::RenderPalette blackOnWhite = font->renderPalette(KDColorBlack, KDColorWhite);
+  KDFont::RenderPalette redOnBlue = font->renderPalette(KDColorRed, KDColorBlue);
+
+  // The first glyph is decompressed and colorized
+  const KDColor * colors = cache.glyphColors(font, 'a', &blackOnWhite);
+  quiz_assert(glyph_colors_are_rendered(colors, font, 'a', &blackOnWhite));
+  quiz_assert(cache.statistics().numberOfMisses == 1);
+
+  // Drawing it again, even in other colors, is a hit
+  colors = cache.glyphColors(font, 'a', &blackOnWhite);
+  quiz_assert(glyph_colors_are_rendered(colors, font, 'a', &blackOnWhite));
+  colors = cache.glyphColors(font, 'a', &redOnBlue);
+  quiz_assert(glyph_colors_are_rendered(colors, font, 'a', &redOnBlue));
+  quiz_assert(cache.statistics().numberOfHits == 2 && cache.statistics().numberOfMisses == 1);
+
+  // A line of distinct glyphs drawn again only hits
+  const char line[] = "The quick brown fox jumps over 12 lazy dogs!";
+  for (const char * c = line; *c != 0; c++) {
+    cache.glyphColors(font, *c, &blackOnWhite);
+  }
+  cache.resetStatistics();
+  for (const char * c = line; *c != 0; c++) {
+    colors = cache.glyphColors(font, *c, &blackOnWhite);
+    quiz_assert(glyph_colors_are_rendered(colors, font, *c, &blackOnWhite));
+  }
+  quiz_assert(cache.statistics().numberOfMisses == 0);
+
+  // Least recently used glyphs are replaced
+  for (CodePoint c = 'A'; c <= 'Z'; c = c + 1) {
+    cache.glyphColors(font, c, &blackOnWhite);
+    cache.glyphColors(font, 'a', &blackOnWhite);
+  }
+  cache.resetStatistics();
+  cache.glyphColors(font, 'a', &blackOnWhite);
+  cache.glyphColors(font, 'Z', &blackOnWhite);
+  quiz_assert(cache.statistics().numberOfHits == 2);
+  cache.glyphColors(font, 'q', &blackOnWhite);
+  quiz_assert(cache.statistics().numberOfMisses == 1);
+}
@@ -0,0 +1,88 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <assert.h>
+
+class PushCountingContext : public KDFrameBufferContext {
+public:
+  PushCountingContext(KDFrameBuffer * frameBuffer) : KDFrameBufferContext(frameBuffer), m_numberOfPushes(0) {}
+  int numberOfPushes() const { return m_numberOfPushes; }
+protected:
+  void pushRect(KDRect rect, const KDColor * pixels) override {
+    m_numberOfPushes++;
+    KDFrameBufferContext::pushRect(rect, pixels);
+  }
+private:
+  int m_numberOfPushes;
+};
+
+constexpr KDCoordinate k_width = 100;
+constexpr KDCoordinate k_height = 70;
+
+static KDColor color_of_pixel(int x, int y) {
+  return KDColor::RGB16(1 + x + k_width * y);
+}
+
+QUIZ_CASE(kandinsky_tile_buffer) {
+  KDColor pixels[k_width * k_height];
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_width, k_height));
+  PushCountingContext context(&frameBuffer);
+  context.fillRect(KDRect(0, 0, k_width, k_height), KDColorWhite);
+  KDTileBuffer tileBuffer(&context);
+
+  // A column is pushed tile by tile
+  for (int y = 0; y < k_height; y++) {
+    tileBuffer.setPixel(KDPoint(3, y), color_of_pixel(3, y));
+  }
+  KDColor c;
+  quiz_assert(tileBuffer.getPixel(KDPoint(3, 65), &c) && c == color_of_pixel(3, 65));
+  quiz_assert(!tileBuffer.getPixel(KDPoint(4, 65), &c));
+  quiz_assert(pixels[65 * k_width + 3] == KDColorWhite);
+  tileBuffer.flush();
+  quiz_assert(tileBuffer.isEmpty());
+  int numberOfTiles = (k_height + KDTileBuffer::k_size - 1) / KDTileBuffer::k_size;
+  quiz_assert(context.numberOfPushes() == numberOfTiles);
+  for (int y = 0; y < k_height; y++) {
+    quiz_assert(pixels[y * k_width + 3] == color_of_pixel(3, y));
+    quiz_assert(pixels[y * k_width + 4] == KDColorWhite);
+  }
+
+  // Pixels set twice are pushed once, with their last color
+  tileBuffer.setPixel(KDPoint(40, 40), KDColorRed);
+  tileBuffer.setPixel(KDPoint(40, 40), KDColorBlue);
+  tileBuffer.flush();
+  quiz_assert(context.numberOfPushes() == numberOfTiles + 1);
+  quiz_assert(pixels[40 * k_width + 40] == KDColorBlue);
+
+  // Scattered pixels are pushed by runs, without touching the other pixels
+  int numberOfPushes = context.numberOfPushes();
+  tileBuffer.setPixel(KDPoint(65, 33), KDColorRed);
+  tileBuffer.setPixel(KDPoint(66, 33), KDColorRed);
+  tileBuffer.setPixel(KDPoint(68, 33), KDColorGreen);
+  tileBuffer.setPixel(KDPoint(67, 35), KDColorBlue);
+  tileBuffer.flush();
+  quiz_assert(context.numberOfPushes() == numberOfPushes + 3);
+  quiz_assert(pixels[33 * k_width + 65] == KDColorRed);
+  quiz_assert(pixels[33 * k_width + 66] == KDColorRed);
+  quiz_assert(pixels[33 * k_width + 67] == KDColorWhite);
+  quiz_assert(pixels[33 * k_width + 68] == KDColorGreen);
+  quiz_assert(pixels[34 * k_width + 67] == KDColorWhite);
+  quiz_assert(pixels[35 * k_width + 67] == KDColorBlue);
+
+  // Pixels out of the context are clipped, including on negative tiles
+  tileBuffer.setPixel(KDPoint(-1, 2), KDColorRed);
+  tileBuffer.setPixel(KDPoint(k_width, 2), KDColorRed);
+  tileBuffer.setPixel(KDPoint(k_width - 1, 2), KDColorGreen);
+  tileBuffer.flush();
+  quiz_assert(pixels[2 * k_width + k_width - 1] == KDColorGreen);
+  quiz_assert(pixels[1 * k_width + k_width - 1] == KDColorWhite);
+
+  // Discarded pixels are not pushed
+  numberOfPushes = context.numberOfPushes();
+  tileBuffer.setPixel(KDPoint(10, 10), KDColorRed);
+  tileBuffer.discard();
+  quiz_assert(tileBuffer.isEmpty());
+  quiz_assert(!tileBuffer.getPixel(KDPoint(10, 10), &c));
+  tileBuffer.flush();
+  quiz_assert(context.numberOfPushes() == numberOfPushes);
+  quiz_assert(pixels[10 * k_width + 10] == KDColorWhite);
+}
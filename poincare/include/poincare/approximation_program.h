@@ -0,0 +1,92 @@
+#ifndef POINCARE_APPROXIMATION_PROGRAM_H
+#define POINCARE_APPROXIMATION_PROGRAM_H
+
+#include <poincare/approximation_helper.h>
+#include <poincare/expression.h>
+#include <poincare/interval.h>
+
+namespace Poincare {
+
+/* An ApproximationProgram is an expression of one unknown compiled into a
+ * postfix sequence of operations, to approximate it repeatedly without
+ * walking the tree nor allocating Evaluations in the pool.
+ *
+ * The subtrees that do not depend on the unknown are approximated once at
+ * compilation. The other nodes are evaluated with the very compute functions
+ * used by their approximate method, so that a program yields exactly the
+ * value of Expression::approximateWithValueForSymbol. As soon as an operation
+ * has a non-real result, the approximation gives up and the caller is
+ * expected to fall back on the expression. Expressions with unsupported
+ * nodes cannot be compiled, and are approximated with approximateScalar:
+ * - random and randint draw a new value at each approximation, so they are
+ *   neither compiled nor folded into constants,
+ * - integrals, derivatives, sums and products approximate their argument
+ *   many times for a variable of their own, which a flat program of one
+ *   unknown cannot express,
+ * - matrices have no scalar value,
+ * - the other functions (arithmetic, rounding, probability...) are rarely
+ *   plotted and are not worth an instruction each. */
+
+class ApproximationProgram {
+public:
+  ApproximationProgram() :
+    m_numberOfInstructions(0),
+    m_numberOfConstants(0),
+    m_status(Status::Uncompiled),
+    m_complexFormat(Preferences::ComplexFormat::Real),
+    m_angleUnit(Preferences::AngleUnit::Radian)
+  {}
+  void compile(const Expression e, const char * symbol, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
+  void reset() { m_status = Status::Uncompiled; }
+  bool needsCompilation() const { return m_status == Status::Uncompiled; }
+  bool isCompiled() const { return m_status == Status::Compiled; }
+  /* Returns false if the program could not approximate the expression, in
+   * which case result is left untouched. */
+  template<typename T> bool approximateWithValueForSymbol(T x, T * result) const;
+  /* Approximates the expression for numberOfValues values of the unknown,
+   * each instruction being run on k_batchLength values at a time.
+   * approximated[i] is false where the program gave up, ys[i] being then left
+   * untouched. */
+  template<typename T> void approximateWithValuesForSymbol(const T * xs, T * ys, bool * approximated, int numberOfValues) const;
+  /* Encloses the values of the expression when the unknown spans x. Returns
+   * false if the program cannot enclose it, in which case result is left
+   * untouched. */
+  template<typename T> bool approximateOnInterval(Interval<T> x, Interval<T> * result) const;
+
+  constexpr static int k_maxNumberOfInstructions = 32;
+  constexpr static int k_maxNumberOfConstants = 8;
+  constexpr static int k_maxStackDepth = 8;
+  constexpr static int k_batchLength = 16;
+private:
+  enum class Status : uint8_t {
+    Uncompiled,
+    Compiled,
+    Unsupported
+  };
+  /* Symbol pushes the unknown, Float pushes the constant of index operand and
+   * any other type pops its operand arguments and pushes the result. */
+  struct Instruction {
+    ExpressionNode::Type type;
+    uint8_t operand;
+  };
+  bool compileExpression(const Expression e, const char * symbol, Context * context, int * stackDepth);
+  bool pushInstruction(ExpressionNode::Type type, int operand);
+  template<typename T> static ApproximationHelper::ComplexCompute<T> MapFunction(ExpressionNode::Type type);
+  template<typename T> static ApproximationHelper::ComplexAndComplexReduction<T> ReductionFunction(ExpressionNode::Type type);
+  template<typename T> bool operate(Instruction instruction, std::complex<T> * operands, std::complex<T> * result) const;
+  template<typename T> bool operateOnInterval(Instruction instruction, Interval<T> * operands, Interval<T> * result) const;
+  template<typename T> T constantAtIndex(int i) const;
+
+  Instruction m_instructions[k_maxNumberOfInstructions];
+  double m_doubleConstants[k_maxNumberOfConstants];
+  float m_floatConstants[k_maxNumberOfConstants];
+  uint8_t m_numberOfInstructions;
+  uint8_t m_numberOfConstants;
+  Status m_status;
+  Preferences::ComplexFormat m_complexFormat;
+  Preferences::AngleUnit m_angleUnit;
+};
+
+}
+
+#endif
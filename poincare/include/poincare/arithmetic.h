@@ -13,18 +13,18 @@ public:
    * i could not be factorized.
    * Before calling PrimeFactorization, we initiate two tables of Integers
    * (outputFactors & outputCoefficients) of length k_maxNumberOfPrimeFactors = 32.
-   * As explained in 'integer.h', we guarantee the existence of only 16 Integers
-   * simultaneously. However, primeFactors are capped by
-   * k_biggestPrimeFactor*k_biggestPrimeFactor and they thus benefit from the
-   * small integer optimization. Thereby, the tables will not allocate any
-   * Integer on the static Integer table that limit the number of Integer
-   * simultaneously alive. */
+   * Small prime factors are found by trial division. Once the cofactor fits
+   * in a native 64-bit word, its prime factors above the table primeFactors
+   * are found with Pollard's rho algorithm and a Miller-Rabin primality test,
+   * so at most 4 factors do not benefit from the small integer
+   * optimization. */
   static int PrimeFactorization(const Integer & i, Integer outputFactors[], Integer outputCoefficients[], int outputLength);
   constexpr static int k_numberOfPrimeFactors = 1000;
   constexpr static int k_maxNumberOfPrimeFactors = 32;
 private:
-  /* When decomposing an integer into primes factors, we look for its prime
-   * factors among integer from 2 to 10000. */
+  /* When decomposing an integer into primes factors that does not fit in a
+   * native word, we look for its prime factors among integer from 2 to 10000
+   * until it does. */
   constexpr static int k_biggestPrimeFactor = 10000;
 };
 
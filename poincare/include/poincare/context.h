@@ -10,6 +10,10 @@ class Context {
 public:
   virtual const Expression expressionForSymbolAbstract(const SymbolAbstract & symbol, bool clone) = 0;
   virtual void setExpressionForSymbolAbstract(const Expression & expression, const SymbolAbstract & symbol) = 0;
+  /* Whether symbols are only resolved from the records of the storage, so
+   * that any two such contexts give the same result as long as the storage
+   * does not change. */
+  virtual bool resolvesSymbolsFromStorage() const { return false; }
 };
 
 }
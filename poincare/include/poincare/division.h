@@ -11,6 +11,7 @@ class Division;
 class DivisionNode /*final*/ : public ExpressionNode {
 template<int T>
   friend class LogarithmNode;
+  friend class ApproximationProgram;
 public:
 
   // TreeNode
@@ -39,6 +40,12 @@ public:
         computeOnComplexAndMatrix<double>, computeOnMatrixAndComplex<double>,
         computeOnMatrices<double>);
   }
+  std::complex<float> approximateScalar(SinglePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override {
+    return ApproximationHelper::MapReduceScalar<float>(this, context, complexFormat, angleUnit, compute<float>);
+  }
+  std::complex<double> approximateScalar(DoublePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override {
+    return ApproximationHelper::MapReduceScalar<double>(this, context, complexFormat, angleUnit, compute<double>);
+  }
 
   // Layout
   bool childNeedsSystemParenthesesAtSerialization(const TreeNode * child) const override;
@@ -51,7 +58,7 @@ public:
 
 private:
   // Approximation
-  template<typename T> static Complex<T> compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat);
+  template<typename T> static std::complex<T> compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat);
   template<typename T> static MatrixComplex<T> computeOnMatrixAndComplex(const MatrixComplex<T> m, const std::complex<T> c, Preferences::ComplexFormat complexFormat) {
     return ApproximationHelper::ElementWiseOnMatrixComplexAndComplex(m, c, complexFormat, compute<T>);
   }
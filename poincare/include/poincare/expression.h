@@ -15,6 +15,7 @@
 
 namespace Poincare {
 
+class ApproximationProgram;
 class Context;
 class SymbolAbstract;
 class Symbol;
@@ -193,6 +194,10 @@ public:
   /* Complex */
   static bool EncounteredComplex();
   static void SetEncounteredComplex(bool encounterComplex);
+  /* Set when a scalar approximation encounters a matrix, which has no scalar
+   * approximation. */
+  static bool EncounteredMatrix();
+  static void SetEncounteredMatrix(bool encounterMatrix);
   static Preferences::ComplexFormat UpdatedComplexFormatWithTextInput(Preferences::ComplexFormat complexFormat, const char * textInput);
   static Preferences::ComplexFormat UpdatedComplexFormatWithExpressionInput(Preferences::ComplexFormat complexFormat, const Expression & e, Context * context);
   // WARNING: this methods must be called on reduced expressions
@@ -240,6 +245,10 @@ public:
   template<typename U> U approximateToScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
   template<typename U> static U ApproximateToScalar(const char * text, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, bool symbolicComputation = true);
   template<typename U> U approximateWithValueForSymbol(const char * symbol, U x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+  /* Approximates the expression for numberOfValues values of symbol. The
+   * values are run through program, compiled here if not provided, and only
+   * the ones it gives up on are approximated on the tree. */
+  template<typename U> void approximateWithValuesForSymbol(const char * symbol, const U * xs, U * ys, int numberOfValues, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const ApproximationProgram * program = nullptr) const;
   /* Expression roots/extrema solver */
   Coordinate2D<double> nextMinimum(const char * symbol, double start, double step, double max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
   Coordinate2D<double> nextMaximum(const char * symbol, double start, double step, double max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
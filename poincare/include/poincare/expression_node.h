@@ -188,6 +188,11 @@ public:
    * reimplement simplificationOrderGreaterType. */
   virtual int simplificationOrderGreaterType(const ExpressionNode * e, bool ascending, bool canBeInterrupted) const { return ascending ? -1 : 1; }
   virtual int simplificationOrderSameType(const ExpressionNode * e, bool ascending, bool canBeInterrupted) const;
+  /* The structural hash is a digest of the tree such that two expressions
+   * whose SimplificationOrder is null have the same hash. It is cached in the
+   * nodes and lets isIdenticalTo dismiss most distinct trees without walking
+   * them. */
+  uint8_t structuralHash() const;
 
   /* Layout Helper */
   virtual Layout createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const = 0;
@@ -198,6 +203,16 @@ public:
   constexpr static int k_maxNumberOfSteps = 10000;
   virtual Evaluation<float> approximate(SinglePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const = 0;
   virtual Evaluation<double> approximate(DoublePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const = 0;
+  /* approximateScalar computes the approximation of a scalar expression on a
+   * std::complex, without building Evaluation trees in the pool. By default,
+   * it falls back on approximate, and flags the approximation as having
+   * encountered a matrix if the evaluation is not a complex. Only the nodes
+   * which need matrix evaluations keep that default: matrices and the matrix
+   * functions, whose operand or result is a matrix, the confidence and
+   * prediction intervals, which are matrices, and Equal, Store and
+   * EmptyExpression, which are never approximated inside an expression. */
+  virtual std::complex<float> approximateScalar(SinglePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+  virtual std::complex<double> approximateScalar(DoublePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
 
   /* Simplification */
   /*!*/ virtual void deepReduceChildren(ReductionContext reductionContext);
@@ -225,6 +240,14 @@ public:
   virtual void setChildrenInPlace(Expression other);
 
 protected:
+  /* Structural hash */
+  /* By default, the hash depends on the type and the children. Expressions
+   * which reimplement the simplification order have to reimplement
+   * computeStructuralHash accordingly. */
+  virtual uint32_t computeStructuralHash() const;
+  static uint32_t CombineHashes(uint32_t h1, uint32_t h2) { return 31*h1 + h2; }
+  static uint8_t FoldHash(uint32_t hash);
+
   /* Hierarchy */
   ExpressionNode * parent() const override { return static_cast<ExpressionNode *>(TreeNode::parent()); }
   Direct<ExpressionNode> children() const { return Direct<ExpressionNode>(this); }
@@ -136,6 +136,7 @@ public:
   static IntegerDivision Division(const Integer & numerator, const Integer & denominator);
   static Integer Power(const Integer & i, const Integer & j);
   static Integer Factorial(const Integer & i);
+  static Integer BinomialCoefficient(const Integer & n, const Integer & k);
 
   constexpr static int k_maxNumberOfDigits = 32;
 private:
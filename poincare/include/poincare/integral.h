@@ -1,6 +1,7 @@
 #ifndef POINCARE_INTEGRAL_H
 #define POINCARE_INTEGRAL_H
 
+#include <poincare/approximation_helper.h>
 #include <poincare/parametered_expression.h>
 #include <poincare/symbol.h>
 
@@ -22,6 +23,9 @@ public:
   Type type() const override { return Type::Integral; }
   int polynomialDegree(Context * context, const char * symbolName) const override;
 
+  /* Returns the integral, or NAN if it is undefined, and sets absoluteError
+   * to the estimated error of the result. */
+  template<typename T> T approximateWithError(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, T * absoluteError) const;
 
 private:
   // Layout
@@ -32,23 +36,49 @@ private:
   LayoutShape leftLayoutShape() const override { return LayoutShape::BoundaryPunctuation; };
   LayoutShape rightLayoutShape() const override { return LayoutShape::MoreLetters; }
   // Evaluation
-  Evaluation<float> approximate(SinglePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override { return templatedApproximate<float>(context, complexFormat, angleUnit); }
-  Evaluation<double> approximate(DoublePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override { return templatedApproximate<double>(context, complexFormat, angleUnit); }
- template<typename T> Evaluation<T> templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+  Evaluation<float> approximate(SinglePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override { return Complex<float>::Builder(templatedApproximate<float>(context, complexFormat, angleUnit)); }
+  Evaluation<double> approximate(DoublePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override { return Complex<double>::Builder(templatedApproximate<double>(context, complexFormat, angleUnit)); }
+  std::complex<float> approximateScalar(SinglePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override { return ApproximationHelper::ScalarResult(templatedApproximate<float>(context, complexFormat, angleUnit)); }
+  std::complex<double> approximateScalar(DoublePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override { return ApproximationHelper::ScalarResult(templatedApproximate<double>(context, complexFormat, angleUnit)); }
+  template<typename T> std::complex<T> templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
   template<typename T>
   struct DetailedResult
   {
     T integral;
     T absoluteError;
+    // Integral of the absolute value of the integrand
+    T absoluteIntegral;
   };
-  constexpr static int k_maxNumberOfIterations = 20;
-#ifdef LAGRANGE_METHOD
-  template<typename T> T lagrangeGaussQuadrature(T a, T b, Context Context * context, Preferences::AngleUnit angleUnit context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
-#else
-  template<typename T> DetailedResult<T> kronrodGaussQuadrature(T a, T b, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
-  template<typename T> T adaptiveQuadrature(T a, T b, T eps, int numberOfIterations, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
-#endif
-  template<typename T> T functionValueAtAbscissa(T x, Context * xcontext, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+  template<typename T>
+  struct Subinterval
+  {
+    T start;
+    T end;
+    DetailedResult<T> quadrature;
+  };
+  template<typename T> class Integrand;
+  /* The adaptive quadrature stops after k_maxNumberOfQuadratures Kronrod
+   * quadratures. Only the k_maxNumberOfSubintervals subintervals with the
+   * largest errors can still be split, the others being retired. The heap of
+   * subintervals, 2.5KB in double precision, is on the stack: an integral
+   * nested in the integrand of another one only keeps
+   * k_maxNumberOfNestedSubintervals of them, for 640 bytes. */
+  constexpr static int k_maxNumberOfQuadratures = 2048;
+  constexpr static int k_maxNumberOfSubintervals = 64;
+  constexpr static int k_maxNumberOfNestedSubintervals = 16;
+  /* Subintervals touching a bound that are split this many times hint at a
+   * singularity at the bound, for which tanh-sinh quadrature is tried. */
+  constexpr static int k_singularBoundDepth = 16;
+  constexpr static int k_maxNumberOfTanhSinhLevels = 7;
+  /* Integrals that do not reach the relative tolerance are still defined if
+   * their estimated error is below this absolute error. */
+  constexpr static double k_maxAbsoluteError = 0.1;
+  template<typename T> static T Tolerance(DetailedResult<T> result);
+  template<typename T> DetailedResult<T> kronrodGaussQuadrature(T a, T b, Integrand<T> * integrand) const;
+  template<typename T> DetailedResult<T> tanhSinhQuadrature(T a, T b, T tolerance, Integrand<T> * integrand) const;
+  bool isNestedInIntegrand() const;
+  template<typename T, int MaxNumberOfSubintervals> DetailedResult<T> adaptiveQuadratureWithHeap(T a, T b, Integrand<T> * integrand) const;
+  template<typename T> DetailedResult<T> adaptiveQuadrature(T a, T b, Integrand<T> * integrand, Subinterval<T> * heap, int maxNumberOfSubintervals) const;
 };
 
 class Integral final : public ParameteredExpression {
@@ -61,6 +91,7 @@ public:
 
   // Expression
   Expression shallowReduce(Context * context);
+  template<typename T> T approximateWithError(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, T * absoluteError) const;
 };
 
 }
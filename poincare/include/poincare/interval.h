@@ -0,0 +1,68 @@
+#ifndef POINCARE_INTERVAL_H
+#define POINCARE_INTERVAL_H
+
+#include <cmath>
+
+namespace Poincare {
+
+/* An Interval encloses the values taken by a real function over an interval
+ * of its unknown. The enclosure may be wider than the actual image, but never
+ * narrower. It is continuous if the function is defined and continuous over
+ * the whole interval of the unknown; an interval where the function is
+ * defined nowhere is undefined.
+ *
+ * Bounds are computed with the default rounding, so the enclosure is only
+ * meant for decisions at the scale of a pixel, such as drawing a curve. */
+
+template<typename T>
+class Interval final {
+public:
+  Interval(T lowerBound = NAN, T upperBound = NAN, bool isContinuous = true);
+  static Interval Undefined() { return Interval(); }
+  T lowerBound() const { return m_lowerBound; }
+  T upperBound() const { return m_upperBound; }
+  bool isUndefined() const { return std::isnan(m_lowerBound); }
+  bool isContinuous() const { return m_isContinuous; }
+  bool isPoint() const { return m_lowerBound == m_upperBound; }
+  bool contains(T value) const { return m_lowerBound <= value && value <= m_upperBound; }
+  Interval discontinuous() const { return Interval(m_lowerBound, m_upperBound, false); }
+
+  static Interval Opposite(Interval a);
+  static Interval Addition(Interval a, Interval b);
+  static Interval Subtraction(Interval a, Interval b) { return Addition(a, Opposite(b)); }
+  static Interval Multiplication(Interval a, Interval b);
+  static Interval Division(Interval a, Interval b);
+  // Supports any exponent if the base is positive, a point exponent otherwise
+  static Interval Power(Interval a, Interval b);
+  static Interval AbsoluteValue(Interval a);
+  static Interval SquareRoot(Interval a) { return Power(a, Interval(0.5, 0.5)); }
+  static Interval NaperianLogarithm(Interval a);
+  static Interval Floor(Interval a);
+  static Interval Ceiling(Interval a);
+  static Interval FracPart(Interval a);
+  static Interval SignFunction(Interval a);
+  // Trigonometric functions of angles expressed in radians
+  static Interval Sine(Interval a);
+  static Interval Cosine(Interval a);
+  static Interval Tangent(Interval a);
+  static Interval ArcSine(Interval a) { return Increasing(a, std::asin, -1, 1); }
+  static Interval ArcCosine(Interval a) { return Decreasing(a, std::acos, -1, 1); }
+  static Interval ArcTangent(Interval a) { return Increasing(a, std::atan); }
+  static Interval HyperbolicSine(Interval a) { return Increasing(a, std::sinh); }
+  static Interval HyperbolicCosine(Interval a);
+  static Interval HyperbolicTangent(Interval a) { return Increasing(a, std::tanh); }
+private:
+  /* Images of monotonic functions defined on [domainMin, domainMax]. The part
+   * of a outside this domain is discarded, making the result discontinuous. */
+  static Interval Increasing(Interval a, T (*f)(T), T domainMin = -INFINITY, T domainMax = INFINITY);
+  static Interval Decreasing(Interval a, T (*f)(T), T domainMin = -INFINITY, T domainMax = INFINITY);
+  static Interval Restrict(Interval a, T domainMin, T domainMax);
+  static Interval IntegerPower(Interval a, T n);
+  T m_lowerBound;
+  T m_upperBound;
+  bool m_isContinuous;
+};
+
+}
+
+#endif
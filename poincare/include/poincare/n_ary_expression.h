@@ -40,6 +40,7 @@ protected:
 private:
   int simplificationOrderSameType(const ExpressionNode * e, bool ascending, bool canBeInterrupted) const override;
   int simplificationOrderGreaterType(const ExpressionNode * e, bool ascending, bool canBeInterrupted) const override;
+  uint32_t computeStructuralHash() const override;
 };
 
 class NAryExpression : public Expression {
@@ -28,6 +28,8 @@ private:
     return templatedApproximateWithNextTerm<float>(a, b, complexFormat);
   }
   template<typename T> Evaluation<T> templatedApproximateWithNextTerm(Evaluation<T> a, Evaluation<T> b, Preferences::ComplexFormat complexFormat) const;
+  std::complex<double> scalarWithNextTerm(DoublePrecision p, std::complex<double> a, std::complex<double> b) const override { return a*b; }
+  std::complex<float> scalarWithNextTerm(SinglePrecision p, std::complex<float> a, std::complex<float> b) const override { return a*b; }
 };
 
 class Product final : public Sequence {
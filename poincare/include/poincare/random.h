@@ -38,7 +38,14 @@ private:
   Evaluation<double> approximate(DoublePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override {
     return templateApproximate<double>();
   }
+  std::complex<float> approximateScalar(SinglePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override {
+    return templateApproximateScalar<float>();
+  }
+  std::complex<double> approximateScalar(DoublePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override {
+    return templateApproximateScalar<double>();
+  }
   template <typename T> Evaluation<T> templateApproximate() const;
+  template <typename T> std::complex<T> templateApproximateScalar() const;
 };
 
 class Random final : public Expression {
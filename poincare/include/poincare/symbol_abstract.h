@@ -48,6 +48,8 @@ public:
 
 protected:
   virtual size_t nodeSize() const = 0;
+private:
+  uint32_t computeStructuralHash() const override;
 };
 
 /* WARNING: symbol abstract cannot have any virtual methods. Otherwise,
@@ -82,8 +82,14 @@ public:
   void setParentIdentifier(int id) { node()->setParentIdentifier(id); }
   void deleteParentIdentifier() { node()->deleteParentIdentifier(); }
   void deleteParentIdentifierInChildren() { node()->deleteParentIdentifierInChildren(); }
-  void incrementNumberOfChildren(int increment = 1) { node()->incrementNumberOfChildren(increment); }
-  void decrementNumberOfChildren(int decrement = 1) { node()->decrementNumberOfChildren(decrement); }
+  void incrementNumberOfChildren(int increment = 1) {
+    node()->invalidateCachedHash();
+    node()->incrementNumberOfChildren(increment);
+  }
+  void decrementNumberOfChildren(int decrement = 1) {
+    node()->invalidateCachedHash();
+    node()->decrementNumberOfChildren(decrement);
+  }
   int numberOfDescendants(bool includeSelf) const { return node()->numberOfDescendants(includeSelf); }
 
   /* Hierarchy operations */
@@ -16,6 +16,7 @@
  *  - an identifier
  *  - a parent identifier
  *  - a reference counter
+ *  - a cached hash
  */
 
 /* CAUTION: To make node operations faster, the pool needs all adresses and
@@ -61,6 +62,16 @@ public:
   void release(int currentNumberOfChildren);
   void rename(int identifier, bool unregisterPreviousIdentifier);
 
+  /* Hash cache
+   * A node can cache a hash of its subtree (see
+   * ExpressionNode::structuralHash). 0 means that no hash is cached. The hash
+   * of a node is computed after the hashes of its children so a node without
+   * cached hash never has an ancestor with a cached hash. Every operation that
+   * modifies the children of a node has to invalidate its cached hash. */
+  uint8_t cachedHash() const { return m_cachedHash; }
+  void setCachedHash(uint8_t hash) const { m_cachedHash = hash; }
+  void invalidateCachedHash();
+
   // Hierarchy
   virtual TreeNode * parent() const;
   virtual TreeNode * root();
@@ -175,7 +186,8 @@ protected:
   TreeNode() :
     m_identifier(NoNodeIdentifier),
     m_parentIdentifier(NoNodeIdentifier),
-    m_referenceCounter(0)
+    m_referenceCounter(0),
+    m_cachedHash(0)
   {}
 
 private:
@@ -186,6 +198,7 @@ private:
   int16_t m_identifier;
   int16_t m_parentIdentifier;
   int8_t m_referenceCounter;
+  mutable uint8_t m_cachedHash;
 };
 
 }
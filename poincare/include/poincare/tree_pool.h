@@ -23,7 +23,17 @@ public:
   static TreePool * sharedPool() { assert(SharedStaticPool != nullptr); return SharedStaticPool; }
   static void RegisterPool(TreePool * pool) {  assert(SharedStaticPool == nullptr); SharedStaticPool = pool; }
 
-  TreePool() : m_cursor(buffer()) {}
+  /* The pool keeps a few counters on its memory traffic. They are cheap to
+   * maintain and let us measure the cost of node moves and compactions on a
+   * given workload (the test suite for instance). */
+  struct Statistics {
+    size_t bytesMoved;
+    size_t peakLiveBytes;
+    int numberOfCompactions;
+    int numberOfPoolFullAborts;
+  };
+
+  TreePool() : m_cursor(buffer()), m_statistics{0, 0, 0, 0} {}
 
   // Node
   TreeNode * node(int identifier) const {
@@ -47,6 +57,11 @@ public:
   __attribute__((__used__)) void log() { treeLog(std::cout); }
 #endif
   int numberOfNodes() const;
+  size_t liveBytes() const { return m_cursor - constBuffer(); }
+
+  // Statistics
+  const Statistics & statistics() const { return m_statistics; }
+  void resetStatistics();
 
 private:
   constexpr static int BufferSize = 32768;
@@ -55,6 +70,8 @@ private:
 
   // TreeNode
   void discardTreeNode(TreeNode * node);
+  bool canDiscardTreeAtOnce(TreeNode * node, int nodeNumberOfChildren) const;
+  void discardTree(TreeNode * node, int nodeNumberOfChildren);
   void registerNode(TreeNode * node);
   void unregisterNode(TreeNode * node) {
     freeIdentifier(node->identifier());
@@ -144,6 +161,7 @@ private:
   char * m_cursor;
   IdentifierStack m_identifiers;
   TreeNode * m_nodeForIdentifier[MaxNumberOfNodes];
+  Statistics m_statistics;
 };
 
 }
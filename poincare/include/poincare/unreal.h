@@ -26,6 +26,12 @@ public:
   Evaluation<double> approximate(DoublePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override {
     return templatedApproximate<double>();
   }
+  std::complex<float> approximateScalar(SinglePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override {
+    return templatedApproximateScalar<float>();
+  }
+  std::complex<double> approximateScalar(DoublePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override {
+    return templatedApproximateScalar<double>();
+  }
 
   // Layout
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const override;
@@ -35,6 +41,10 @@ private:
     Expression::SetEncounteredComplex(true);
     return UndefinedNode::templatedApproximate<T>();
   }
+  template<typename T> std::complex<T> templatedApproximateScalar() const {
+    Expression::SetEncounteredComplex(true);
+    return std::complex<T>(NAN, NAN);
+  }
 };
 
 class Unreal final : public Number {
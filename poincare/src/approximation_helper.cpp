@@ -18,8 +18,7 @@ template <typename T> T absMod(T a, T b) {
 static inline int absInt(int x) { return x < 0 ? -x : x; }
 
 template <typename T> int ApproximationHelper::PositiveIntegerApproximationIfPossible(const ExpressionNode * expression, bool * isUndefined, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
-  Evaluation<T> evaluation = expression->approximate(T(), context, complexFormat, angleUnit);
-  T scalar = evaluation.toScalar();
+  T scalar = RealScalar<T>(expression, context, complexFormat, angleUnit);
   if (std::isnan(scalar) || scalar != (int)scalar) {
     *isUndefined = true;
     return 0;
@@ -43,13 +42,13 @@ template<typename T> Evaluation<T> ApproximationHelper::Map(const ExpressionNode
   assert(expression->numberOfChildren() == 1);
   Evaluation<T> input = expression->childAtIndex(0)->approximate(T(), context, complexFormat, angleUnit);
   if (input.type() == EvaluationNode<T>::Type::Complex) {
-    return compute(static_cast<Complex<T> &>(input).stdComplex(), complexFormat, angleUnit);
+    return Complex<T>::Builder(compute(static_cast<Complex<T> &>(input).stdComplex(), complexFormat, angleUnit));
   } else {
     assert(input.type() == EvaluationNode<T>::Type::MatrixComplex);
     MatrixComplex<T> m = static_cast<MatrixComplex<T> &>(input);
     MatrixComplex<T> result = MatrixComplex<T>::Builder();
     for (int i = 0; i < m.numberOfChildren(); i++) {
-      result.addChildAtIndexInPlace(compute(m.complexAtIndex(i), complexFormat, angleUnit), i, i);
+      result.addChildAtIndexInPlace(Complex<T>::Builder(compute(m.complexAtIndex(i), complexFormat, angleUnit)), i, i);
     }
     result.setDimensions(m.numberOfRows(), m.numberOfColumns());
     return std::move(result);
@@ -63,7 +62,7 @@ template<typename T> Evaluation<T> ApproximationHelper::MapReduce(const Expressi
     Evaluation<T> intermediateResult;
     Evaluation<T> nextOperandEvaluation = expression->childAtIndex(i)->approximate(T(), context, complexFormat, angleUnit);
     if (result.type() == EvaluationNode<T>::Type::Complex && nextOperandEvaluation.type() == EvaluationNode<T>::Type::Complex) {
-      intermediateResult = computeOnComplexes(static_cast<Complex<T> &>(result).stdComplex(), static_cast<Complex<T> &>(nextOperandEvaluation).stdComplex(), complexFormat);
+      intermediateResult = Complex<T>::Builder(computeOnComplexes(static_cast<Complex<T> &>(result).stdComplex(), static_cast<Complex<T> &>(nextOperandEvaluation).stdComplex(), complexFormat));
     } else if (result.type() == EvaluationNode<T>::Type::Complex) {
       assert(nextOperandEvaluation.type() == EvaluationNode<T>::Type::MatrixComplex);
       intermediateResult = computeOnComplexAndMatrix(static_cast<Complex<T> &>(result).stdComplex(), static_cast<MatrixComplex<T> &>(nextOperandEvaluation), complexFormat);
@@ -83,10 +82,48 @@ template<typename T> Evaluation<T> ApproximationHelper::MapReduce(const Expressi
   return result;
 }
 
+template<typename T> std::complex<T> ApproximationHelper::ScalarResult(std::complex<T> c) {
+  if (!std::isnan(c.imag()) && c.imag() != static_cast<T>(0.0)) {
+    Expression::SetEncounteredComplex(true);
+  }
+  // Normalize -0
+  if (c.real() == static_cast<T>(0.0)) {
+    c.real(0);
+  }
+  if (c.imag() == static_cast<T>(0.0)) {
+    c.imag(0);
+  }
+  return c;
+}
+
+template<typename T> std::complex<T> ApproximationHelper::MapScalar(const ExpressionNode * expression, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, ComplexCompute<T> compute) {
+  assert(expression->numberOfChildren() == 1);
+  std::complex<T> input = expression->childAtIndex(0)->approximateScalar(T(), context, complexFormat, angleUnit);
+  return ScalarResult(compute(input, complexFormat, angleUnit));
+}
+
+template<typename T> std::complex<T> ApproximationHelper::MapReduceScalar(const ExpressionNode * expression, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, ComplexAndComplexReduction<T> computeOnComplexes) {
+  assert(expression->numberOfChildren() > 0);
+  std::complex<T> result = expression->childAtIndex(0)->approximateScalar(T(), context, complexFormat, angleUnit);
+  for (int i = 1; i < expression->numberOfChildren(); i++) {
+    std::complex<T> nextOperand = expression->childAtIndex(i)->approximateScalar(T(), context, complexFormat, angleUnit);
+    result = ScalarResult(computeOnComplexes(result, nextOperand, complexFormat));
+    if (std::isnan(result.real()) || std::isnan(result.imag())) {
+      return std::complex<T>(NAN, NAN);
+    }
+  }
+  return result;
+}
+
+template<typename T> T ApproximationHelper::RealScalar(const ExpressionNode * expression, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  std::complex<T> c = expression->approximateScalar(T(), context, complexFormat, angleUnit);
+  return c.imag() == static_cast<T>(0.0) ? c.real() : NAN;
+}
+
 template<typename T> MatrixComplex<T> ApproximationHelper::ElementWiseOnMatrixComplexAndComplex(const MatrixComplex<T> m, const std::complex<T> c, Poincare::Preferences::ComplexFormat complexFormat, ComplexAndComplexReduction<T> computeOnComplexes) {
   MatrixComplex<T> matrix = MatrixComplex<T>::Builder();
   for (int i = 0; i < m.numberOfChildren(); i++) {
-    matrix.addChildAtIndexInPlace(computeOnComplexes(m.complexAtIndex(i), c, complexFormat), i, i);
+    matrix.addChildAtIndexInPlace(Complex<T>::Builder(computeOnComplexes(m.complexAtIndex(i), c, complexFormat)), i, i);
   }
   matrix.setDimensions(m.numberOfRows(), m.numberOfColumns());
   return matrix;
@@ -98,7 +135,7 @@ template<typename T> MatrixComplex<T> ApproximationHelper::ElementWiseOnComplexM
   }
   MatrixComplex<T> matrix = MatrixComplex<T>::Builder();
   for (int i = 0; i < m.numberOfChildren(); i++) {
-    matrix.addChildAtIndexInPlace(computeOnComplexes(m.complexAtIndex(i), n.complexAtIndex(i), complexFormat), i, i);
+    matrix.addChildAtIndexInPlace(Complex<T>::Builder(computeOnComplexes(m.complexAtIndex(i), n.complexAtIndex(i), complexFormat)), i, i);
   }
   matrix.setDimensions(m.numberOfRows(), m.numberOfColumns());
   return matrix;
@@ -112,10 +149,18 @@ template Poincare::Evaluation<float> Poincare::ApproximationHelper::Map(const Po
 template Poincare::Evaluation<double> Poincare::ApproximationHelper::Map(const Poincare::ExpressionNode * expression, Poincare::Context * context, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit angleUnit, Poincare::ApproximationHelper::ComplexCompute<double> compute);
 template Poincare::Evaluation<float> Poincare::ApproximationHelper::MapReduce(const Poincare::ExpressionNode * expression, Poincare::Context * context, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit angleUnit, Poincare::ApproximationHelper::ComplexAndComplexReduction<float> computeOnComplexes, Poincare::ApproximationHelper::ComplexAndMatrixReduction<float> computeOnComplexAndMatrix, Poincare::ApproximationHelper::MatrixAndComplexReduction<float> computeOnMatrixAndComplex, Poincare::ApproximationHelper::MatrixAndMatrixReduction<float> computeOnMatrices);
 template Poincare::Evaluation<double> Poincare::ApproximationHelper::MapReduce(const Poincare::ExpressionNode * expression, Poincare::Context * context, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit angleUnit, Poincare::ApproximationHelper::ComplexAndComplexReduction<double> computeOnComplexes, Poincare::ApproximationHelper::ComplexAndMatrixReduction<double> computeOnComplexAndMatrix, Poincare::ApproximationHelper::MatrixAndComplexReduction<double> computeOnMatrixAndComplex, Poincare::ApproximationHelper::MatrixAndMatrixReduction<double> computeOnMatrices);
-template Poincare::MatrixComplex<float> Poincare::ApproximationHelper::ElementWiseOnMatrixComplexAndComplex<float>(const Poincare::MatrixComplex<float>, const std::complex<float>, Poincare::Preferences::ComplexFormat, Poincare::Complex<float> (*)(std::complex<float>, std::complex<float>, Poincare::Preferences::ComplexFormat));
-template Poincare::MatrixComplex<double> Poincare::ApproximationHelper::ElementWiseOnMatrixComplexAndComplex<double>(const Poincare::MatrixComplex<double>, std::complex<double> const, Poincare::Preferences::ComplexFormat, Poincare::Complex<double> (*)(std::complex<double>, std::complex<double>, Poincare::Preferences::ComplexFormat));
-template Poincare::MatrixComplex<float> Poincare::ApproximationHelper::ElementWiseOnComplexMatrices<float>(const Poincare::MatrixComplex<float>, const Poincare::MatrixComplex<float>, Poincare::Preferences::ComplexFormat, Poincare::Complex<float> (*)(std::complex<float>, std::complex<float>, Poincare::Preferences::ComplexFormat));
-template Poincare::MatrixComplex<double> Poincare::ApproximationHelper::ElementWiseOnComplexMatrices<double>(const Poincare::MatrixComplex<double>, const Poincare::MatrixComplex<double>, Poincare::Preferences::ComplexFormat, Poincare::Complex<double> (*)(std::complex<double>, std::complex<double>, Poincare::Preferences::ComplexFormat));
+template std::complex<float> Poincare::ApproximationHelper::ScalarResult<float>(std::complex<float>);
+template std::complex<double> Poincare::ApproximationHelper::ScalarResult<double>(std::complex<double>);
+template std::complex<float> Poincare::ApproximationHelper::MapScalar(const Poincare::ExpressionNode * expression, Poincare::Context * context, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit angleUnit, Poincare::ApproximationHelper::ComplexCompute<float> compute);
+template std::complex<double> Poincare::ApproximationHelper::MapScalar(const Poincare::ExpressionNode * expression, Poincare::Context * context, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit angleUnit, Poincare::ApproximationHelper::ComplexCompute<double> compute);
+template float Poincare::ApproximationHelper::RealScalar<float>(const Poincare::ExpressionNode * expression, Poincare::Context * context, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit angleUnit);
+template double Poincare::ApproximationHelper::RealScalar<double>(const Poincare::ExpressionNode * expression, Poincare::Context * context, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit angleUnit);
+template std::complex<float> Poincare::ApproximationHelper::MapReduceScalar(const Poincare::ExpressionNode * expression, Poincare::Context * context, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit angleUnit, Poincare::ApproximationHelper::ComplexAndComplexReduction<float> computeOnComplexes);
+template std::complex<double> Poincare::ApproximationHelper::MapReduceScalar(const Poincare::ExpressionNode * expression, Poincare::Context * context, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit angleUnit, Poincare::ApproximationHelper::ComplexAndComplexReduction<double> computeOnComplexes);
+template Poincare::MatrixComplex<float> Poincare::ApproximationHelper::ElementWiseOnMatrixComplexAndComplex<float>(const Poincare::MatrixComplex<float>, const std::complex<float>, Poincare::Preferences::ComplexFormat, std::complex<float> (*)(std::complex<float>, std::complex<float>, Poincare::Preferences::ComplexFormat));
+template Poincare::MatrixComplex<double> Poincare::ApproximationHelper::ElementWiseOnMatrixComplexAndComplex<double>(const Poincare::MatrixComplex<double>, std::complex<double> const, Poincare::Preferences::ComplexFormat, std::complex<double> (*)(std::complex<double>, std::complex<double>, Poincare::Preferences::ComplexFormat));
+template Poincare::MatrixComplex<float> Poincare::ApproximationHelper::ElementWiseOnComplexMatrices<float>(const Poincare::MatrixComplex<float>, const Poincare::MatrixComplex<float>, Poincare::Preferences::ComplexFormat, std::complex<float> (*)(std::complex<float>, std::complex<float>, Poincare::Preferences::ComplexFormat));
+template Poincare::MatrixComplex<double> Poincare::ApproximationHelper::ElementWiseOnComplexMatrices<double>(const Poincare::MatrixComplex<double>, const Poincare::MatrixComplex<double>, Poincare::Preferences::ComplexFormat, std::complex<double> (*)(std::complex<double>, std::complex<double>, Poincare::Preferences::ComplexFormat));
 
 
 }
@@ -0,0 +1,445 @@
+#include <poincare/approximation_program.h>
+#include <poincare/absolute_value.h>
+#include <poincare/addition.h>
+#include <poincare/arc_cosine.h>
+#include <poincare/arc_sine.h>
+#include <poincare/arc_tangent.h>
+#include <poincare/ceiling.h>
+#include <poincare/cosine.h>
+#include <poincare/division.h>
+#include <poincare/floor.h>
+#include <poincare/frac_part.h>
+#include <poincare/hyperbolic_cosine.h>
+#include <poincare/hyperbolic_sine.h>
+#include <poincare/hyperbolic_tangent.h>
+#include <poincare/logarithm.h>
+#include <poincare/multiplication.h>
+#include <poincare/naperian_logarithm.h>
+#include <poincare/opposite.h>
+#include <poincare/power.h>
+#include <poincare/sign_function.h>
+#include <poincare/sine.h>
+#include <poincare/square_root.h>
+#include <poincare/subtraction.h>
+#include <poincare/symbol.h>
+#include <poincare/tangent.h>
+#include <poincare/trigonometry.h>
+#include <string.h>
+#include <cmath>
+#include <assert.h>
+
+namespace Poincare {
+
+/* Mirror the ComplexNode constructor: a non-real value would flag the
+ * approximation as complex, and signed zeros are discarded. */
+template<typename T>
+static bool NormalizeReal(std::complex<T> * c) {
+  if (c->imag() != 0.0) {
+    return false;
+  }
+  if (c->real() == 0.0) {
+    c->real(0);
+  }
+  c->imag(0);
+  return true;
+}
+
+template<>
+float ApproximationProgram::constantAtIndex<float>(int i) const {
+  assert(i < m_numberOfConstants);
+  return m_floatConstants[i];
+}
+
+template<>
+double ApproximationProgram::constantAtIndex<double>(int i) const {
+  assert(i < m_numberOfConstants);
+  return m_doubleConstants[i];
+}
+
+static bool DependsOnSymbol(const Expression e, const void * context) {
+  ExpressionNode::Type type = e.type();
+  return type == ExpressionNode::Type::Symbol || type == ExpressionNode::Type::Function || e.isRandom();
+}
+
+void ApproximationProgram::compile(const Expression e, const char * symbol, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  m_numberOfInstructions = 0;
+  m_numberOfConstants = 0;
+  m_complexFormat = complexFormat;
+  m_angleUnit = angleUnit;
+  int stackDepth = 0;
+  bool success = !e.isUninitialized() && compileExpression(e, symbol, context, &stackDepth);
+  assert(!success || stackDepth == 1);
+  m_status = success ? Status::Compiled : Status::Unsupported;
+}
+
+template<typename T>
+bool ApproximationProgram::approximateWithValueForSymbol(T x, T * result) const {
+  if (m_status != Status::Compiled) {
+    return false;
+  }
+  std::complex<T> stack[k_maxStackDepth];
+  int stackDepth = 0;
+  for (int i = 0; i < m_numberOfInstructions; i++) {
+    Instruction instruction = m_instructions[i];
+    std::complex<T> value;
+    if (instruction.type == ExpressionNode::Type::Symbol) {
+      value = x;
+    } else if (instruction.type == ExpressionNode::Type::Float) {
+      value = constantAtIndex<T>(instruction.operand);
+    } else {
+      stackDepth -= instruction.operand;
+      assert(stackDepth >= 0);
+      if (!operate<T>(instruction, stack + stackDepth, &value)) {
+        return false;
+      }
+    }
+    if (!NormalizeReal(&value)) {
+      return false;
+    }
+    assert(stackDepth < k_maxStackDepth);
+    stack[stackDepth++] = value;
+  }
+  assert(stackDepth == 1);
+  *result = stack[0].real();
+  return true;
+}
+
+template<typename T>
+void ApproximationProgram::approximateWithValuesForSymbol(const T * xs, T * ys, bool * approximated, int numberOfValues) const {
+  for (int i = 0; i < numberOfValues; i++) {
+    approximated[i] = false;
+  }
+  if (m_status != Status::Compiled) {
+    return;
+  }
+  std::complex<T> stack[k_maxStackDepth][k_batchLength];
+  bool isApproximated[k_batchLength];
+  for (int first = 0; first < numberOfValues; first += k_batchLength) {
+    const T * x = xs + first;
+    int length = numberOfValues - first < k_batchLength ? numberOfValues - first : k_batchLength;
+    for (int j = 0; j < length; j++) {
+      isApproximated[j] = true;
+    }
+    int stackDepth = 0;
+    for (int i = 0; i < m_numberOfInstructions; i++) {
+      Instruction instruction = m_instructions[i];
+      std::complex<T> * values = stack[stackDepth];
+      if (instruction.type == ExpressionNode::Type::Symbol) {
+        for (int j = 0; j < length; j++) {
+          values[j] = x[j];
+          NormalizeReal(values + j);
+        }
+      } else if (instruction.type == ExpressionNode::Type::Float) {
+        T constant = constantAtIndex<T>(instruction.operand);
+        for (int j = 0; j < length; j++) {
+          values[j] = constant;
+        }
+      } else {
+        int numberOfOperands = instruction.operand;
+        stackDepth -= numberOfOperands;
+        assert(stackDepth >= 0);
+        values = stack[stackDepth];
+        std::complex<T> operands[k_maxStackDepth];
+        for (int j = 0; j < length; j++) {
+          if (!isApproximated[j]) {
+            continue;
+          }
+          for (int k = 0; k < numberOfOperands; k++) {
+            operands[k] = stack[stackDepth + k][j];
+          }
+          isApproximated[j] = operate<T>(instruction, operands, values + j) && NormalizeReal(values + j);
+        }
+      }
+      assert(stackDepth < k_maxStackDepth);
+      stackDepth++;
+    }
+    assert(stackDepth == 1);
+    for (int j = 0; j < length; j++) {
+      if (isApproximated[j]) {
+        ys[first + j] = stack[0][j].real();
+        approximated[first + j] = true;
+      }
+    }
+  }
+}
+
+template<typename T>
+bool ApproximationProgram::approximateOnInterval(Interval<T> x, Interval<T> * result) const {
+  if (m_status != Status::Compiled) {
+    return false;
+  }
+  Interval<T> stack[k_maxStackDepth];
+  int stackDepth = 0;
+  for (int i = 0; i < m_numberOfInstructions; i++) {
+    Instruction instruction = m_instructions[i];
+    Interval<T> value;
+    if (instruction.type == ExpressionNode::Type::Symbol) {
+      value = x;
+    } else if (instruction.type == ExpressionNode::Type::Float) {
+      T constant = constantAtIndex<T>(instruction.operand);
+      value = Interval<T>(constant, constant);
+    } else {
+      stackDepth -= instruction.operand;
+      assert(stackDepth >= 0);
+      if (!operateOnInterval<T>(instruction, stack + stackDepth, &value)) {
+        return false;
+      }
+    }
+    assert(stackDepth < k_maxStackDepth);
+    stack[stackDepth++] = value;
+  }
+  assert(stackDepth == 1);
+  *result = stack[0];
+  return true;
+}
+
+bool ApproximationProgram::compileExpression(const Expression e, const char * symbol, Context * context, int * stackDepth) {
+  ExpressionNode::Type type = e.type();
+  if (type == ExpressionNode::Type::Parenthesis) {
+    return compileExpression(e.childAtIndex(0), symbol, context, stackDepth);
+  }
+  if (type == ExpressionNode::Type::Symbol && strcmp(static_cast<const Symbol &>(e).name(), symbol) == 0) {
+    *stackDepth += 1;
+    return *stackDepth <= k_maxStackDepth && pushInstruction(type, 0);
+  }
+  if (!e.hasExpression(DependsOnSymbol, nullptr)) {
+    /* Approximating the subtree on its own gives the same value as within the
+     * whole expression. A non-real or undefined constant could be hiding an
+     * encountered complex, so it is left to the tree walker. */
+    if (m_numberOfConstants >= k_maxNumberOfConstants) {
+      return false;
+    }
+    double doubleValue = e.approximateToScalar<double>(context, m_complexFormat, m_angleUnit);
+    float floatValue = e.approximateToScalar<float>(context, m_complexFormat, m_angleUnit);
+    if (std::isnan(doubleValue) || std::isnan(floatValue)) {
+      return false;
+    }
+    m_doubleConstants[m_numberOfConstants] = doubleValue;
+    m_floatConstants[m_numberOfConstants] = floatValue;
+    *stackDepth += 1;
+    return *stackDepth <= k_maxStackDepth && pushInstruction(ExpressionNode::Type::Float, m_numberOfConstants++);
+  }
+  int numberOfChildren = e.numberOfChildren();
+  bool isSupported;
+  if (type == ExpressionNode::Type::Addition || type == ExpressionNode::Type::Multiplication) {
+    isSupported = numberOfChildren > 0;
+  } else if (type == ExpressionNode::Type::Logarithm) {
+    isSupported = true;
+  } else if (ReductionFunction<double>(type) != nullptr) {
+    isSupported = numberOfChildren == 2;
+  } else {
+    isSupported = MapFunction<double>(type) != nullptr && numberOfChildren == 1;
+  }
+  if (!isSupported) {
+    return false;
+  }
+  for (int i = 0; i < numberOfChildren; i++) {
+    if (!compileExpression(e.childAtIndex(i), symbol, context, stackDepth)) {
+      return false;
+    }
+  }
+  *stackDepth -= numberOfChildren - 1;
+  return pushInstruction(type, numberOfChildren);
+}
+
+bool ApproximationProgram::pushInstruction(ExpressionNode::Type type, int operand) {
+  if (m_numberOfInstructions >= k_maxNumberOfInstructions) {
+    return false;
+  }
+  m_instructions[m_numberOfInstructions++] = {type, static_cast<uint8_t>(operand)};
+  return true;
+}
+
+template<typename T>
+ApproximationHelper::ComplexCompute<T> ApproximationProgram::MapFunction(ExpressionNode::Type type) {
+  switch (type) {
+    case ExpressionNode::Type::AbsoluteValue:
+      return AbsoluteValueNode::computeOnComplex<T>;
+    case ExpressionNode::Type::ArcCosine:
+      return ArcCosineNode::computeOnComplex<T>;
+    case ExpressionNode::Type::ArcSine:
+      return ArcSineNode::computeOnComplex<T>;
+    case ExpressionNode::Type::ArcTangent:
+      return ArcTangentNode::computeOnComplex<T>;
+    case ExpressionNode::Type::Ceiling:
+      return CeilingNode::computeOnComplex<T>;
+    case ExpressionNode::Type::Cosine:
+      return CosineNode::computeOnComplex<T>;
+    case ExpressionNode::Type::Floor:
+      return FloorNode::computeOnComplex<T>;
+    case ExpressionNode::Type::FracPart:
+      return FracPartNode::computeOnComplex<T>;
+    case ExpressionNode::Type::HyperbolicCosine:
+      return HyperbolicCosineNode::computeOnComplex<T>;
+    case ExpressionNode::Type::HyperbolicSine:
+      return HyperbolicSineNode::computeOnComplex<T>;
+    case ExpressionNode::Type::HyperbolicTangent:
+      return HyperbolicTangentNode::computeOnComplex<T>;
+    case ExpressionNode::Type::Logarithm:
+      return LogarithmNode<1>::computeOnComplex<T>;
+    case ExpressionNode::Type::NaperianLogarithm:
+      return NaperianLogarithmNode::computeOnComplex<T>;
+    case ExpressionNode::Type::Opposite:
+      return OppositeNode::compute<T>;
+    case ExpressionNode::Type::SignFunction:
+      return SignFunctionNode::computeOnComplex<T>;
+    case ExpressionNode::Type::Sine:
+      return SineNode::computeOnComplex<T>;
+    case ExpressionNode::Type::SquareRoot:
+      return SquareRootNode::computeOnComplex<T>;
+    case ExpressionNode::Type::Tangent:
+      return TangentNode::computeOnComplex<T>;
+    default:
+      return nullptr;
+  }
+}
+
+template<typename T>
+ApproximationHelper::ComplexAndComplexReduction<T> ApproximationProgram::ReductionFunction(ExpressionNode::Type type) {
+  switch (type) {
+    case ExpressionNode::Type::Addition:
+      return AdditionNode::compute<T>;
+    case ExpressionNode::Type::Division:
+      return DivisionNode::compute<T>;
+    case ExpressionNode::Type::Multiplication:
+      return MultiplicationNode::compute<T>;
+    case ExpressionNode::Type::Power:
+      return PowerNode::compute<T>;
+    case ExpressionNode::Type::Subtraction:
+      return SubtractionNode::compute<T>;
+    default:
+      return nullptr;
+  }
+}
+
+template<typename T>
+bool ApproximationProgram::operate(Instruction instruction, std::complex<T> * operands, std::complex<T> * result) const {
+  int numberOfOperands = instruction.operand;
+  if (instruction.type == ExpressionNode::Type::Logarithm && numberOfOperands == 2) {
+    // Same as LogarithmNode<2>::templatedApproximate
+    std::complex<T> logx = LogarithmNode<2>::computeOnComplex<T>(operands[0], m_complexFormat, m_angleUnit);
+    std::complex<T> logn = LogarithmNode<2>::computeOnComplex<T>(operands[1], m_complexFormat, m_angleUnit);
+    if (!NormalizeReal(&logx) || !NormalizeReal(&logn)) {
+      return false;
+    }
+    *result = DivisionNode::compute<T>(logx, logn, m_complexFormat);
+    return true;
+  }
+  ApproximationHelper::ComplexAndComplexReduction<T> reduction = ReductionFunction<T>(instruction.type);
+  if (reduction == nullptr) {
+    assert(numberOfOperands == 1);
+    *result = MapFunction<T>(instruction.type)(operands[0], m_complexFormat, m_angleUnit);
+    return true;
+  }
+  // Same as ApproximationHelper::MapReduce
+  *result = operands[0];
+  for (int i = 1; i < numberOfOperands; i++) {
+    *result = reduction(*result, operands[i], m_complexFormat);
+    if (i < numberOfOperands - 1 && !NormalizeReal(result)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename T>
+bool ApproximationProgram::operateOnInterval(Instruction instruction, Interval<T> * operands, Interval<T> * result) const {
+  int numberOfOperands = instruction.operand;
+  T pi = Trigonometry::PiInAngleUnit(m_angleUnit);
+  Interval<T> toRadian(M_PI/pi, M_PI/pi);
+  Interval<T> toAngleUnit(pi/M_PI, pi/M_PI);
+  switch (instruction.type) {
+    case ExpressionNode::Type::Addition:
+    case ExpressionNode::Type::Multiplication:
+      *result = operands[0];
+      for (int i = 1; i < numberOfOperands; i++) {
+        *result = instruction.type == ExpressionNode::Type::Addition ? Interval<T>::Addition(*result, operands[i]) : Interval<T>::Multiplication(*result, operands[i]);
+      }
+      return true;
+    case ExpressionNode::Type::Subtraction:
+      *result = Interval<T>::Subtraction(operands[0], operands[1]);
+      return true;
+    case ExpressionNode::Type::Division:
+      *result = Interval<T>::Division(operands[0], operands[1]);
+      return true;
+    case ExpressionNode::Type::Power:
+      // Negative numbers only have real powers at isolated exponents
+      if (!operands[1].isPoint() && !(operands[0].lowerBound() > static_cast<T>(0.0))) {
+        return false;
+      }
+      *result = Interval<T>::Power(operands[0], operands[1]);
+      return true;
+    case ExpressionNode::Type::Logarithm:
+    {
+      T base = numberOfOperands == 2 ? operands[1].lowerBound() : static_cast<T>(10.0);
+      if (numberOfOperands == 2 && (!operands[1].isPoint() || !(base > static_cast<T>(0.0)) || base == static_cast<T>(1.0))) {
+        return false;
+      }
+      Interval<T> inverseLogBase(static_cast<T>(1.0)/std::log(base), static_cast<T>(1.0)/std::log(base));
+      *result = Interval<T>::Multiplication(Interval<T>::NaperianLogarithm(operands[0]), inverseLogBase);
+      return true;
+    }
+    case ExpressionNode::Type::AbsoluteValue:
+      *result = Interval<T>::AbsoluteValue(operands[0]);
+      return true;
+    case ExpressionNode::Type::ArcCosine:
+      *result = Interval<T>::Multiplication(Interval<T>::ArcCosine(operands[0]), toAngleUnit);
+      return true;
+    case ExpressionNode::Type::ArcSine:
+      *result = Interval<T>::Multiplication(Interval<T>::ArcSine(operands[0]), toAngleUnit);
+      return true;
+    case ExpressionNode::Type::ArcTangent:
+      *result = Interval<T>::Multiplication(Interval<T>::ArcTangent(operands[0]), toAngleUnit);
+      return true;
+    case ExpressionNode::Type::Ceiling:
+      *result = Interval<T>::Ceiling(operands[0]);
+      return true;
+    case ExpressionNode::Type::Cosine:
+      *result = Interval<T>::Cosine(Interval<T>::Multiplication(operands[0], toRadian));
+      return true;
+    case ExpressionNode::Type::Floor:
+      *result = Interval<T>::Floor(operands[0]);
+      return true;
+    case ExpressionNode::Type::FracPart:
+      *result = Interval<T>::FracPart(operands[0]);
+      return true;
+    case ExpressionNode::Type::HyperbolicCosine:
+      *result = Interval<T>::HyperbolicCosine(operands[0]);
+      return true;
+    case ExpressionNode::Type::HyperbolicSine:
+      *result = Interval<T>::HyperbolicSine(operands[0]);
+      return true;
+    case ExpressionNode::Type::HyperbolicTangent:
+      *result = Interval<T>::HyperbolicTangent(operands[0]);
+      return true;
+    case ExpressionNode::Type::NaperianLogarithm:
+      *result = Interval<T>::NaperianLogarithm(operands[0]);
+      return true;
+    case ExpressionNode::Type::Opposite:
+      *result = Interval<T>::Opposite(operands[0]);
+      return true;
+    case ExpressionNode::Type::SignFunction:
+      *result = Interval<T>::SignFunction(operands[0]);
+      return true;
+    case ExpressionNode::Type::Sine:
+      *result = Interval<T>::Sine(Interval<T>::Multiplication(operands[0], toRadian));
+      return true;
+    case ExpressionNode::Type::SquareRoot:
+      *result = Interval<T>::SquareRoot(operands[0]);
+      return true;
+    case ExpressionNode::Type::Tangent:
+      *result = Interval<T>::Tangent(Interval<T>::Multiplication(operands[0], toRadian));
+      return true;
+    default:
+      return false;
+  }
+}
+
+template bool ApproximationProgram::approximateWithValueForSymbol<float>(float, float *) const;
+template bool ApproximationProgram::approximateWithValueForSymbol<double>(double, double *) const;
+template void ApproximationProgram::approximateWithValuesForSymbol<float>(const float *, float *, bool *, int) const;
+template void ApproximationProgram::approximateWithValuesForSymbol<double>(const double *, double *, bool *, int) const;
+template bool ApproximationProgram::approximateOnInterval<float>(Interval<float>, Interval<float> *) const;
+template bool ApproximationProgram::approximateOnInterval<double>(Interval<double>, Interval<double> *) const;
+
+}
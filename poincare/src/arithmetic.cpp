@@ -1,8 +1,55 @@
 #include <poincare/arithmetic.h>
+#include <assert.h>
 #include <utility>
 
 namespace Poincare {
 
+/* Integers that fit in two digits are handled with native arithmetic, which
+ * spares building a node in the pool for each intermediate result. */
+
+static bool ExtractNativeInteger(const Integer & i, double_native_uint_t * value) {
+  if (i.isOverflow() || i.numberOfDigits() > 2) {
+    return false;
+  }
+  const native_uint_t * digits = i.digits();
+  *value = i.numberOfDigits() == 0 ? 0 : digits[0];
+  if (i.numberOfDigits() == 2) {
+    *value |= static_cast<double_native_uint_t>(digits[1]) << (8*sizeof(native_uint_t));
+  }
+  return true;
+}
+
+static Integer BuildNativeInteger(double_native_uint_t value) {
+  native_uint_t digits[2] = {static_cast<native_uint_t>(value), static_cast<native_uint_t>(value >> (8*sizeof(native_uint_t)))};
+  return Integer::BuildInteger(digits, value == 0 ? 0 : (digits[1] == 0 ? 1 : 2), false);
+}
+
+static double_native_uint_t NativeGCD(double_native_uint_t a, double_native_uint_t b) {
+  // Binary GCD: only shifts and subtractions
+  if (a == 0 || b == 0) {
+    return a | b;
+  }
+  int shift = 0;
+  while (((a | b) & 1) == 0) {
+    a >>= 1;
+    b >>= 1;
+    shift++;
+  }
+  while ((a & 1) == 0) {
+    a >>= 1;
+  }
+  do {
+    while ((b & 1) == 0) {
+      b >>= 1;
+    }
+    if (a > b) {
+      std::swap(a, b);
+    }
+    b -= a;
+  } while (b != 0);
+  return a << shift;
+}
+
 Integer Arithmetic::LCM(const Integer & a, const Integer & b) {
   if (a.isZero() || b.isZero()) {
     return Integer(0);
@@ -17,6 +64,11 @@ Integer Arithmetic::GCD(const Integer & a, const Integer & b) {
     return Integer::Overflow(false);
   }
 
+  double_native_uint_t nativeA, nativeB;
+  if (ExtractNativeInteger(a, &nativeA) && ExtractNativeInteger(b, &nativeB)) {
+    return BuildNativeInteger(NativeGCD(nativeA, nativeB));
+  }
+
   Integer i = a;
   Integer j = b;
   i.setNegative(false);
@@ -39,7 +91,192 @@ Integer Arithmetic::GCD(const Integer & a, const Integer & b) {
 const short primeFactors[Arithmetic::k_numberOfPrimeFactors] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227, 229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283, 293, 307, 311, 313, 317, 331, 337, 347, 349, 353, 359, 367, 373, 379, 383, 389, 397, 401, 409, 419, 421, 431, 433, 439, 443, 449, 457, 461, 463, 467, 479, 487, 491, 499, 503, 509, 521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593, 599, 601, 607, 613, 617, 619, 631, 641, 643, 647, 653, 659, 661, 673, 677, 683, 691, 701, 709, 719, 727, 733, 739, 743, 751, 757, 761, 769, 773, 787, 797, 809, 811, 821, 823, 827, 829, 839, 853, 857, 859, 863, 877, 881, 883, 887, 907, 911, 919, 929, 937, 941, 947, 953, 967, 971, 977, 983, 991, 997, 1009, 1013, 1019, 1021, 1031, 1033, 1039, 1049, 1051, 1061, 1063, 1069, 1087, 1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129, 1151, 1153, 1163, 1171, 1181, 1187, 1193, 1201, 1213, 1217, 1223, 1229, 1231, 1237, 1249, 1259, 1277, 1279, 1283, 1289, 1291, 1297, 1301, 1303, 1307, 1319, 1321, 1327, 1361, 1367, 1373, 1381, 1399, 1409, 1423, 1427, 1429, 1433, 1439, 1447, 1451, 1453, 1459, 1471, 1481, 1483, 1487, 1489, 1493, 1499, 1511, 1523, 1531, 1543, 1549, 1553, 1559, 1567, 1571, 1579, 1583, 1597, 1601, 1607, 1609, 1613, 1619, 1621, 1627, 1637, 1657, 1663, 1667, 1669, 1693, 1697, 1699, 1709, 1721, 1723, 1733, 1741, 1747, 1753, 1759, 1777, 1783, 1787, 1789, 1801, 1811, 1823, 1831, 1847, 1861, 1867, 1871, 1873, 1877, 1879, 1889, 1901, 1907, 1913, 1931, 1933, 1949, 1951, 1973, 1979, 1987, 1993, 1997, 1999, 2003, 2011, 2017, 2027, 2029, 2039, 2053, 2063, 2069, 2081, 2083, 2087, 2089, 2099, 2111, 2113, 2129, 2131, 2137, 2141, 2143, 2153, 2161, 2179, 2203, 2207, 2213, 2221, 2237, 2239, 2243, 2251, 2267, 2269, 2273, 2281, 2287, 2293, 2297, 2309, 2311, 2333, 2339, 2341, 2347, 2351, 2357, 2371, 2377, 2381, 2383, 2389, 2393, 2399, 2411, 2417, 2423, 2437, 2441, 2447, 2459, 2467, 2473, 2477, 2503, 2521, 2531, 2539, 2543, 2549, 2551, 2557, 2579, 2591, 2593, 2609, 2617, 2621, 2633, 2647, 2657, 2659, 2663, 2671, 2677, 2683, 2687, 2689, 2693, 2699, 2707, 2711, 2713, 2719, 2729, 2731, 2741, 2749, 2753, 2767, 2777, 2789, 2791, 2797, 2801, 2803, 2819, 2833, 2837, 2843, 2851, 2857, 2861, 2879, 2887, 2897, 2903, 2909, 2917, 2927, 2939, 2953, 2957, 2963, 2969, 2971, 2999, 3001, 3011, 3019, 3023, 3037, 3041, 3049, 3061, 3067, 3079, 3083, 3089, 3109, 3119, 3121, 3137, 3163, 3167, 3169, 3181, 3187, 3191, 3203, 3209, 3217, 3221, 3229, 3251, 3253, 3257, 3259, 3271, 3299, 3301, 3307, 3313, 3319, 3323, 3329, 3331, 3343, 3347, 3359, 3361, 3371, 3373, 3389, 3391, 3407, 3413, 3433, 3449, 3457, 3461, 3463, 3467, 3469, 3491, 3499, 3511, 3517, 3527, 3529, 3533, 3539, 3541, 3547, 3557, 3559, 3571, 3581, 3583, 3593, 3607, 3613, 3617, 3623, 3631, 3637, 3643,
   3659, 3671, 3673, 3677, 3691, 3697, 3701, 3709, 3719, 3727, 3733, 3739, 3761, 3767, 3769, 3779, 3793, 3797, 3803, 3821, 3823, 3833, 3847, 3851, 3853, 3863, 3877, 3881, 3889, 3907, 3911, 3917, 3919, 3923, 3929, 3931, 3943, 3947, 3967, 3989, 4001, 4003, 4007, 4013, 4019, 4021, 4027, 4049, 4051, 4057, 4073, 4079, 4091, 4093, 4099, 4111, 4127, 4129, 4133, 4139, 4153, 4157, 4159, 4177, 4201, 4211, 4217, 4219, 4229, 4231, 4241, 4243, 4253, 4259, 4261, 4271, 4273, 4283, 4289, 4297, 4327, 4337, 4339, 4349, 4357, 4363, 4373, 4391, 4397, 4409, 4421, 4423, 4441, 4447, 4451, 4457, 4463, 4481, 4483, 4493, 4507, 4513, 4517, 4519, 4523, 4547, 4549, 4561, 4567, 4583, 4591, 4597, 4603, 4621, 4637, 4639, 4643, 4649, 4651, 4657, 4663, 4673, 4679, 4691, 4703, 4721, 4723, 4729, 4733, 4751, 4759, 4783, 4787, 4789, 4793, 4799, 4801, 4813, 4817, 4831, 4861, 4871, 4877, 4889, 4903, 4909, 4919, 4931, 4933, 4937, 4943, 4951, 4957, 4967, 4969, 4973, 4987, 4993, 4999, 5003, 5009, 5011, 5021, 5023, 5039, 5051, 5059, 5077, 5081, 5087, 5099, 5101, 5107, 5113, 5119, 5147, 5153, 5167, 5171, 5179, 5189, 5197, 5209, 5227, 5231, 5233, 5237, 5261, 5273, 5279, 5281, 5297, 5303, 5309, 5323, 5333, 5347, 5351, 5381, 5387, 5393, 5399, 5407, 5413, 5417, 5419, 5431, 5437, 5441, 5443, 5449, 5471, 5477, 5479, 5483, 5501, 5503, 5507, 5519, 5521, 5527, 5531, 5557, 5563, 5569, 5573, 5581, 5591, 5623, 5639, 5641, 5647, 5651, 5653, 5657, 5659, 5669, 5683, 5689, 5693, 5701, 5711, 5717, 5737, 5741, 5743, 5749, 5779, 5783, 5791, 5801, 5807, 5813, 5821, 5827, 5839, 5843, 5849, 5851, 5857, 5861, 5867, 5869, 5879, 5881, 5897, 5903, 5923, 5927, 5939, 5953, 5981, 5987, 6007, 6011, 6029, 6037, 6043, 6047, 6053, 6067, 6073, 6079, 6089, 6091, 6101, 6113, 6121, 6131, 6133, 6143, 6151, 6163, 6173, 6197, 6199, 6203, 6211, 6217, 6221, 6229, 6247, 6257, 6263, 6269, 6271, 6277, 6287, 6299, 6301, 6311, 6317, 6323, 6329, 6337, 6343, 6353, 6359, 6361, 6367, 6373, 6379, 6389, 6397, 6421, 6427, 6449, 6451, 6469, 6473, 6481, 6491, 6521, 6529, 6547, 6551, 6553, 6563, 6569, 6571, 6577, 6581, 6599, 6607, 6619, 6637, 6653, 6659, 6661, 6673, 6679, 6689, 6691, 6701, 6703, 6709, 6719, 6733, 6737, 6761, 6763, 6779, 6781, 6791, 6793, 6803, 6823, 6827, 6829, 6833, 6841, 6857, 6863, 6869, 6871, 6883, 6899, 6907, 6911, 6917, 6947, 6949, 6959, 6961, 6967, 6971, 6977, 6983, 6991, 6997, 7001, 7013, 7019, 7027, 7039, 7043, 7057, 7069, 7079, 7103, 7109, 7121, 7127, 7129, 7151, 7159, 7177, 7187, 7193, 7207, 7211, 7213, 7219, 7229, 7237, 7243, 7247, 7253, 7283, 7297, 7307, 7309, 7321, 7331, 7333, 7349, 7351, 7369, 7393, 7411, 7417, 7433, 7451, 7457, 7459, 7477, 7481, 7487, 7489, 7499, 7507, 7517, 7523, 7529, 7537, 7541, 7547, 7549, 7559, 7561, 7573, 7577, 7583, 7589, 7591, 7603, 7607, 7621, 7639, 7643, 7649, 7669, 7673, 7681, 7687, 7691, 7699, 7703, 7717, 7723, 7727, 7741, 7753, 7757, 7759, 7789, 7793, 7817, 7823, 7829, 7841, 7853, 7867, 7873, 7877, 7879, 7883, 7901, 7907, 7919};
 
-// we can go to 7907*7907 = 62 520 649
+/* MontgomeryModulus computes modulo an odd n < 2^64 on numbers in Montgomery
+ * form x*R mod n, with R = 2^64, so that a modular product needs no division.
+ * 128-bit products are computed on 32-bit halves as the device has no
+ * 128-bit type. */
+
+class MontgomeryModulus {
+public:
+  MontgomeryModulus(double_native_uint_t n);
+  double_native_uint_t one() const { return m_one; }
+  double_native_uint_t fromNative(double_native_uint_t a) const { return multiplication(a % m_n, m_rSquared); }
+  double_native_uint_t addition(double_native_uint_t a, double_native_uint_t b) const {
+    return a >= m_n - b ? a - (m_n - b) : a + b;
+  }
+  double_native_uint_t multiplication(double_native_uint_t a, double_native_uint_t b) const;
+  double_native_uint_t power(double_native_uint_t a, double_native_uint_t e) const;
+private:
+  double_native_uint_t m_n;
+  double_native_uint_t m_inverse; // n*m_inverse = 1 mod R
+  double_native_uint_t m_one; // R mod n
+  double_native_uint_t m_rSquared; // R^2 mod n
+};
+
+static void NativeMultiplication(double_native_uint_t a, double_native_uint_t b, double_native_uint_t * high, double_native_uint_t * low) {
+  constexpr int halfSize = 8*sizeof(native_uint_t);
+  constexpr double_native_uint_t halfMask = static_cast<native_uint_t>(-1);
+  double_native_uint_t lowLow = (a & halfMask) * (b & halfMask);
+  double_native_uint_t lowHigh = (a & halfMask) * (b >> halfSize);
+  double_native_uint_t highLow = (a >> halfSize) * (b & halfMask);
+  double_native_uint_t highHigh = (a >> halfSize) * (b >> halfSize);
+  double_native_uint_t middle = (lowLow >> halfSize) + (lowHigh & halfMask) + (highLow & halfMask);
+  *low = (middle << halfSize) | (lowLow & halfMask);
+  *high = highHigh + (lowHigh >> halfSize) + (highLow >> halfSize) + (middle >> halfSize);
+}
+
+MontgomeryModulus::MontgomeryModulus(double_native_uint_t n) :
+  m_n(n),
+  m_inverse(n)
+{
+  assert(n > 1 && (n & 1) == 1);
+  // Each Newton step doubles the number of correct bits, n being its own inverse on 3 bits
+  for (int i = 0; i < 5; i++) {
+    m_inverse *= 2 - n*m_inverse;
+  }
+  assert(n*m_inverse == 1);
+  m_one = (0 - n) % n;
+  m_rSquared = m_one;
+  for (size_t i = 0; i < 8*sizeof(double_native_uint_t); i++) {
+    m_rSquared = addition(m_rSquared, m_rSquared);
+  }
+}
+
+double_native_uint_t MontgomeryModulus::multiplication(double_native_uint_t a, double_native_uint_t b) const {
+  /* Return a*b/R mod n: a*b - q*n is divisible by R for q = a*b*m_inverse, so
+   * it is the difference of the high words of a*b and q*n, in ]-n,n[. */
+  double_native_uint_t high, low, qnHigh, qnLow;
+  NativeMultiplication(a, b, &high, &low);
+  NativeMultiplication(low*m_inverse, m_n, &qnHigh, &qnLow);
+  return high >= qnHigh ? high - qnHigh : high - qnHigh + m_n;
+}
+
+double_native_uint_t MontgomeryModulus::power(double_native_uint_t a, double_native_uint_t e) const {
+  double_native_uint_t result = m_one;
+  while (e > 0) {
+    if (e & 1) {
+      result = multiplication(result, a);
+    }
+    a = multiplication(a, a);
+    e >>= 1;
+  }
+  return result;
+}
+
+static bool IsNativePrime(double_native_uint_t n) {
+  /* Miller-Rabin test of an odd n: testing the 12 first primes, up to 37, as
+   * witnesses is deterministic for n < 3.18E23, hence for any n < 2^64. */
+  assert(n > static_cast<double_native_uint_t>(primeFactors[Arithmetic::k_numberOfPrimeFactors-1]));
+  assert((n & 1) == 1);
+  MontgomeryModulus modulus(n);
+  double_native_uint_t minusOne = n - modulus.one();
+  double_native_uint_t oddPart = n - 1;
+  int numberOfSquarings = 0;
+  while ((oddPart & 1) == 0) {
+    oddPart >>= 1;
+    numberOfSquarings++;
+  }
+  for (int k = 0; k < 12; k++) {
+    double_native_uint_t x = modulus.power(modulus.fromNative(primeFactors[k]), oddPart);
+    if (x == modulus.one() || x == minusOne) {
+      continue;
+    }
+    int i = 1;
+    while (i < numberOfSquarings && x != minusOne) {
+      x = modulus.multiplication(x, x);
+      i++;
+    }
+    if (x != minusOne) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static double_native_uint_t PollardRhoDivisor(double_native_uint_t n) {
+  /* Brent's variant of Pollard's rho: iterate x -> x^2+c until the sequence
+   * cycles modulo a prime divisor of n, gathering the differences in batches
+   * to compute a single gcd for each batch. When a batch catches the whole n,
+   * go back over its differences one at a time. */
+  assert((n & 1) == 1 && !IsNativePrime(n));
+  constexpr double_native_uint_t k_batchSize = 128;
+  MontgomeryModulus modulus(n);
+  for (double_native_uint_t c = 1; ; c++) {
+    double_native_uint_t increment = modulus.fromNative(c);
+    double_native_uint_t y = modulus.fromNative(2);
+    double_native_uint_t x = y;
+    double_native_uint_t savedY = y;
+    double_native_uint_t product = modulus.one();
+    double_native_uint_t divisor = 1;
+    for (double_native_uint_t length = 1; divisor == 1; length *= 2) {
+      x = y;
+      for (double_native_uint_t i = 0; i < length; i++) {
+        y = modulus.addition(modulus.multiplication(y, y), increment);
+      }
+      for (double_native_uint_t k = 0; k < length && divisor == 1; k += k_batchSize) {
+        savedY = y;
+        for (double_native_uint_t i = 0; i < k_batchSize && k + i < length; i++) {
+          y = modulus.addition(modulus.multiplication(y, y), increment);
+          product = modulus.multiplication(product, x > y ? x - y : y - x);
+        }
+        divisor = NativeGCD(product, n);
+      }
+    }
+    if (divisor == n) {
+      /* One of the differences of the last batch shares a divisor with n:
+       * step through the batch again until the first one that does. */
+      do {
+        savedY = modulus.addition(modulus.multiplication(savedY, savedY), increment);
+        divisor = NativeGCD(x > savedY ? x - savedY : savedY - x, n);
+      } while (divisor == 1);
+    }
+    if (divisor != 1 && divisor != n) {
+      return divisor;
+    }
+  }
+}
+
+/* Factorize an n < 2^64 without prime factors below the last prime of the
+ * table: it has at most 4 prime factors since 7919^5 > 2^64. */
+constexpr static int k_maxNumberOfNativePrimeFactors = 4;
+
+static int NativePrimeFactorization(double_native_uint_t n, double_native_uint_t factors[]) {
+  double_native_uint_t composites[k_maxNumberOfNativePrimeFactors];
+  int numberOfComposites = 1;
+  composites[0] = n;
+  int numberOfFactors = 0;
+  while (numberOfComposites > 0) {
+    double_native_uint_t c = composites[--numberOfComposites];
+    if (IsNativePrime(c)) {
+      assert(numberOfFactors < k_maxNumberOfNativePrimeFactors);
+      // Insert c so that factors are sorted
+      int i = numberOfFactors++;
+      while (i > 0 && factors[i-1] > c) {
+        factors[i] = factors[i-1];
+        i--;
+      }
+      factors[i] = c;
+      continue;
+    }
+    double_native_uint_t d = PollardRhoDivisor(c);
+    assert(numberOfComposites + 2 <= k_maxNumberOfNativePrimeFactors);
+    composites[numberOfComposites++] = d;
+    composites[numberOfComposites++] = c/d;
+  }
+  return numberOfFactors;
+}
+
+static void AddPrimeFactor(const Integer & factor, Integer outputFactors[], Integer outputCoefficients[], int outputLength, int * numberOfFactors) {
+  // Factors are found in increasing order
+  if (*numberOfFactors == 0 || !outputFactors[*numberOfFactors-1].isEqualTo(factor)) {
+    assert(*numberOfFactors < outputLength);
+    outputFactors[*numberOfFactors] = factor;
+    outputCoefficients[*numberOfFactors] = Integer(0);
+    (*numberOfFactors)++;
+  }
+  outputCoefficients[*numberOfFactors-1] = Integer::Addition(outputCoefficients[*numberOfFactors-1], Integer(1));
+}
+
 int Arithmetic::PrimeFactorization(const Integer & n, Integer outputFactors[], Integer outputCoefficients[], int outputLength) {
   assert(!n.isOverflow());
 
@@ -47,9 +284,6 @@ int Arithmetic::PrimeFactorization(const Integer & n, Integer outputFactors[], I
   Integer m = n;
   m.setNegative(false);
 
-  /* First we look for prime divisors in the table primeFactors (to speed up
-   * the prime factorization for low numbers). When k_numberOfPrimeFactors is
-   * overflow, try every number as divisor. */
   if (Integer::NaturalOrder(m, Integer(1)) == 0) {
     return 0;
   }
@@ -64,38 +298,59 @@ int Arithmetic::PrimeFactorization(const Integer & n, Integer outputFactors[], I
 
   int t = 0; // n prime factor index
   int k = 0; // prime factor index
-  Integer testedPrimeFactor((int)primeFactors[k]); // prime factor
-  outputFactors[t] = testedPrimeFactor;
-  IntegerDivision d = {.quotient = 0, .remainder = 0};
-  bool stopCondition;
-  do {
-    stopCondition = Integer::NaturalOrder(Integer::Power(outputFactors[t], Integer(2)), m) < 0;
-    d = Integer::Division(m, testedPrimeFactor);
+
+  /* First, look for prime divisors of m among the table primeFactors, and
+   * then among every following integer, as long as m does not fit in a native
+   * word. */
+  Integer testedPrimeFactor((int)primeFactors[k]);
+  double_native_uint_t nativeM;
+  while (!ExtractNativeInteger(m, &nativeM)) {
+    if (Integer::NaturalOrder(testedPrimeFactor, Integer(k_biggestPrimeFactor)) >= 0) {
+      /* Special case 2: We do not want to break i in prime factor because it
+       * take too much time: the remaining cofactor does not fit in a native
+       * word and its prime factors are above k_biggestPrimeFactor.
+       * outputCoefficients[0] is set to -1 to indicate a special case. */
+      return -2;
+    }
+    IntegerDivision d = Integer::Division(m, testedPrimeFactor);
     if (d.remainder.isZero()) {
-      outputCoefficients[t] = Integer::Addition(outputCoefficients[t], Integer(1));
+      AddPrimeFactor(testedPrimeFactor, outputFactors, outputCoefficients, outputLength, &t);
       m = d.quotient;
-      if (m.isOne()) {
-        return t+1;
-      }
       continue;
     }
-    if (!outputCoefficients[t].isZero()) {
-      t++;
-    }
     k++;
     testedPrimeFactor = k < k_numberOfPrimeFactors ? Integer((int)primeFactors[k]) : Integer::Addition(testedPrimeFactor, Integer(1));
-    outputFactors[t] = testedPrimeFactor;
-  } while (stopCondition && Integer::NaturalOrder(testedPrimeFactor,Integer(k_biggestPrimeFactor)) < 0);
-  if (Integer::NaturalOrder(Integer::Power(Integer(k_biggestPrimeFactor), Integer(2)), m) < 0) {
-    /* Special case 2: We do not want to break i in prime factor because it
-     * take too much time: the prime factor that should be tested is above
-     * k_biggestPrimeFactor.
-     * outputCoefficients[0] is set to -1 to indicate a special case. */
-    return -2;
   }
-  outputFactors[t] = m;
-  outputCoefficients[t] = Integer::Addition(outputCoefficients[t], Integer(1));
-  return t+1;
+
+  // Then go on with native trial divisions by the remaining primes of the table
+  for (; k < k_numberOfPrimeFactors && nativeM > 1; k++) {
+    double_native_uint_t p = static_cast<double_native_uint_t>(primeFactors[k]);
+    if (p*p > nativeM) {
+      // nativeM has no divisor below its square root
+      break;
+    }
+    while (nativeM % p == 0) {
+      AddPrimeFactor(Integer((int)p), outputFactors, outputCoefficients, outputLength, &t);
+      nativeM /= p;
+    }
+  }
+  if (nativeM == 1) {
+    return t;
+  }
+  double_native_uint_t lastPrime = k < k_numberOfPrimeFactors ? primeFactors[k] : 0;
+  if (lastPrime*lastPrime > nativeM) {
+    AddPrimeFactor(BuildNativeInteger(nativeM), outputFactors, outputCoefficients, outputLength, &t);
+    return t;
+  }
+
+  /* Finally, the prime factors of the cofactor are all above the table: split
+   * it with Pollard's rho algorithm. */
+  double_native_uint_t nativeFactors[k_maxNumberOfNativePrimeFactors];
+  int numberOfNativeFactors = NativePrimeFactorization(nativeM, nativeFactors);
+  for (int i = 0; i < numberOfNativeFactors; i++) {
+    AddPrimeFactor(BuildNativeInteger(nativeFactors[i]), outputFactors, outputCoefficients, outputLength, &t);
+  }
+  return t;
 }
 
 }
@@ -24,17 +24,13 @@ int BinomCDFNode::serialize(char * buffer, int bufferSize, Preferences::PrintFlo
 }
 
 template<typename T>
-Evaluation<T> BinomCDFNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  Evaluation<T> xEvaluation = childAtIndex(0)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> nEvaluation = childAtIndex(1)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> pEvaluation = childAtIndex(2)->approximate(T(), context, complexFormat, angleUnit);
-
-  const T x = xEvaluation.toScalar();
-  const T n = nEvaluation.toScalar();
-  const T p = pEvaluation.toScalar();
+std::complex<T> BinomCDFNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  const T x = ApproximationHelper::RealScalar<T>(childAtIndex(0), context, complexFormat, angleUnit);
+  const T n = ApproximationHelper::RealScalar<T>(childAtIndex(1), context, complexFormat, angleUnit);
+  const T p = ApproximationHelper::RealScalar<T>(childAtIndex(2), context, complexFormat, angleUnit);
 
   // CumulativeDistributiveFunctionAtAbscissa handles bad mu and var values
-  return Complex<T>::Builder(BinomialDistribution::CumulativeDistributiveFunctionAtAbscissa(x, n, p));
+  return BinomialDistribution::CumulativeDistributiveFunctionAtAbscissa(x, n, p);
 }
 
 }
@@ -24,17 +24,13 @@ int BinomPDFNode::serialize(char * buffer, int bufferSize, Preferences::PrintFlo
 }
 
 template<typename T>
-Evaluation<T> BinomPDFNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  Evaluation<T> xEvaluation = childAtIndex(0)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> nEvaluation = childAtIndex(1)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> pEvaluation = childAtIndex(2)->approximate(T(), context, complexFormat, angleUnit);
-
-  T x = xEvaluation.toScalar();
-  T n = nEvaluation.toScalar();
-  T p = pEvaluation.toScalar();
+std::complex<T> BinomPDFNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  T x = ApproximationHelper::RealScalar<T>(childAtIndex(0), context, complexFormat, angleUnit);
+  T n = ApproximationHelper::RealScalar<T>(childAtIndex(1), context, complexFormat, angleUnit);
+  T p = ApproximationHelper::RealScalar<T>(childAtIndex(2), context, complexFormat, angleUnit);
 
   // EvaluateAtAbscissa handles bad n and p values
-  return Complex<T>::Builder(BinomialDistribution::EvaluateAtAbscissa(x, n, p));
+  return BinomialDistribution::EvaluateAtAbscissa(x, n, p);
 }
 
 }
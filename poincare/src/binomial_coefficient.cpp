@@ -30,12 +30,10 @@ int BinomialCoefficientNode::serialize(char * buffer, int bufferSize, Preference
 }
 
 template<typename T>
-Complex<T> BinomialCoefficientNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  Evaluation<T> nInput = childAtIndex(0)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> kInput = childAtIndex(1)->approximate(T(), context, complexFormat, angleUnit);
-  T n = nInput.toScalar();
-  T k = kInput.toScalar();
-  return Complex<T>::Builder(compute(k, n));
+std::complex<T> BinomialCoefficientNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  T n = ApproximationHelper::RealScalar<T>(childAtIndex(0), context, complexFormat, angleUnit);
+  T k = ApproximationHelper::RealScalar<T>(childAtIndex(1), context, complexFormat, angleUnit);
+  return compute(k, n);
 }
 
 template<typename T>
@@ -97,16 +95,7 @@ Expression BinomialCoefficient::shallowReduce(Context * context) {
   if (Integer(k_maxNValue).isLowerThan(n)) {
     return *this;
   }
-  Rational result = Rational::Builder(1);
-  Integer kBis = Integer::Subtraction(n, k);
-  k = kBis.isLowerThan(k) ? kBis : k;
-  int clippedK = k.extractedInt(); // Authorized because k < n < k_maxNValue
-  for (int i = 0; i < clippedK; i++) {
-    Integer nMinusI = Integer::Subtraction(n, Integer(i));
-    Integer kMinusI = Integer::Subtraction(k, Integer(i));
-    Rational factor = Rational::Builder(nMinusI, kMinusI);
-    result = Rational::Multiplication(result, factor);
-  }
+  Rational result = Rational::Builder(Integer::BinomialCoefficient(n, k));
   // As we cap the n < k_maxNValue = 300, result < binomial(300, 150) ~2^89
   assert(!result.numeratorOrDenominatorIsInfinity());
   replaceWithInPlace(result);
@@ -29,8 +29,8 @@ Expression ComplexArgumentNode::shallowReduce(ReductionContext reductionContext)
 }
 
 template<typename T>
-Complex<T> ComplexArgumentNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
-  return Complex<T>::Builder(std::arg(c));
+std::complex<T> ComplexArgumentNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+  return std::arg(c);
 }
 
 
@@ -28,13 +28,9 @@ Expression ComplexCartesianNode::shallowBeautify(ReductionContext reductionConte
 }
 
 template<typename T>
-Complex<T> ComplexCartesianNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  Evaluation<T> realEvaluation = childAtIndex(0)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> imagEvalution = childAtIndex(1)->approximate(T(), context, complexFormat, angleUnit);
-  assert(realEvaluation.type() == EvaluationNode<T>::Type::Complex);
-  assert(imagEvalution.type() == EvaluationNode<T>::Type::Complex);
-  std::complex<T> a = static_cast<Complex<T> &>(realEvaluation).stdComplex();
-  std::complex<T> b = static_cast<Complex<T> &>(imagEvalution).stdComplex();
+std::complex<T> ComplexCartesianNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  std::complex<T> a = childAtIndex(0)->approximateScalar(T(), context, complexFormat, angleUnit);
+  std::complex<T> b = childAtIndex(1)->approximateScalar(T(), context, complexFormat, angleUnit);
   if ((a.imag() != 0.0 && !std::isnan(a.imag())) || (b.imag() != 0.0 && !std::isnan(b.imag()))) {
     /* a and b are supposed to be real (if they are not undefined). However,
      * due to double precision limit, the approximation of the real part or the
@@ -45,11 +41,11 @@ Complex<T> ComplexCartesianNode::templatedApproximate(Context * context, Prefere
      * sqrt(2*sqrt(5E23+1)-1E12*sqrt(2)) being a complex number.
      * In this case, we return an undefined complex because the approximation
      * is very likely to be false. */
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
   assert(a.imag() == 0.0 || std::isnan(a.imag()));
   assert(b.imag() == 0.0 || std::isnan(b.imag()));
-  return Complex<T>::Builder(a.real(), b.real());
+  return std::complex<T>(a.real(), b.real());
 }
 
 Expression ComplexCartesian::shallowReduce() {
@@ -1,4 +1,5 @@
 #include <poincare/constant.h>
+#include <poincare/approximation_helper.h>
 #include <poincare/code_point_layout.h>
 #include <poincare/horizontal_layout.h>
 #include <poincare/layout_helper.h>
@@ -83,6 +84,18 @@ Evaluation<T> ConstantNode::templatedApproximate(Context * context, Preferences:
   return Complex<T>::Builder(M_E);
 }
 
+template<typename T>
+std::complex<T> ConstantNode::templatedApproximateScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  if (isIComplex()) {
+    return ApproximationHelper::ScalarResult(std::complex<T>(0.0, 1.0));
+  }
+  if (isPi()) {
+    return M_PI;
+  }
+  assert(isExponential());
+  return M_E;
+}
+
 Expression ConstantNode::shallowReduce(ReductionContext reductionContext) {
   return Constant(this).shallowReduce(reductionContext);
 }
@@ -118,4 +131,6 @@ Expression Constant::shallowReduce(ExpressionNode::ReductionContext reductionCon
 
 template Evaluation<float> ConstantNode::templatedApproximate<float>(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
 template Evaluation<double> ConstantNode::templatedApproximate<double>(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+template std::complex<float> ConstantNode::templatedApproximateScalar<float>(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+template std::complex<double> ConstantNode::templatedApproximateScalar<double>(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
 }
@@ -40,13 +40,12 @@ Expression DerivativeNode::shallowReduce(ReductionContext reductionContext) {
 }
 
 template<typename T>
-Evaluation<T> DerivativeNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  Evaluation<T> evaluationArgumentInput = childAtIndex(2)->approximate(T(), context, complexFormat, angleUnit);
-  T evaluationArgument = evaluationArgumentInput.toScalar();
+std::complex<T> DerivativeNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  T evaluationArgument = ApproximationHelper::RealScalar<T>(childAtIndex(2), context, complexFormat, angleUnit);
   T functionValue = approximateWithArgument(evaluationArgument, context, complexFormat, angleUnit);
   // No complex/matrix version of Derivative
   if (std::isnan(evaluationArgument) || std::isnan(functionValue)) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
 
   T error = sizeof(T) == sizeof(double) ? DBL_MAX : FLT_MAX;
@@ -71,15 +70,15 @@ Evaluation<T> DerivativeNode::templatedApproximate(Context * context, Preference
       || (std::fabs(result) < k_maxErrorRateOnApproximation && std::fabs(error) > std::fabs(result))
       || (std::fabs(result) >= k_maxErrorRateOnApproximation && std::fabs(error/result) > k_maxErrorRateOnApproximation))
   {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
   static T min = sizeof(T) == sizeof(double) ? DBL_MIN : FLT_MIN;
   if (std::fabs(error) < min) {
-    return Complex<T>::Builder(result);
+    return result;
   }
   // Round the result according to the error
   error = std::pow((T)10, IEEE754<T>::exponentBase10(error)+2);
-  return Complex<T>::Builder(std::round(result/error)*error);
+  return std::round(result/error)*error;
 }
 
 template<typename T>
@@ -88,7 +87,8 @@ T DerivativeNode::approximateWithArgument(T x, Context * context, Preferences::C
   VariableContext variableContext = VariableContext(static_cast<SymbolNode *>(childAtIndex(1))->name(), context);
   variableContext.setApproximationForVariable<T>(x);
   // Here we cannot use Expression::approximateWithValueForSymbol which would reset the sApproximationEncounteredComplex flag
-  return childAtIndex(0)->approximate(T(), &variableContext, complexFormat, angleUnit).toScalar();
+  std::complex<T> value = childAtIndex(0)->approximateScalar(T(), &variableContext, complexFormat, angleUnit);
+  return value.imag() == static_cast<T>(0.0) ? value.real() : NAN;
 }
 
 template<typename T>
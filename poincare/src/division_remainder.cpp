@@ -25,15 +25,13 @@ Expression DivisionRemainderNode::shallowReduce(ReductionContext reductionContex
 }
 
 template<typename T>
-Evaluation<T> DivisionRemainderNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  Evaluation<T> f1Input = childAtIndex(0)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> f2Input = childAtIndex(1)->approximate(T(), context, complexFormat, angleUnit);
-  T f1 = f1Input.toScalar();
-  T f2 = f2Input.toScalar();
+std::complex<T> DivisionRemainderNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  T f1 = ApproximationHelper::RealScalar<T>(childAtIndex(0), context, complexFormat, angleUnit);
+  T f2 = ApproximationHelper::RealScalar<T>(childAtIndex(1), context, complexFormat, angleUnit);
   if (std::isnan(f1) || std::isnan(f2) || f1 != (int)f1 || f2 != (int)f2) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
-  return Complex<T>::Builder(std::round(f1-f2*std::floor(f1/f2)));
+  return std::round(f1-f2*std::floor(f1/f2));
 }
 
 
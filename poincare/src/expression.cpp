@@ -1,4 +1,5 @@
 #include <poincare/expression.h>
+#include <poincare/approximation_program.h>
 #include <poincare/expression_node.h>
 #include <poincare/ghost.h>
 #include <poincare/opposite.h>
@@ -7,6 +8,7 @@
 #include <poincare/undefined.h>
 #include <poincare/variable_context.h>
 #include <ion.h>
+#include <ion/profiling.h>
 #include <ion/unicode/utf8_helper.h>
 #include <cmath>
 #include <float.h>
@@ -18,6 +20,7 @@ namespace Poincare {
 
 bool Expression::sSymbolReplacementsCountLock = false;
 static bool sApproximationEncounteredComplex = false;
+static bool sApproximationEncounteredMatrix = false;
 
 /* Constructor & Destructor */
 
@@ -430,6 +433,14 @@ void Expression::SetEncounteredComplex(bool encounterComplex) {
   sApproximationEncounteredComplex = encounterComplex;
 }
 
+bool Expression::EncounteredMatrix() {
+  return sApproximationEncounteredMatrix;
+}
+
+void Expression::SetEncounteredMatrix(bool encounterMatrix) {
+  sApproximationEncounteredMatrix = encounterMatrix;
+}
+
 Preferences::ComplexFormat Expression::UpdatedComplexFormatWithTextInput(Preferences::ComplexFormat complexFormat, const char * textInput) {
   if (complexFormat == Preferences::ComplexFormat::Real && UTF8Helper::HasCodePoint(textInput, UCodePointMathematicalBoldSmallI)) {
     return Preferences::ComplexFormat::Cartesian;
@@ -486,6 +497,10 @@ bool Expression::isReal(Context * context) const {
 /* Comparison */
 
 bool Expression::isIdenticalTo(const Expression e) const {
+  // Identical expressions have the same structural hash
+  if (node()->structuralHash() != e.node()->structuralHash()) {
+    return false;
+  }
   /* We use the simplification order only because it is a already-coded total
    * order on expresssions. */
   return ExpressionNode::SimplificationOrder(node(), e.node(), true, true) == 0;
@@ -549,6 +564,7 @@ void Expression::ParseAndSimplifyAndApproximate(const char * text, Expression *
 
 Expression Expression::simplify(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, ExpressionNode::ReductionTarget target, bool symbolicComputation) {
   sSimplificationHasBeenInterrupted = false;
+  Ion::Profiling::increment(Ion::Profiling::Counter::Reductions);
   ExpressionNode::ReductionContext c = ExpressionNode::ReductionContext(context, complexFormat, angleUnit, target, symbolicComputation);
   Expression e = deepReduce(c);
   if (!sSimplificationHasBeenInterrupted) {
@@ -613,6 +629,7 @@ void Expression::beautifyAndApproximateScalar(Expression * simplifiedExpression,
 void Expression::simplifyAndApproximate(Expression * simplifiedExpression, Expression * approximateExpression, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, bool symbolicComputation) {
   assert(simplifiedExpression);
   sSimplificationHasBeenInterrupted = false;
+  Ion::Profiling::increment(Ion::Profiling::Counter::Reductions);
   // Step 1: we reduce the expression
   ExpressionNode::ReductionContext userReductionContext = ExpressionNode::ReductionContext(context, complexFormat, angleUnit, ExpressionNode::ReductionTarget::User, symbolicComputation);
   Expression e = clone().deepReduce(userReductionContext);
@@ -732,6 +749,7 @@ Expression Expression::angleUnitToRadian(Preferences::AngleUnit angleUnit) {
 
 Expression Expression::reduce(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, ExpressionNode::ReductionTarget target) {
   sSimplificationHasBeenInterrupted = false;
+  Ion::Profiling::increment(Ion::Profiling::Counter::Reductions);
   return deepReduce(ExpressionNode::ReductionContext(context, complexFormat, angleUnit, target, true));
 }
 
@@ -772,7 +790,18 @@ Expression Expression::approximate(Context * context, Preferences::ComplexFormat
 
 template<typename U>
 U Expression::approximateToScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  return approximateToEvaluation<U>(context, complexFormat, angleUnit).toScalar();
+  /* Scalars are approximated on std::complex, matrices only go through
+   * Evaluations. The result matches approximateToEvaluation(...).toScalar(). */
+  sApproximationEncounteredComplex = false;
+  sApproximationEncounteredMatrix = false;
+  // Reset interrupting flag because some evaluation methods use it
+  sSimplificationHasBeenInterrupted = false;
+  std::complex<U> c = node()->approximateScalar(U(), context, complexFormat, angleUnit);
+  if (sApproximationEncounteredMatrix || (complexFormat == Preferences::ComplexFormat::Real && sApproximationEncounteredComplex) || c.imag() != static_cast<U>(0.0)) {
+    return NAN;
+  }
+  // Normalize -0
+  return c.real() == static_cast<U>(0.0) ? static_cast<U>(0.0) : c.real();
 }
 
 template<typename U>
@@ -789,6 +818,25 @@ U Expression::approximateWithValueForSymbol(const char * symbol, U x, Context *
   return approximateToScalar<U>(&variableContext, complexFormat, angleUnit);
 }
 
+template<typename U>
+void Expression::approximateWithValuesForSymbol(const char * symbol, const U * xs, U * ys, int numberOfValues, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const ApproximationProgram * program) const {
+  ApproximationProgram compiledProgram;
+  if (program == nullptr) {
+    compiledProgram.compile(*this, symbol, context, complexFormat, angleUnit);
+    program = &compiledProgram;
+  }
+  bool approximated[ApproximationProgram::k_batchLength];
+  for (int first = 0; first < numberOfValues; first += ApproximationProgram::k_batchLength) {
+    int length = numberOfValues - first < ApproximationProgram::k_batchLength ? numberOfValues - first : ApproximationProgram::k_batchLength;
+    program->approximateWithValuesForSymbol<U>(xs + first, ys + first, approximated, length);
+    for (int i = 0; i < length; i++) {
+      if (!approximated[i]) {
+        ys[first + i] = approximateWithValueForSymbol<U>(symbol, xs[first + i], context, complexFormat, angleUnit);
+      }
+    }
+  }
+}
+
 template<typename U>
 U Expression::Epsilon() {
   static U epsilon = sizeof(U) == sizeof(double) ? 1E-15 : 1E-7f;
@@ -1107,5 +1155,7 @@ template Evaluation<double> Expression::approximateToEvaluation(Context * contex
 
 template float Expression::approximateWithValueForSymbol(const char * symbol, float x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
 template double Expression::approximateWithValueForSymbol(const char * symbol, double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+template void Expression::approximateWithValuesForSymbol(const char * symbol, const float * xs, float * ys, int numberOfValues, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const ApproximationProgram * program) const;
+template void Expression::approximateWithValuesForSymbol(const char * symbol, const double * xs, double * ys, int numberOfValues, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const ApproximationProgram * program) const;
 
 }
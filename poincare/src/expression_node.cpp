@@ -2,6 +2,7 @@
 #include <poincare/expression.h>
 #include <poincare/addition.h>
 #include <poincare/arc_tangent.h>
+#include <poincare/complex.h>
 #include <poincare/complex_cartesian.h>
 #include <poincare/division.h>
 #include <poincare/power.h>
@@ -104,6 +105,29 @@ int ExpressionNode::simplificationOrderSameType(const ExpressionNode * e, bool a
   return 0;
 }
 
+uint8_t ExpressionNode::structuralHash() const {
+  uint8_t hash = cachedHash();
+  if (hash == 0) {
+    hash = FoldHash(computeStructuralHash());
+    setCachedHash(hash);
+  }
+  return hash;
+}
+
+uint8_t ExpressionNode::FoldHash(uint32_t hash) {
+  uint8_t result = hash ^ (hash >> 8) ^ (hash >> 16) ^ (hash >> 24);
+  // 0 is reserved for nodes without cached hash
+  return result == 0 ? 1 : result;
+}
+
+uint32_t ExpressionNode::computeStructuralHash() const {
+  uint32_t hash = static_cast<uint32_t>(type());
+  for (ExpressionNode * c : children()) {
+    hash = CombineHashes(hash, c->structuralHash());
+  }
+  return hash;
+}
+
 void ExpressionNode::deepReduceChildren(ExpressionNode::ReductionContext reductionContext) {
   Expression(this).defaultDeepReduceChildren(reductionContext);
 }
@@ -129,6 +153,23 @@ void ExpressionNode::setChildrenInPlace(Expression other) {
   Expression(this).defaultSetChildrenInPlace(other);
 }
 
+template<typename T>
+static std::complex<T> ScalarFromEvaluation(Evaluation<T> e) {
+  if (e.type() != EvaluationNode<T>::Type::Complex) {
+    Expression::SetEncounteredMatrix(true);
+    return std::complex<T>(NAN, NAN);
+  }
+  return static_cast<Complex<T> &>(e).stdComplex();
+}
+
+std::complex<float> ExpressionNode::approximateScalar(SinglePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return ScalarFromEvaluation<float>(approximate(p, context, complexFormat, angleUnit));
+}
+
+std::complex<double> ExpressionNode::approximateScalar(DoublePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return ScalarFromEvaluation<double>(approximate(p, context, complexFormat, angleUnit));
+}
+
 Expression ExpressionNode::denominator(ReductionContext reductionContext) const {
   return Expression();
 }
@@ -24,11 +24,11 @@ Expression FracPartNode::shallowReduce(ReductionContext reductionContext) {
 }
 
 template<typename T>
-Complex<T> FracPartNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> FracPartNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   if (c.imag() != 0) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
-  return Complex<T>::Builder(c.real()-std::floor(c.real()));
+  return c.real()-std::floor(c.real());
 }
 
 
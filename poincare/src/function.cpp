@@ -88,6 +88,24 @@ Evaluation<T> FunctionNode::templatedApproximate(Context * context, Preferences:
   return e.node()->approximate(T(), context, complexFormat, angleUnit);
 }
 
+std::complex<float> FunctionNode::approximateScalar(SinglePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return templatedApproximateScalar<float>(context, complexFormat, angleUnit);
+}
+
+std::complex<double> FunctionNode::approximateScalar(DoublePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return templatedApproximateScalar<double>(context, complexFormat, angleUnit);
+}
+
+template<typename T>
+std::complex<T> FunctionNode::templatedApproximateScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  Function f(this);
+  Expression e = SymbolAbstract::Expand(f, context, true);
+  if (e.isUninitialized()) {
+    return std::complex<T>(NAN, NAN);
+  }
+  return e.node()->approximateScalar(T(), context, complexFormat, angleUnit);
+}
+
 Function Function::Builder(const char * name, size_t length, Expression child) {
   Function f = SymbolAbstract::Builder<Function, FunctionNode>(name, length);
   if (!child.isUninitialized()) {
@@ -27,12 +27,12 @@ Expression GreatCommonDivisorNode::shallowReduce(ReductionContext reductionConte
 }
 
 template<typename T>
-Evaluation<T> GreatCommonDivisorNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+std::complex<T> GreatCommonDivisorNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
   bool isUndefined = false;
   int a = ApproximationHelper::PositiveIntegerApproximationIfPossible<T>(childAtIndex(0), &isUndefined, context, complexFormat, angleUnit);
   int b = ApproximationHelper::PositiveIntegerApproximationIfPossible<T>(childAtIndex(1), &isUndefined, context, complexFormat, angleUnit);
   if (isUndefined) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
   if (b > a) {
     int temp = b;
@@ -45,7 +45,7 @@ Evaluation<T> GreatCommonDivisorNode::templatedApproximate(Context * context, Pr
     a = b;
     b = r;
   }
-  return Complex<T>::Builder(std::round((T)a));
+  return std::round((T)a);
 }
 
 
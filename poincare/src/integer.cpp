@@ -31,6 +31,91 @@ static inline int maxInt(int x, int y) { return x > y ? x : y; }
 static native_uint_t s_workingBuffer[Integer::k_maxNumberOfDigits + 1];
 static native_uint_t s_workingBufferDivision[Integer::k_maxNumberOfDigits + 1];
 
+/* Power, factorial and binomial coefficients chain many products. They are
+ * computed on the digits of these scratch buffers, the Integer being built
+ * once at the end instead of allocating a node in the pool at each step. */
+static native_uint_t s_scratchBuffers[3][Integer::k_maxNumberOfDigits + 1];
+
+/* Multiply the digits of a and b into result, which must not overlap them.
+ * Return the number of digits of the product, which is greater than
+ * k_maxNumberOfDigits if it overflows. */
+static int MultiplyDigits(const native_uint_t * a, int aLength, const native_uint_t * b, int bLength, native_uint_t * result) {
+  constexpr int k_overflowLength = Integer::k_maxNumberOfDigits + 1;
+  if (aLength == 0 || bLength == 0) {
+    return 0;
+  }
+  // The product has at least aLength+bLength-1 digits
+  if (aLength + bLength - 1 > Integer::k_maxNumberOfDigits) {
+    return k_overflowLength;
+  }
+  int length = minInt(aLength + bLength, k_overflowLength);
+  memset(result, 0, length*sizeof(native_uint_t));
+  for (int i = 0; i < aLength; i++) {
+    double_native_uint_t aDigit = a[i];
+    double_native_uint_t carry = 0;
+    for (int j = 0; j < bLength; j++) {
+      // This cannot overflow: (B-1)*(B-1) + 2*(B-1) = B^2-1
+      double_native_uint_t p = aDigit*b[j] + result[i+j] + carry;
+      result[i+j] = static_cast<native_uint_t>(p);
+      carry = p >> (8*sizeof(native_uint_t));
+    }
+    if (i + bLength < k_overflowLength) {
+      result[i+bLength] = static_cast<native_uint_t>(carry);
+    } else if (carry != 0) {
+      return k_overflowLength;
+    }
+  }
+  while (length > 0 && result[length-1] == 0) {
+    length--;
+  }
+  return length;
+}
+
+/* Multiply in place the digits by a native integer. Return the new number of
+ * digits, which is greater than k_maxNumberOfDigits if it overflows. The
+ * digits must have room for k_maxNumberOfDigits+1 digits. */
+static int MultiplyDigitsByNativeInteger(native_uint_t * digits, int length, native_uint_t factor) {
+  double_native_uint_t carry = 0;
+  for (int i = 0; i < length; i++) {
+    double_native_uint_t p = static_cast<double_native_uint_t>(digits[i])*factor + carry;
+    digits[i] = static_cast<native_uint_t>(p);
+    carry = p >> (8*sizeof(native_uint_t));
+  }
+  if (carry != 0) {
+    assert(length <= Integer::k_maxNumberOfDigits);
+    digits[length++] = static_cast<native_uint_t>(carry);
+  }
+  while (length > 0 && digits[length-1] == 0) {
+    length--;
+  }
+  return length;
+}
+
+/* Divide in place the digits by a native integer. Return the new number of
+ * digits, the remainder being dropped. */
+static int DivideDigitsByNativeInteger(native_uint_t * digits, int length, native_uint_t divisor) {
+  assert(divisor != 0);
+  double_native_uint_t remainder = 0;
+  for (int i = length - 1; i >= 0; i--) {
+    double_native_uint_t n = (remainder << (8*sizeof(native_uint_t))) | digits[i];
+    digits[i] = static_cast<native_uint_t>(n / divisor);
+    remainder = n % divisor;
+  }
+  while (length > 0 && digits[length-1] == 0) {
+    length--;
+  }
+  return length;
+}
+
+static native_uint_t NativeGCD(native_uint_t a, native_uint_t b) {
+  while (b != 0) {
+    native_uint_t r = a % b;
+    a = b;
+    b = r;
+  }
+  return a;
+}
+
 uint8_t log2(native_uint_t v) {
   constexpr int nativeUnsignedIntegerBitCount = 8*sizeof(native_uint_t);
   static_assert(nativeUnsignedIntegerBitCount < 256, "uint8_t cannot contain the log2 of a native_uint_t");
@@ -330,32 +415,113 @@ IntegerDivision Integer::Division(const Integer & numerator, const Integer & den
 }
 
 Integer Integer::Power(const Integer & i, const Integer & j) {
-  // TODO: optimize with dichotomia
   assert(!j.isNegative());
   if (j.isOverflow()) {
     return Overflow(false);
   }
-  Integer index(j);
-  Integer result(1);
-  while (!index.isZero()) {
-    result = Multiplication(result, i);
-    index = usum(index, Integer(1), true);
+  if (j.isZero()) {
+    return Integer(1);
   }
-  return result;
+  bool negative = i.isNegative() && !j.isEven();
+  if (i.isOverflow()) {
+    return Overflow(negative);
+  }
+  if (i.isZero() || (i.numberOfDigits() == 1 && i.digit(0) == 1)) {
+    Integer result(i);
+    result.setNegative(negative);
+    return result;
+  }
+  /* |i| >= 2, so i^j overflows as soon as j >= 32*k_maxNumberOfDigits. This
+   * also ensures j holds in a single digit. */
+  constexpr native_uint_t maxExponent = 8*sizeof(native_uint_t)*k_maxNumberOfDigits;
+  if (j.numberOfDigits() > 1 || j.digit(0) >= maxExponent) {
+    return Overflow(negative);
+  }
+  native_uint_t exponent = j.digit(0);
+  // Square-and-multiply, reading the bits of the exponent from the highest
+  native_uint_t * result = s_scratchBuffers[0];
+  native_uint_t * product = s_scratchBuffers[1];
+  int resultLength = i.numberOfDigits();
+  for (int k = 0; k < resultLength; k++) {
+    result[k] = i.digit(k);
+  }
+  for (int bit = log2(exponent) - 2; bit >= 0; bit--) {
+    resultLength = MultiplyDigits(result, resultLength, result, resultLength, product);
+    if (resultLength > k_maxNumberOfDigits) {
+      return Overflow(negative);
+    }
+    std::swap(result, product);
+    if (exponent & ((native_uint_t)1 << bit)) {
+      resultLength = MultiplyDigits(result, resultLength, i.digits(), i.numberOfDigits(), product);
+      if (resultLength > k_maxNumberOfDigits) {
+        return Overflow(negative);
+      }
+      std::swap(result, product);
+    }
+  }
+  return BuildInteger(result, resultLength, negative);
 }
 
 Integer Integer::Factorial(const Integer & i) {
   assert(!i.isNegative());
-  if (i.isOverflow()) {
+  /* i! overflows far before i reaches the native integer limit, which also
+   * ensures i holds in a single digit. */
+  if (i.isOverflow() || i.numberOfDigits() > 1) {
     return Overflow(false);
   }
-  Integer j(2);
-  Integer result(1);
-  while (ucmp(i,j) >= 0) {
-    result = Multiplication(j, result);
-    j = usum(j, Integer(1), false);
+  native_uint_t n = i.numberOfDigits() == 0 ? 0 : i.digit(0);
+  native_uint_t * result = s_scratchBuffers[0];
+  result[0] = 1;
+  int resultLength = 1;
+  /* Consecutive factors are gathered in a native integer as long as their
+   * product holds in it, so that the digits are multiplied less often. */
+  native_uint_t factors = 1;
+  for (native_uint_t k = 2; k <= n; k++) {
+    if (static_cast<double_native_uint_t>(factors)*k > static_cast<native_uint_t>(~0)) {
+      resultLength = MultiplyDigitsByNativeInteger(result, resultLength, factors);
+      if (resultLength > k_maxNumberOfDigits) {
+        return Overflow(false);
+      }
+      factors = 1;
+    }
+    factors *= k;
   }
-  return result;
+  resultLength = MultiplyDigitsByNativeInteger(result, resultLength, factors);
+  if (resultLength > k_maxNumberOfDigits) {
+    return Overflow(false);
+  }
+  return BuildInteger(result, resultLength, false);
+}
+
+Integer Integer::BinomialCoefficient(const Integer & n, const Integer & k) {
+  assert(!n.isNegative() && !k.isNegative() && !k.isOverflow());
+  assert(!n.isLowerThan(k));
+  if (n.isOverflow() || n.numberOfDigits() > 1) {
+    return Overflow(false);
+  }
+  native_uint_t nDigit = n.numberOfDigits() == 0 ? 0 : n.digit(0);
+  native_uint_t kDigit = k.numberOfDigits() == 0 ? 0 : k.digit(0);
+  if (nDigit - kDigit < kDigit) {
+    kDigit = nDigit - kDigit;
+  }
+  native_uint_t * result = s_scratchBuffers[2];
+  result[0] = 1;
+  int resultLength = 1;
+  /* After step i, result is binomial(n-k+i+1, i+1) = result*factor/divisor.
+   * Once factor and divisor are divided by their gcd, divisor divides result,
+   * so dividing before multiplying is exact and result never exceeds the
+   * final binomial coefficient. */
+  for (native_uint_t i = 0; i < kDigit; i++) {
+    native_uint_t factor = nDigit - kDigit + i + 1;
+    native_uint_t divisor = i + 1;
+    native_uint_t gcd = NativeGCD(factor, divisor);
+    resultLength = DivideDigitsByNativeInteger(result, resultLength, divisor/gcd);
+    resultLength = MultiplyDigitsByNativeInteger(result, resultLength, factor/gcd);
+    if (resultLength > k_maxNumberOfDigits) {
+      return Overflow(false);
+    }
+  }
+  return BuildInteger(result, resultLength, false);
 }
 
 Integer Integer::addition(const Integer & a, const Integer & b, bool inverseBNegative, bool oneDigitOverflow) {
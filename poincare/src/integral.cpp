@@ -1,4 +1,5 @@
 #include <poincare/integral.h>
+#include <poincare/approximation_program.h>
 #include <poincare/complex.h>
 #include <poincare/integral_layout.h>
 #include <poincare/serialization_helper.h>
@@ -43,67 +44,101 @@ Expression IntegralNode::shallowReduce(ReductionContext reductionContext) {
   return Integral(this).shallowReduce(reductionContext.context());
 }
 
+/* The integrand is approximated through an ApproximationProgram when it can
+ * be compiled, the abscissae of a quadrature being computed in a batch. The
+ * tree is walked for the abscissae at which the program gives up, with a
+ * variable context built once for the whole integral. */
 template<typename T>
-Evaluation<T> IntegralNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  Evaluation<T> aInput = childAtIndex(2)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> bInput = childAtIndex(3)->approximate(T(), context, complexFormat, angleUnit);
-  T a = aInput.toScalar();
-  T b = bInput.toScalar();
-  if (std::isnan(a) || std::isnan(b)) {
-    return Complex<T>::Undefined();
+class IntegralNode::Integrand {
+public:
+  Integrand(const IntegralNode * integral, const Expression integrand, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) :
+    m_integral(integral),
+    m_variableContext(static_cast<SymbolNode *>(integral->childAtIndex(1))->name(), context),
+    m_complexFormat(complexFormat),
+    m_angleUnit(angleUnit)
+  {
+    assert(integral->childAtIndex(1)->type() == Type::Symbol);
+    m_program.compile(integrand, static_cast<SymbolNode *>(integral->childAtIndex(1))->name(), context, complexFormat, angleUnit);
   }
-#ifdef LAGRANGE_METHOD
-  T result = lagrangeGaussQuadrature<T>(a, b, context, complexFormat, angleUnit);
-#else
-  T result = adaptiveQuadrature<T>(a, b, 0.1, k_maxNumberOfIterations, context, complexFormat, angleUnit);
-#endif
-  return Complex<T>::Builder(result);
-}
+  // Returns false if the integrand is undefined at one of the abscissae
+  bool valuesAtAbscissae(const T * x, T * y, int numberOfAbscissae) {
+    assert(numberOfAbscissae <= k_maxNumberOfAbscissae);
+    bool approximated[k_maxNumberOfAbscissae];
+    m_program.approximateWithValuesForSymbol<T>(x, y, approximated, numberOfAbscissae);
+    for (int i = 0; i < numberOfAbscissae; i++) {
+      if (!approximated[i]) {
+        y[i] = valueAtAbscissa(x[i]);
+      }
+      if (std::isnan(y[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+  constexpr static int k_maxNumberOfAbscissae = 21;
+private:
+  T valueAtAbscissa(T x) {
+    // Here we cannot use Expression::approximateWithValueForSymbol which would reset the sApproximationEncounteredComplex flag
+    m_variableContext.setApproximationForVariable<T>(x);
+    std::complex<T> value = m_integral->childAtIndex(0)->approximateScalar(T(), &m_variableContext, m_complexFormat, m_angleUnit);
+    return value.imag() == static_cast<T>(0.0) ? value.real() : NAN;
+  }
+  const IntegralNode * m_integral;
+  VariableContext m_variableContext;
+  ApproximationProgram m_program;
+  Preferences::ComplexFormat m_complexFormat;
+  Preferences::AngleUnit m_angleUnit;
+};
 
 template<typename T>
-T IntegralNode::functionValueAtAbscissa(T x, Context * xcontext, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  // Here we cannot use Expression::approximateWithValueForSymbol which would reset the sApproximationEncounteredComplex flag
-  assert(childAtIndex(1)->type() == Type::Symbol);
-  VariableContext variableContext = VariableContext(static_cast<SymbolNode *>(childAtIndex(1))->name(), xcontext);
-  variableContext.setApproximationForVariable<T>(x);
-  return childAtIndex(0)->approximate(T(), &variableContext, complexFormat, angleUnit).toScalar();
+std::complex<T> IntegralNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  T absoluteError;
+  T result = approximateWithError<T>(context, complexFormat, angleUnit, &absoluteError);
+  return std::isnan(result) ? std::complex<T>(NAN, NAN) : std::complex<T>(result);
 }
 
-#ifdef LAGRANGE_METHOD
-
 template<typename T>
-T IntegralNode::lagrangeGaussQuadrature(T a, T b, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  /* We here use Gauss-Legendre quadrature with n = 5
-   * Gauss-Legendre abscissae and weights can be found in
-   * C/C++ library source code. */
-  const static T x[10]={0.0765265211334973337546404, 0.2277858511416450780804962, 0.3737060887154195606725482, 0.5108670019508270980043641,
-   0.6360536807265150254528367, 0.7463319064601507926143051, 0.8391169718222188233945291, 0.9122344282513259058677524,
-   0.9639719272779137912676661, 0.9931285991850949247861224};
-  const static T w[10]={0.1527533871307258506980843, 0.1491729864726037467878287, 0.1420961093183820513292983, 0.1316886384491766268984945, 0.1181945319615184173123774,
-    0.1019301198172404350367501, 0.0832767415767047487247581, 0.0626720483341090635695065, 0.0406014298003869413310400, 0.0176140071391521183118620};
-  T xm = 0.5*(a+b);
-  T xr = 0.5*(b-a);
-  T result = 0;
-  for (int j = 0; j < 10; j++) {
-    T dx = xr * x[j];
-    T evaluationAfterX = functionValueAtAbscissa(xm+dx, context, complexFormat, angleUnit);
-    if (std::isnan(evaluationAfterX)) {
-      return NAN;
-    }
-    T evaluationBeforeX = functionValueAtAbscissa(xm-dx, context, complexFormat, angleUnit);
-    if (std::isnan(evaluationBeforeX)) {
-      return NAN;
+T IntegralNode::approximateWithError(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, T * absoluteError) const {
+  *absoluteError = NAN;
+  T a = ApproximationHelper::RealScalar<T>(childAtIndex(2), context, complexFormat, angleUnit);
+  T b = ApproximationHelper::RealScalar<T>(childAtIndex(3), context, complexFormat, angleUnit);
+  if (std::isnan(a) || std::isnan(b)) {
+    return NAN;
+  }
+  Integrand<T> integrand(this, Expression(childAtIndex(0)), context, complexFormat, angleUnit);
+  DetailedResult<T> result = isNestedInIntegrand() ?
+    adaptiveQuadratureWithHeap<T, k_maxNumberOfNestedSubintervals>(a, b, &integrand) :
+    adaptiveQuadratureWithHeap<T, k_maxNumberOfSubintervals>(a, b, &integrand);
+  if (std::isnan(result.integral) || !(result.absoluteError <= Tolerance(result) || result.absoluteError <= static_cast<T>(k_maxAbsoluteError))) {
+    return NAN;
+  }
+  *absoluteError = result.absoluteError;
+  return result.integral;
+}
+
+bool IntegralNode::isNestedInIntegrand() const {
+  /* Integrals are only nested through the tree: one in the integrand of a
+   * function called by an integrand is not detected. */
+  const TreeNode * child = this;
+  for (const TreeNode * node = parent(); node != nullptr; node = node->parent()) {
+    if (static_cast<const ExpressionNode *>(node)->type() == Type::Integral && node->childAtIndex(0) == child) {
+      return true;
     }
-    result += w[j]*(evaluationAfterX + evaluationBeforeX);
+    child = node;
   }
-  result *= xr;
-  return result;
+  return false;
 }
 
-#else
+template<typename T>
+T IntegralNode::Tolerance(DetailedResult<T> result) {
+  /* The tolerance is relative to the integral of the absolute value, which
+   * bounds the rounding errors even when the integral itself cancels out. */
+  T relativeTolerance = sizeof(T) == sizeof(double) ? 1E-10 : 1E-5;
+  return relativeTolerance * result.absoluteIntegral;
+}
 
 template<typename T>
-IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(T a, T b, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(T a, T b, Integrand<T> * integrand) const {
   static T epsilon = sizeof(T) == sizeof(double) ? DBL_EPSILON : FLT_EPSILON;
   static T max = sizeof(T) == sizeof(double) ? DBL_MAX : FLT_MAX;
   /* We here use Kronrod-Legendre quadrature with n = 21
@@ -125,9 +160,6 @@ IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(T a, T b, C
     0.109387158802297641899210590325805, 0.123491976262065851077958109831074, 0.134709217311473325928054001771707,
     0.142775938577060080797094273138717, 0.147739104901338491374841515972068, 0.149445554002916905664936468389821};
 
-  T fv1[10];
-  T fv2[10];
-
   T center = 0.5 * (a+b);
   T halfLength = 0.5 * (b-a);
   T absHalfLength = std::fabs(halfLength);
@@ -135,26 +167,31 @@ IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(T a, T b, C
   DetailedResult<T> errorResult;
   errorResult.integral = NAN;
   errorResult.absoluteError = 0;
+  errorResult.absoluteIntegral = 0;
 
-  T gaussIntegral = 0;
-  T fCenter = functionValueAtAbscissa(center, context, complexFormat, angleUnit);
-  if (std::isnan(fCenter)) {
+  /* The integrand is evaluated at the center, then at center-xDelta and
+   * center+xDelta for each abscissa. */
+  T abscissae[21];
+  T values[21];
+  abscissae[0] = center;
+  for (int j = 0; j < 10; j++) {
+    T xDelta = halfLength * x[j];
+    abscissae[2*j+1] = center - xDelta;
+    abscissae[2*j+2] = center + xDelta;
+  }
+  if (!integrand->valuesAtAbscissae(abscissae, values, 21)) {
     return errorResult;
   }
+  T fCenter = values[0];
+  const T * fv1 = values + 1;
+  const T * fv2 = values + 2;
+
+  T gaussIntegral = 0;
   T kronrodIntegral = wKronrod[10] * fCenter;
   T absKronrodIntegral = std::fabs(kronrodIntegral);
   for (int j = 0; j < 10; j++) {
-    T xDelta = halfLength * x[j];
-    T fval1 = functionValueAtAbscissa(center - xDelta, context, complexFormat, angleUnit);
-    if (std::isnan(fval1)) {
-      return errorResult;
-    }
-    T fval2 = functionValueAtAbscissa(center + xDelta, context, complexFormat, angleUnit);
-    if (std::isnan(fval2)) {
-      return errorResult;
-    }
-    fv1[j] = fval1;
-    fv2[j] = fval2;
+    T fval1 = fv1[2*j];
+    T fval2 = fv2[2*j];
     T fsum = fval1 + fval2;
     if (j % 2 == 1) {
       gaussIntegral += wGauss[j/2] * fsum;
@@ -166,7 +203,7 @@ IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(T a, T b, C
   T halfKronrodIntegral = 0.5 * kronrodIntegral;
   T kronrodIntegralDifference = wKronrod[10] * std::fabs(fCenter - halfKronrodIntegral);
   for (int j = 0; j < 10; j++) {
-    kronrodIntegralDifference += wKronrod[j] * (std::fabs(fv1[j] - halfKronrodIntegral) + std::fabs(fv2[j] - halfKronrodIntegral));
+    kronrodIntegralDifference += wKronrod[j] * (std::fabs(fv1[2*j] - halfKronrodIntegral) + std::fabs(fv2[2*j] - halfKronrodIntegral));
   }
   T integral = kronrodIntegral * halfLength;
   absKronrodIntegral = absKronrodIntegral * absHalfLength;
@@ -183,26 +220,228 @@ IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(T a, T b, C
   DetailedResult<T> result;
   result.integral = integral;
   result.absoluteError = absError;
+  result.absoluteIntegral = absKronrodIntegral;
   return result;
 }
 
 template<typename T>
-T IntegralNode::adaptiveQuadrature(T a, T b, T eps, int numberOfIterations, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  if (Expression::ShouldStopProcessing()) {
-    return NAN;
+IntegralNode::DetailedResult<T> IntegralNode::tanhSinhQuadrature(T a, T b, T tolerance, Integrand<T> * integrand) const {
+  /* The substitution x = center + halfLength*tanh(π/2*sinh(t)) turns the
+   * integral into an integral over t in ]-∞,+∞[ whose integrand decreases
+   * double exponentially, even when the original integrand has singularities
+   * at the bounds. It is computed with the trapezoidal rule, the step being
+   * halved at each level, and the difference between two levels estimates the
+   * error. An abscissa is computed from its distance to the closest bound,
+   * 1-tanh(u) = exp(-u)/cosh(u), so that it does not round to the bound. */
+  constexpr int k_maxNumberOfAbscissae = Integrand<T>::k_maxNumberOfAbscissae;
+  const T maxT = sizeof(T) == sizeof(double) ? 4.5 : 3.5;
+  const T halfPi = M_PI / 2;
+  T center = 0.5 * (a+b);
+  T halfLength = 0.5 * (b-a);
+
+  DetailedResult<T> errorResult;
+  errorResult.integral = NAN;
+  errorResult.absoluteError = 0;
+  errorResult.absoluteIntegral = 0;
+
+  T fCenter;
+  if (!integrand->valuesAtAbscissae(&center, &fCenter, 1)) {
+    return errorResult;
   }
-  DetailedResult<T> quadKG = kronrodGaussQuadrature(a, b, context, complexFormat, angleUnit);
-  T result = quadKG.integral;
-  if (quadKG.absoluteError <= eps) {
-    return result;
-  } else if (--numberOfIterations > 0) {
-    T m = (a+b)/2;
-    return adaptiveQuadrature<T>(a, m, eps/2, numberOfIterations, context, complexFormat, angleUnit) + adaptiveQuadrature<T>(m, b, eps/2, numberOfIterations, context, complexFormat, angleUnit);
-  } else {
-    return NAN;
+  T sum = halfPi * fCenter;
+  T absSum = halfPi * std::fabs(fCenter);
+  DetailedResult<T> result = errorResult;
+  for (int level = 0; level < k_maxNumberOfTanhSinhLevels; level++) {
+    if (Expression::ShouldStopProcessing()) {
+      return errorResult;
+    }
+    // The first level sums over integers, the next ones over odd multiples of the step
+    T step = std::ldexp(static_cast<T>(1), -level);
+    T t = level == 0 ? 1 : step;
+    T tIncrement = level == 0 ? 1 : 2*step;
+    bool reachedBounds = false;
+    while (t <= maxT && !reachedBounds) {
+      T abscissae[k_maxNumberOfAbscissae];
+      T weights[k_maxNumberOfAbscissae];
+      T values[k_maxNumberOfAbscissae];
+      int numberOfAbscissae = 0;
+      while (numberOfAbscissae + 2 <= k_maxNumberOfAbscissae && t <= maxT) {
+        T u = halfPi * std::sinh(t);
+        T coshU = std::cosh(u);
+        T distance = halfLength * std::exp(-u) / coshU;
+        T weight = halfPi * std::cosh(t) / (coshU * coshU);
+        T left = a + distance;
+        T right = b - distance;
+        // Abscissae rounded to a bound are dropped, their weight being negligible
+        if (left == a && right == b) {
+          reachedBounds = true;
+          break;
+        }
+        if (left != a) {
+          abscissae[numberOfAbscissae] = left;
+          weights[numberOfAbscissae++] = weight;
+        }
+        if (right != b) {
+          abscissae[numberOfAbscissae] = right;
+          weights[numberOfAbscissae++] = weight;
+        }
+        t += tIncrement;
+      }
+      if (!integrand->valuesAtAbscissae(abscissae, values, numberOfAbscissae)) {
+        return errorResult;
+      }
+      for (int i = 0; i < numberOfAbscissae; i++) {
+        sum += weights[i] * values[i];
+        absSum += weights[i] * std::fabs(values[i]);
+      }
+    }
+    T integral = halfLength * step * sum;
+    if (level > 0) {
+      result.absoluteError = std::fabs(integral - result.integral);
+    } else {
+      result.absoluteError = INFINITY;
+    }
+    result.integral = integral;
+    result.absoluteIntegral = std::fabs(halfLength) * step * absSum;
+    if (result.absoluteError <= tolerance || std::isnan(integral)) {
+      break;
+    }
   }
+  return result;
+}
+
+/* The subintervals of the adaptive quadrature are kept in a binary max-heap of
+ * their estimated errors. */
+
+template<typename S>
+static void PushSubinterval(S * heap, int * numberOfSubintervals, S subinterval) {
+  int i = (*numberOfSubintervals)++;
+  while (i > 0 && heap[(i-1)/2].quadrature.absoluteError < subinterval.quadrature.absoluteError) {
+    heap[i] = heap[(i-1)/2];
+    i = (i-1)/2;
+  }
+  heap[i] = subinterval;
+}
+
+template<typename S>
+static S PopSubinterval(S * heap, int * numberOfSubintervals) {
+  assert(*numberOfSubintervals > 0);
+  S worst = heap[0];
+  S last = heap[--(*numberOfSubintervals)];
+  int i = 0;
+  while (2*i+1 < *numberOfSubintervals) {
+    int child = 2*i+1;
+    if (child + 1 < *numberOfSubintervals && heap[child].quadrature.absoluteError < heap[child+1].quadrature.absoluteError) {
+      child++;
+    }
+    if (!(last.quadrature.absoluteError < heap[child].quadrature.absoluteError)) {
+      break;
+    }
+    heap[i] = heap[child];
+    i = child;
+  }
+  heap[i] = last;
+  return worst;
+}
+
+template<typename S>
+static S RetireSmallestSubinterval(S * heap, int * numberOfSubintervals) {
+  // The smallest subinterval of a max-heap is one of its leaves
+  assert(*numberOfSubintervals > 0);
+  int smallest = *numberOfSubintervals / 2;
+  for (int i = smallest + 1; i < *numberOfSubintervals; i++) {
+    if (heap[i].quadrature.absoluteError < heap[smallest].quadrature.absoluteError) {
+      smallest = i;
+    }
+  }
+  S retired = heap[smallest];
+  S last = heap[--(*numberOfSubintervals)];
+  // The last leaf replaces the retired one, which has no children
+  int i = smallest;
+  while (i > 0 && heap[(i-1)/2].quadrature.absoluteError < last.quadrature.absoluteError) {
+    heap[i] = heap[(i-1)/2];
+    i = (i-1)/2;
+  }
+  if (i < *numberOfSubintervals) {
+    heap[i] = last;
+  }
+  return retired;
+}
+
+/* The heap is declared in a function of its own, which is not inlined, so that
+ * the stack of the caller only holds the heap of the size it picked. */
+template<typename T, int MaxNumberOfSubintervals>
+__attribute__((noinline)) IntegralNode::DetailedResult<T> IntegralNode::adaptiveQuadratureWithHeap(T a, T b, Integrand<T> * integrand) const {
+  Subinterval<T> heap[MaxNumberOfSubintervals];
+  return adaptiveQuadrature<T>(a, b, integrand, heap, MaxNumberOfSubintervals);
+}
+
+template<typename T>
+IntegralNode::DetailedResult<T> IntegralNode::adaptiveQuadrature(T a, T b, Integrand<T> * integrand, Subinterval<T> * heap, int maxNumberOfSubintervals) const {
+  /* Global adaptive quadrature: the subinterval with the largest estimated
+   * error is split in two until the sum of the errors is within tolerance.
+   * Each subinterval keeps its quadrature, so that only the halves of the
+   * split one are evaluated. When the heap is full, the subinterval with the
+   * smallest error is retired: its quadrature still counts but it is not
+   * split anymore. If the quadratures run out or if a subinterval touching a
+   * bound gets very small, the integrand is likely singular at a bound and
+   * the tanh-sinh quadrature is tried. */
+  DetailedResult<T> total = kronrodGaussQuadrature(a, b, integrand);
+  if (std::isnan(total.integral) || total.absoluteError <= Tolerance(total)) {
+    return total;
+  }
+  int numberOfSubintervals = 0;
+  DetailedResult<T> retired = {0, 0, 0};
+  PushSubinterval(heap, &numberOfSubintervals, Subinterval<T>{a, b, total});
+  int numberOfQuadratures = 1;
+  T singularBoundLength = std::ldexp(std::fabs(b - a), -k_singularBoundDepth);
+  bool boundLooksSingular = false;
+  while (numberOfQuadratures + 2 <= k_maxNumberOfQuadratures && !(total.absoluteError <= Tolerance(total))) {
+    if (Expression::ShouldStopProcessing()) {
+      total.integral = NAN;
+      return total;
+    }
+    Subinterval<T> worst = PopSubinterval(heap, &numberOfSubintervals);
+    if ((worst.start == a || worst.end == b) && std::fabs(worst.end - worst.start) <= singularBoundLength) {
+      boundLooksSingular = true;
+    }
+    if (numberOfSubintervals + 2 > maxNumberOfSubintervals) {
+      Subinterval<T> smallest = RetireSmallestSubinterval(heap, &numberOfSubintervals);
+      retired.integral += smallest.quadrature.integral;
+      retired.absoluteError += smallest.quadrature.absoluteError;
+      retired.absoluteIntegral += smallest.quadrature.absoluteIntegral;
+    }
+    T middle = 0.5 * (worst.start + worst.end);
+    if (middle == worst.start || middle == worst.end) {
+      // The subinterval cannot be split anymore
+      PushSubinterval(heap, &numberOfSubintervals, worst);
+      break;
+    }
+    Subinterval<T> halves[2] = {
+      Subinterval<T>{worst.start, middle, kronrodGaussQuadrature(worst.start, middle, integrand)},
+      Subinterval<T>{middle, worst.end, kronrodGaussQuadrature(middle, worst.end, integrand)}
+    };
+    numberOfQuadratures += 2;
+    total = retired;
+    for (int i = 0; i < 2; i++) {
+      if (std::isnan(halves[i].quadrature.integral)) {
+        return halves[i].quadrature;
+      }
+      PushSubinterval(heap, &numberOfSubintervals, halves[i]);
+    }
+    // Sum from scratch rather than update the totals to avoid cancellations
+    for (int i = 0; i < numberOfSubintervals; i++) {
+      total.integral += heap[i].quadrature.integral;
+      total.absoluteError += heap[i].quadrature.absoluteError;
+      total.absoluteIntegral += heap[i].quadrature.absoluteIntegral;
+    }
+  }
+  if (total.absoluteError <= Tolerance(total) && !boundLooksSingular) {
+    return total;
+  }
+  DetailedResult<T> tanhSinh = tanhSinhQuadrature(a, b, Tolerance(total), integrand);
+  return !std::isnan(tanhSinh.integral) && tanhSinh.absoluteError < total.absoluteError ? tanhSinh : total;
 }
-#endif
 
 Expression Integral::UntypedBuilder(Expression children) {
   assert(children.type() == ExpressionNode::Type::Matrix);
@@ -213,6 +452,17 @@ Expression Integral::UntypedBuilder(Expression children) {
   return Builder(children.childAtIndex(0), children.childAtIndex(1).convert<Symbol>(), children.childAtIndex(2), children.childAtIndex(3));
 }
 
+template<typename T>
+T Integral::approximateWithError(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, T * absoluteError) const {
+  Expression::SetEncounteredComplex(false);
+  T result = static_cast<const IntegralNode *>(node())->approximateWithError<T>(context, complexFormat, angleUnit, absoluteError);
+  if (complexFormat == Preferences::ComplexFormat::Real && Expression::EncounteredComplex()) {
+    *absoluteError = NAN;
+    return NAN;
+  }
+  return result;
+}
+
 Expression Integral::shallowReduce(Context * context) {
   {
     Expression e = Expression::defaultShallowReduce();
@@ -230,4 +480,7 @@ Expression Integral::shallowReduce(Context * context) {
   return *this;
 }
 
+template float Integral::approximateWithError<float>(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, float * absoluteError) const;
+template double Integral::approximateWithError<double>(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, double * absoluteError) const;
+
 }
@@ -0,0 +1,272 @@
+#include <poincare/interval.h>
+#include <assert.h>
+
+namespace Poincare {
+
+template<typename T>
+static T Min(T a, T b) { return a < b ? a : b; }
+
+template<typename T>
+static T Max(T a, T b) { return a > b ? a : b; }
+
+/* The limit of a product of bounds is 0 when one of the factors is 0, even
+ * when the other one is infinite. */
+template<typename T>
+static T Product(T a, T b) {
+  return (a == static_cast<T>(0.0) || b == static_cast<T>(0.0)) ? static_cast<T>(0.0) : a * b;
+}
+
+// Returns true if a contains offset + k*period for some integer k
+template<typename T>
+static bool ContainsPeriodicPoint(Interval<T> a, T offset, T period) {
+  T k = std::ceil((a.lowerBound() - offset) / period);
+  return offset + k * period <= a.upperBound();
+}
+
+template<typename T>
+Interval<T>::Interval(T lowerBound, T upperBound, bool isContinuous) :
+  m_lowerBound(lowerBound),
+  m_upperBound(upperBound),
+  m_isContinuous(isContinuous)
+{
+  if (std::isnan(lowerBound) || std::isnan(upperBound)) {
+    m_lowerBound = NAN;
+    m_upperBound = NAN;
+    m_isContinuous = false;
+  }
+  assert(std::isnan(m_lowerBound) || m_lowerBound <= m_upperBound);
+}
+
+template<typename T>
+Interval<T> Interval<T>::Opposite(Interval a) {
+  return Interval(-a.m_upperBound, -a.m_lowerBound, a.m_isContinuous);
+}
+
+template<typename T>
+Interval<T> Interval<T>::Addition(Interval a, Interval b) {
+  if (a.isUndefined() || b.isUndefined()) {
+    return Undefined();
+  }
+  return Interval(a.m_lowerBound + b.m_lowerBound, a.m_upperBound + b.m_upperBound, a.m_isContinuous && b.m_isContinuous);
+}
+
+template<typename T>
+Interval<T> Interval<T>::Multiplication(Interval a, Interval b) {
+  if (a.isUndefined() || b.isUndefined()) {
+    return Undefined();
+  }
+  T p1 = Product(a.m_lowerBound, b.m_lowerBound);
+  T p2 = Product(a.m_lowerBound, b.m_upperBound);
+  T p3 = Product(a.m_upperBound, b.m_lowerBound);
+  T p4 = Product(a.m_upperBound, b.m_upperBound);
+  return Interval(Min(Min(p1, p2), Min(p3, p4)), Max(Max(p1, p2), Max(p3, p4)), a.m_isContinuous && b.m_isContinuous);
+}
+
+template<typename T>
+Interval<T> Interval<T>::Division(Interval a, Interval b) {
+  if (a.isUndefined() || b.isUndefined() || (b.isPoint() && b.m_lowerBound == static_cast<T>(0.0))) {
+    return Undefined();
+  }
+  if (b.contains(0.0)) {
+    // The quotient is undefined where b vanishes and may tend to infinity
+    return Interval(-INFINITY, INFINITY, false);
+  }
+  Interval inverse(static_cast<T>(1.0)/b.m_upperBound, static_cast<T>(1.0)/b.m_lowerBound, b.m_isContinuous);
+  return Multiplication(a, inverse);
+}
+
+template<typename T>
+Interval<T> Interval<T>::IntegerPower(Interval a, T n) {
+  assert(std::round(n) == n);
+  if (n < static_cast<T>(0.0)) {
+    return Division(Interval(1.0, 1.0), IntegerPower(a, -n));
+  }
+  if (n == static_cast<T>(0.0)) {
+    // 0^0 is undefined
+    if (a.isPoint() && a.m_lowerBound == static_cast<T>(0.0)) {
+      return Undefined();
+    }
+    return Interval(1.0, 1.0, a.m_isContinuous && !a.contains(0.0));
+  }
+  T lowerPower = std::pow(a.m_lowerBound, n);
+  T upperPower = std::pow(a.m_upperBound, n);
+  if (std::fmod(n, static_cast<T>(2.0)) != static_cast<T>(0.0)) {
+    return Interval(lowerPower, upperPower, a.m_isContinuous);
+  }
+  if (a.contains(0.0)) {
+    return Interval(0.0, Max(lowerPower, upperPower), a.m_isContinuous);
+  }
+  return Interval(Min(lowerPower, upperPower), Max(lowerPower, upperPower), a.m_isContinuous);
+}
+
+template<typename T>
+Interval<T> Interval<T>::Power(Interval a, Interval b) {
+  if (a.isUndefined() || b.isUndefined()) {
+    return Undefined();
+  }
+  if (b.isPoint()) {
+    T p = b.m_lowerBound;
+    if (std::round(p) == p) {
+      return IntegerPower(a, p);
+    }
+    // Negative numbers have no real non-integer powers
+    Interval base = Restrict(a, 0.0, INFINITY);
+    if (base.isUndefined()) {
+      return Undefined();
+    }
+    T lowerPower = std::pow(base.m_lowerBound, p);
+    T upperPower = std::pow(base.m_upperBound, p);
+    if (p > static_cast<T>(0.0)) {
+      return Interval(lowerPower, upperPower, base.m_isContinuous);
+    }
+    // 0 has no negative power
+    return Interval(upperPower, lowerPower, base.m_isContinuous && base.m_lowerBound > static_cast<T>(0.0));
+  }
+  if (!(a.m_lowerBound > static_cast<T>(0.0))) {
+    // Non-positive numbers only have integer powers, which cannot be enclosed
+    return Interval(-INFINITY, INFINITY, false);
+  }
+  /* On positive bases, x^y is monotonic in x and in y, so its extrema are
+   * reached at the corners. */
+  T p1 = std::pow(a.m_lowerBound, b.m_lowerBound);
+  T p2 = std::pow(a.m_lowerBound, b.m_upperBound);
+  T p3 = std::pow(a.m_upperBound, b.m_lowerBound);
+  T p4 = std::pow(a.m_upperBound, b.m_upperBound);
+  return Interval(Min(Min(p1, p2), Min(p3, p4)), Max(Max(p1, p2), Max(p3, p4)), a.m_isContinuous && b.m_isContinuous);
+}
+
+template<typename T>
+Interval<T> Interval<T>::AbsoluteValue(Interval a) {
+  if (a.isUndefined()) {
+    return Undefined();
+  }
+  T lowerAbs = std::fabs(a.m_lowerBound);
+  T upperAbs = std::fabs(a.m_upperBound);
+  if (a.contains(0.0)) {
+    return Interval(0.0, Max(lowerAbs, upperAbs), a.m_isContinuous);
+  }
+  return Interval(Min(lowerAbs, upperAbs), Max(lowerAbs, upperAbs), a.m_isContinuous);
+}
+
+template<typename T>
+Interval<T> Interval<T>::NaperianLogarithm(Interval a) {
+  Interval result = Increasing(a, std::log, 0.0, INFINITY);
+  // ln(0) is undefined
+  return a.m_lowerBound > static_cast<T>(0.0) ? result : result.discontinuous();
+}
+
+template<typename T>
+Interval<T> Interval<T>::Floor(Interval a) {
+  T lowerFloor = std::floor(a.m_lowerBound);
+  T upperFloor = std::floor(a.m_upperBound);
+  return Interval(lowerFloor, upperFloor, a.m_isContinuous && lowerFloor == upperFloor);
+}
+
+template<typename T>
+Interval<T> Interval<T>::Ceiling(Interval a) {
+  T lowerCeiling = std::ceil(a.m_lowerBound);
+  T upperCeiling = std::ceil(a.m_upperBound);
+  return Interval(lowerCeiling, upperCeiling, a.m_isContinuous && lowerCeiling == upperCeiling);
+}
+
+template<typename T>
+Interval<T> Interval<T>::FracPart(Interval a) {
+  T lowerFloor = std::floor(a.m_lowerBound);
+  if (a.isUndefined() || lowerFloor != std::floor(a.m_upperBound)) {
+    return a.isUndefined() ? Undefined() : Interval(0.0, 1.0, false);
+  }
+  return Interval(a.m_lowerBound - lowerFloor, a.m_upperBound - lowerFloor, a.m_isContinuous);
+}
+
+template<typename T>
+Interval<T> Interval<T>::SignFunction(Interval a) {
+  if (a.isUndefined()) {
+    return Undefined();
+  }
+  T lowerSign = a.m_lowerBound < static_cast<T>(0.0) ? -1.0 : (a.m_lowerBound > static_cast<T>(0.0) ? 1.0 : 0.0);
+  T upperSign = a.m_upperBound < static_cast<T>(0.0) ? -1.0 : (a.m_upperBound > static_cast<T>(0.0) ? 1.0 : 0.0);
+  return Interval(lowerSign, upperSign, a.m_isContinuous && lowerSign == upperSign);
+}
+
+template<typename T>
+Interval<T> Interval<T>::Sine(Interval a) {
+  if (a.isUndefined()) {
+    return Undefined();
+  }
+  if (!(a.m_upperBound - a.m_lowerBound < static_cast<T>(2.0*M_PI))) {
+    return Interval(-1.0, 1.0, a.m_isContinuous);
+  }
+  T lowerSine = std::sin(a.m_lowerBound);
+  T upperSine = std::sin(a.m_upperBound);
+  return Interval(
+      ContainsPeriodicPoint<T>(a, -M_PI/2.0, 2.0*M_PI) ? -1.0 : Min(lowerSine, upperSine),
+      ContainsPeriodicPoint<T>(a, M_PI/2.0, 2.0*M_PI) ? 1.0 : Max(lowerSine, upperSine),
+      a.m_isContinuous);
+}
+
+template<typename T>
+Interval<T> Interval<T>::Cosine(Interval a) {
+  if (a.isUndefined()) {
+    return Undefined();
+  }
+  if (!(a.m_upperBound - a.m_lowerBound < static_cast<T>(2.0*M_PI))) {
+    return Interval(-1.0, 1.0, a.m_isContinuous);
+  }
+  T lowerCosine = std::cos(a.m_lowerBound);
+  T upperCosine = std::cos(a.m_upperBound);
+  return Interval(
+      ContainsPeriodicPoint<T>(a, M_PI, 2.0*M_PI) ? -1.0 : Min(lowerCosine, upperCosine),
+      ContainsPeriodicPoint<T>(a, 0.0, 2.0*M_PI) ? 1.0 : Max(lowerCosine, upperCosine),
+      a.m_isContinuous);
+}
+
+template<typename T>
+Interval<T> Interval<T>::Tangent(Interval a) {
+  if (a.isUndefined()) {
+    return Undefined();
+  }
+  if (!(a.m_upperBound - a.m_lowerBound < static_cast<T>(M_PI)) || ContainsPeriodicPoint<T>(a, M_PI/2.0, M_PI)) {
+    return Interval(-INFINITY, INFINITY, false);
+  }
+  return Interval(std::tan(a.m_lowerBound), std::tan(a.m_upperBound), a.m_isContinuous);
+}
+
+template<typename T>
+Interval<T> Interval<T>::HyperbolicCosine(Interval a) {
+  Interval absoluteValue = AbsoluteValue(a);
+  return Increasing(absoluteValue, std::cosh);
+}
+
+template<typename T>
+Interval<T> Interval<T>::Increasing(Interval a, T (*f)(T), T domainMin, T domainMax) {
+  Interval restricted = Restrict(a, domainMin, domainMax);
+  if (restricted.isUndefined()) {
+    return Undefined();
+  }
+  return Interval(f(restricted.m_lowerBound), f(restricted.m_upperBound), restricted.m_isContinuous);
+}
+
+template<typename T>
+Interval<T> Interval<T>::Decreasing(Interval a, T (*f)(T), T domainMin, T domainMax) {
+  Interval restricted = Restrict(a, domainMin, domainMax);
+  if (restricted.isUndefined()) {
+    return Undefined();
+  }
+  return Interval(f(restricted.m_upperBound), f(restricted.m_lowerBound), restricted.m_isContinuous);
+}
+
+template<typename T>
+Interval<T> Interval<T>::Restrict(Interval a, T domainMin, T domainMax) {
+  if (a.isUndefined() || a.m_upperBound < domainMin || a.m_lowerBound > domainMax) {
+    return Undefined();
+  }
+  return Interval(
+      Max(a.m_lowerBound, domainMin),
+      Min(a.m_upperBound, domainMax),
+      a.m_isContinuous && domainMin <= a.m_lowerBound && a.m_upperBound <= domainMax);
+}
+
+template class Interval<float>;
+template class Interval<double>;
+
+}
@@ -26,17 +26,13 @@ Expression InvBinomNode::shallowReduce(ReductionContext reductionContext) {
 }
 
 template<typename T>
-Evaluation<T> InvBinomNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  Evaluation<T> aEvaluation = childAtIndex(0)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> nEvaluation = childAtIndex(1)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> pEvaluation = childAtIndex(2)->approximate(T(), context, complexFormat, angleUnit);
-
-  T a = aEvaluation.toScalar();
-  T n = nEvaluation.toScalar();
-  T p = pEvaluation.toScalar();
+std::complex<T> InvBinomNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  T a = ApproximationHelper::RealScalar<T>(childAtIndex(0), context, complexFormat, angleUnit);
+  T n = ApproximationHelper::RealScalar<T>(childAtIndex(1), context, complexFormat, angleUnit);
+  T p = ApproximationHelper::RealScalar<T>(childAtIndex(2), context, complexFormat, angleUnit);
 
   // CumulativeDistributiveInverseForProbability handles bad n and p values
-  return Complex<T>::Builder(BinomialDistribution::CumulativeDistributiveInverseForProbability<T>(a, n, p));
+  return BinomialDistribution::CumulativeDistributiveInverseForProbability<T>(a, n, p);
 }
 
 Expression InvBinom::shallowReduce(ExpressionNode::ReductionContext reductionContext) {
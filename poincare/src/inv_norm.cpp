@@ -26,17 +26,13 @@ Expression InvNormNode::shallowReduce(ReductionContext reductionContext) {
 }
 
 template<typename T>
-Evaluation<T> InvNormNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  Evaluation<T> aEvaluation = childAtIndex(0)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> muEvaluation = childAtIndex(1)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> varEvaluation = childAtIndex(2)->approximate(T(), context, complexFormat, angleUnit);
-
-  T a = aEvaluation.toScalar();
-  T mu = muEvaluation.toScalar();
-  T sigma = std::sqrt(varEvaluation.toScalar());
+std::complex<T> InvNormNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  T a = ApproximationHelper::RealScalar<T>(childAtIndex(0), context, complexFormat, angleUnit);
+  T mu = ApproximationHelper::RealScalar<T>(childAtIndex(1), context, complexFormat, angleUnit);
+  T sigma = std::sqrt(ApproximationHelper::RealScalar<T>(childAtIndex(2), context, complexFormat, angleUnit));
 
   // CumulativeDistributiveInverseForProbability handles bad mu and var values
-  return Complex<T>::Builder(NormalDistribution::CumulativeDistributiveInverseForProbability<T>(a, mu, sigma));
+  return NormalDistribution::CumulativeDistributiveInverseForProbability<T>(a, mu, sigma);
 }
 
 Expression InvNorm::shallowReduce(ExpressionNode::ReductionContext reductionContext) {
@@ -27,15 +27,15 @@ Expression LeastCommonMultipleNode::shallowReduce(ReductionContext reductionCont
 }
 
 template<typename T>
-Evaluation<T> LeastCommonMultipleNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+std::complex<T> LeastCommonMultipleNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
   bool isUndefined = false;
   int a = ApproximationHelper::PositiveIntegerApproximationIfPossible<T>(childAtIndex(0), &isUndefined, context, complexFormat, angleUnit);
   int b = ApproximationHelper::PositiveIntegerApproximationIfPossible<T>(childAtIndex(1), &isUndefined, context, complexFormat, angleUnit);
   if (isUndefined) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
   if (a == 0 || b == 0) {
-    return Complex<T>::Builder(0.0);
+    return 0.0;
   }
   if (b > a) {
     int temp = b;
@@ -49,7 +49,7 @@ Evaluation<T> LeastCommonMultipleNode::templatedApproximate(Context * context, P
     a = b;
     b = r;
   }
-  return Complex<T>::Builder(product/a);
+  return product/a;
 }
 
 
@@ -91,11 +91,30 @@ template<typename U> Evaluation<U> LogarithmNode<2>::templatedApproximate(Contex
   if (x.type() == EvaluationNode<U>::Type::Complex && n.type() == EvaluationNode<U>::Type::Complex) {
     std::complex<U> xc = (static_cast<Complex<U>&>(x)).stdComplex();
     std::complex<U> nc = (static_cast<Complex<U>&>(n)).stdComplex();
-    result = DivisionNode::compute<U>(computeOnComplex(xc, complexFormat, angleUnit).stdComplex(), computeOnComplex(nc, complexFormat, angleUnit).stdComplex(), complexFormat).stdComplex();
+    /* Building the intermediate Complex flags non-real logarithms even if
+     * their quotient is real. */
+    std::complex<U> logx = Complex<U>::Builder(computeOnComplex(xc, complexFormat, angleUnit)).stdComplex();
+    std::complex<U> logn = Complex<U>::Builder(computeOnComplex(nc, complexFormat, angleUnit)).stdComplex();
+    result = DivisionNode::compute<U>(logx, logn, complexFormat);
   }
   return Complex<U>::Builder(result);
 }
 
+template<>
+template<typename U> std::complex<U> LogarithmNode<1>::templatedApproximateScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return ApproximationHelper::MapScalar(this, context, complexFormat, angleUnit, computeOnComplex<U>);
+}
+
+template<>
+template<typename U> std::complex<U> LogarithmNode<2>::templatedApproximateScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  std::complex<U> x = childAtIndex(0)->approximateScalar(U(), context, complexFormat, angleUnit);
+  std::complex<U> n = childAtIndex(1)->approximateScalar(U(), context, complexFormat, angleUnit);
+  // Flag non-real logarithms as templatedApproximate does
+  std::complex<U> logx = ApproximationHelper::ScalarResult(computeOnComplex(x, complexFormat, angleUnit));
+  std::complex<U> logn = ApproximationHelper::ScalarResult(computeOnComplex(n, complexFormat, angleUnit));
+  return ApproximationHelper::ScalarResult(DivisionNode::compute<U>(logx, logn, complexFormat));
+}
+
 void Logarithm::deepReduceChildren(ExpressionNode::ReductionContext reductionContext) {
   /* We reduce the base first because of the case log(x1^y, x2) with x1 == x2.
    * When reducing x1^y, we want to be able to compare x1 of x2 so x2 need to be
@@ -383,6 +402,10 @@ template Evaluation<float> LogarithmNode<1>::templatedApproximate<float>(Poincar
 template Evaluation<double> LogarithmNode<1>::templatedApproximate<double>(Poincare::Context *, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit) const;
 template Evaluation<float> LogarithmNode<2>::templatedApproximate<float>(Poincare::Context *, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit) const;
 template Evaluation<double> LogarithmNode<2>::templatedApproximate<double>(Poincare::Context *, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit) const;
+template std::complex<float> LogarithmNode<1>::templatedApproximateScalar<float>(Poincare::Context *, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit) const;
+template std::complex<double> LogarithmNode<1>::templatedApproximateScalar<double>(Poincare::Context *, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit) const;
+template std::complex<float> LogarithmNode<2>::templatedApproximateScalar<float>(Poincare::Context *, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit) const;
+template std::complex<double> LogarithmNode<2>::templatedApproximateScalar<double>(Poincare::Context *, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit) const;
 template int LogarithmNode<1>::serialize(char * buffer, int bufferSize, Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const;
 template int LogarithmNode<2>::serialize(char * buffer, int bufferSize, Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const;
 
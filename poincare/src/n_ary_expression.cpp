@@ -25,14 +25,20 @@ bool NAryExpressionNode::childAtIndexNeedsUserParentheses(const Expression & chi
 
 void NAryExpressionNode::sortChildrenInPlace(ExpressionOrder order, Context * context, bool canSwapMatrices, bool canBeInterrupted) {
   Expression reference(this);
-  for (int i = 1; i < reference.numberOfChildren(); i++) {
+  int childrenCount = reference.numberOfChildren();
+  for (int i = 1; i < childrenCount; i++) {
     bool isSorted = true;
-    for (int j = 0; j < reference.numberOfChildren()-1; j++) {
+    /* Children are visited through their siblings rather than with
+     * childAtIndex, and whether the child at index j is a matrix is carried
+     * over from the previous comparison. Swapping the children at j and j+1
+     * does not move the child at index j, so cj->nextSibling() is always the
+     * child at index j+1. */
+    ExpressionNode * cj = childAtIndex(0);
+    bool cjIsMatrix = Expression(cj).deepIsMatrix(context);
+    for (int j = 0; j < childrenCount-1; j++) {
       /* Warning: Matrix operations are not always commutative (ie,
        * multiplication) so we never swap 2 matrices. */
-      ExpressionNode * cj = childAtIndex(j);
-      ExpressionNode * cj1 = childAtIndex(j+1);
-      bool cjIsMatrix = Expression(cj).deepIsMatrix(context);
+      ExpressionNode * cj1 = static_cast<ExpressionNode *>(cj->nextSibling());
       bool cj1IsMatrix = Expression(cj1).deepIsMatrix(context);
       bool cj1GreaterThanCj = order(cj, cj1, canBeInterrupted) > 0;
       if ((cjIsMatrix && !cj1IsMatrix) || // we always put matrices at the end of expressions
@@ -40,7 +46,11 @@ void NAryExpressionNode::sortChildrenInPlace(ExpressionOrder order, Context * co
           (!cjIsMatrix && !cj1IsMatrix && cj1GreaterThanCj)) {
         reference.swapChildrenInPlace(j, j+1);
         isSorted = false;
+        // The child now at index j+1 is the former child at index j
+        cj1IsMatrix = cjIsMatrix;
       }
+      cj = static_cast<ExpressionNode *>(cj->nextSibling());
+      cjIsMatrix = cj1IsMatrix;
     }
     if (isSorted) {
       return;
@@ -96,6 +106,15 @@ int NAryExpressionNode::simplificationOrderGreaterType(const ExpressionNode * e,
   return 0;
 }
 
+uint32_t NAryExpressionNode::computeStructuralHash() const {
+  /* An n-ary expression with a single child has a null simplification order
+   * with its child (see simplificationOrderGreaterType). */
+  if (numberOfChildren() == 1) {
+    return childAtIndex(0)->structuralHash();
+  }
+  return ExpressionNode::computeStructuralHash();
+}
+
 int NAryExpression::allChildrenAreReal(Context * context) const {
   int i = 0;
   int result = 1;
@@ -24,24 +24,19 @@ int NormCDF2Node::serialize(char * buffer, int bufferSize, Preferences::PrintFlo
 }
 
 template<typename T>
-Evaluation<T> NormCDF2Node::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  Evaluation<T> aEvaluation = childAtIndex(0)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> bEvaluation = childAtIndex(1)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> muEvaluation = childAtIndex(2)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> varEvaluation = childAtIndex(3)->approximate(T(), context, complexFormat, angleUnit);
-
-  T a = aEvaluation.toScalar();
-  T b = bEvaluation.toScalar();
-  T mu = muEvaluation.toScalar();
-  T sigma = std::sqrt(varEvaluation.toScalar());
+std::complex<T> NormCDF2Node::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  T a = ApproximationHelper::RealScalar<T>(childAtIndex(0), context, complexFormat, angleUnit);
+  T b = ApproximationHelper::RealScalar<T>(childAtIndex(1), context, complexFormat, angleUnit);
+  T mu = ApproximationHelper::RealScalar<T>(childAtIndex(2), context, complexFormat, angleUnit);
+  T sigma = std::sqrt(ApproximationHelper::RealScalar<T>(childAtIndex(3), context, complexFormat, angleUnit));
 
   if (std::isnan(a) || std::isnan(b) || !NormalDistribution::MuAndSigmaAreOK(mu,sigma)) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
   if (b <= a) {
-    return Complex<T>::Builder((T)0.0);
+    return (T)0.0;
   }
-  return Complex<T>::Builder(NormalDistribution::CumulativeDistributiveFunctionAtAbscissa(b, mu, sigma) - NormalDistribution::CumulativeDistributiveFunctionAtAbscissa(a, mu, sigma));
+  return NormalDistribution::CumulativeDistributiveFunctionAtAbscissa(b, mu, sigma) - NormalDistribution::CumulativeDistributiveFunctionAtAbscissa(a, mu, sigma);
 }
 
 }
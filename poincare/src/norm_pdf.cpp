@@ -24,17 +24,13 @@ int NormPDFNode::serialize(char * buffer, int bufferSize, Preferences::PrintFloa
 }
 
 template<typename T>
-Evaluation<T> NormPDFNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  Evaluation<T> xEvaluation = childAtIndex(0)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> muEvaluation = childAtIndex(1)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> varEvaluation = childAtIndex(2)->approximate(T(), context, complexFormat, angleUnit);
-
-  T x = xEvaluation.toScalar();
-  T mu = muEvaluation.toScalar();
-  T sigma = std::sqrt(varEvaluation.toScalar());
+std::complex<T> NormPDFNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  T x = ApproximationHelper::RealScalar<T>(childAtIndex(0), context, complexFormat, angleUnit);
+  T mu = ApproximationHelper::RealScalar<T>(childAtIndex(1), context, complexFormat, angleUnit);
+  T sigma = std::sqrt(ApproximationHelper::RealScalar<T>(childAtIndex(2), context, complexFormat, angleUnit));
 
   // EvaluateAtAbscissa handles bad mu and var values
-  return Complex<T>::Builder(NormalDistribution::EvaluateAtAbscissa(x, mu, sigma));
+  return NormalDistribution::EvaluateAtAbscissa(x, mu, sigma);
 }
 
 }
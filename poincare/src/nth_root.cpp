@@ -34,34 +34,26 @@ Expression NthRootNode::shallowReduce(ReductionContext reductionContext) {
 }
 
 template<typename T>
-Evaluation<T> NthRootNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  Evaluation<T> base = childAtIndex(0)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> index = childAtIndex(1)->approximate(T(), context, complexFormat, angleUnit);
-  Complex<T> result = Complex<T>::Undefined();
-  if (base.type() == EvaluationNode<T>::Type::Complex
-      && index.type() == EvaluationNode<T>::Type::Complex)
-  {
-    std::complex<T> basec = static_cast<Complex<T> &>(base).stdComplex();
-    std::complex<T> indexc = static_cast<Complex<T> &>(index).stdComplex();
-    /* If the complexFormat is Real, we look for nthroot of form root(x,q) with
-     * x real and q integer because they might have a real form which does not
-     * correspond to the principale angle. */
-    if (complexFormat == Preferences::ComplexFormat::Real) {
-      // root(x, q) with q integer and x real
-      if (basec.imag() == 0.0 && indexc.imag() == 0.0 && std::round(indexc.real()) == indexc.real()) {
-        std::complex<T> absBasec = basec;
-        absBasec.real(std::fabs(absBasec.real()));
-        // compute root(|x|, q)
-        Complex<T> absBasePowIndex = PowerNode::compute(absBasec, std::complex<T>(1.0)/(indexc), complexFormat);
-        // q odd if (-1)^q = -1
-        if (std::pow((T)-1.0, (T)indexc.real()) < 0.0) {
-          return basec.real() < 0 ? Complex<T>::Builder(-absBasePowIndex.stdComplex()) : absBasePowIndex;
-        }
+std::complex<T> NthRootNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  std::complex<T> basec = childAtIndex(0)->approximateScalar(T(), context, complexFormat, angleUnit);
+  std::complex<T> indexc = childAtIndex(1)->approximateScalar(T(), context, complexFormat, angleUnit);
+  /* If the complexFormat is Real, we look for nthroot of form root(x,q) with
+   * x real and q integer because they might have a real form which does not
+   * correspond to the principale angle. */
+  if (complexFormat == Preferences::ComplexFormat::Real) {
+    // root(x, q) with q integer and x real
+    if (basec.imag() == 0.0 && indexc.imag() == 0.0 && std::round(indexc.real()) == indexc.real()) {
+      std::complex<T> absBasec = basec;
+      absBasec.real(std::fabs(absBasec.real()));
+      // compute root(|x|, q)
+      std::complex<T> absBasePowIndex = PowerNode::compute(absBasec, std::complex<T>(1.0)/(indexc), complexFormat);
+      // q odd if (-1)^q = -1
+      if (std::pow((T)-1.0, (T)indexc.real()) < 0.0) {
+        return basec.real() < 0 ? -absBasePowIndex : absBasePowIndex;
       }
     }
-    result = PowerNode::compute(basec, std::complex<T>(1.0)/(indexc), complexFormat);
   }
-  return std::move(result);
+  return PowerNode::compute(basec, std::complex<T>(1.0)/(indexc), complexFormat);
 }
 
 
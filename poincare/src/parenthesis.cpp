@@ -25,6 +25,11 @@ Evaluation<T> ParenthesisNode::templatedApproximate(Context * context, Preferenc
   return childAtIndex(0)->approximate(T(), context, complexFormat, angleUnit);
 }
 
+template<typename T>
+std::complex<T> ParenthesisNode::templatedApproximateScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return childAtIndex(0)->approximateScalar(T(), context, complexFormat, angleUnit);
+}
+
 
 Expression Parenthesis::shallowReduce() {
   Expression e = Expression::defaultShallowReduce();
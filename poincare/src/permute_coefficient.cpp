@@ -28,25 +28,23 @@ Expression PermuteCoefficientNode::shallowReduce(ReductionContext reductionConte
 }
 
 template<typename T>
-Evaluation<T> PermuteCoefficientNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  Evaluation<T> nInput = childAtIndex(0)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> kInput = childAtIndex(1)->approximate(T(), context, complexFormat, angleUnit);
-  T n = nInput.toScalar();
-  T k = kInput.toScalar();
+std::complex<T> PermuteCoefficientNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  T n = ApproximationHelper::RealScalar<T>(childAtIndex(0), context, complexFormat, angleUnit);
+  T k = ApproximationHelper::RealScalar<T>(childAtIndex(1), context, complexFormat, angleUnit);
   if (std::isnan(n) || std::isnan(k) || n != std::round(n) || k != std::round(k) || n < 0.0f || k < 0.0f) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
   if (k > n) {
-    return Complex<T>::Builder(0.0);
+    return 0.0;
   }
   T result = 1;
   for (int i = (int)n-(int)k+1; i <= (int)n; i++) {
     result *= i;
     if (std::isinf(result) || std::isnan(result)) {
-      return Complex<T>::Builder(result);
+      return result;
     }
   }
-  return Complex<T>::Builder(std::round(result));
+  return std::round(result);
 }
 
 
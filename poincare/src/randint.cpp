@@ -1,4 +1,5 @@
 #include <poincare/randint.h>
+#include <poincare/approximation_helper.h>
 #include <poincare/complex.h>
 #include <poincare/infinity.h>
 #include <poincare/integer.h>
@@ -34,8 +35,16 @@ template <typename T> Evaluation<T> RandintNode::templateApproximate(Context * c
   if (inputIsUndefined) {
     *inputIsUndefined = aInput.isUndefined() || bInput.isUndefined();
   }
-  T a = aInput.toScalar();
-  T b = bInput.toScalar();
+  return Complex<T>::Builder(RandomIntegerBetween(aInput.toScalar(), bInput.toScalar()));
+}
+
+template <typename T> std::complex<T> RandintNode::templateApproximateScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  T a = ApproximationHelper::RealScalar<T>(childAtIndex(0), context, complexFormat, angleUnit);
+  T b = ApproximationHelper::RealScalar<T>(childAtIndex(1), context, complexFormat, angleUnit);
+  return RandomIntegerBetween(a, b);
+}
+
+template <typename T> std::complex<T> RandintNode::RandomIntegerBetween(T a, T b) {
   /* randint is undefined if:
    * - one of the bounds is NAN or INF
    * - the last bound is lesser than the first one
@@ -50,10 +59,9 @@ template <typename T> Evaluation<T> RandintNode::templateApproximate(Context * c
       || a > b
       || a != (int)a || b != (int)b
       || (Expression::Epsilon<T>()*(b+1.0-a) > 1.0)) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
-  T result = std::floor(Random::random<T>()*(b+1.0-a)+a);
-  return Complex<T>::Builder(result);
+  return std::floor(Random::random<T>()*(b+1.0-a)+a);
 }
 
 Expression RandintNode::shallowReduce(ReductionContext reductionContext) {
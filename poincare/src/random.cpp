@@ -29,6 +29,10 @@ template <typename T> Evaluation<T> RandomNode::templateApproximate() const {
   return Complex<T>::Builder(Random::random<T>());
 }
 
+template <typename T> std::complex<T> RandomNode::templateApproximateScalar() const {
+  return Random::random<T>();
+}
+
 template<typename T> T Random::random() {
   if (sizeof(T) == sizeof(float)) {
     uint32_t r = Ion::random();
@@ -45,6 +49,8 @@ template<typename T> T Random::random() {
 
 template Evaluation<float> RandomNode::templateApproximate<float>() const;
 template Evaluation<double> RandomNode::templateApproximate<double>() const;
+template std::complex<float> RandomNode::templateApproximateScalar<float>() const;
+template std::complex<double> RandomNode::templateApproximateScalar<double>() const;
 template float Random::random();
 template double Random::random();
 
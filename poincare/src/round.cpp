@@ -27,16 +27,14 @@ Expression RoundNode::shallowReduce(ReductionContext reductionContext) {
 }
 
 template<typename T>
-Evaluation<T> RoundNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
-  Evaluation<T> f1Input = childAtIndex(0)->approximate(T(), context, complexFormat, angleUnit);
-  Evaluation<T> f2Input = childAtIndex(1)->approximate(T(), context, complexFormat, angleUnit);
-  T f1 = f1Input.toScalar();
-  T f2 = f2Input.toScalar();
+std::complex<T> RoundNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  T f1 = ApproximationHelper::RealScalar<T>(childAtIndex(0), context, complexFormat, angleUnit);
+  T f2 = ApproximationHelper::RealScalar<T>(childAtIndex(1), context, complexFormat, angleUnit);
   if (std::isnan(f2) || f2 != std::round(f2)) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
   T err = std::pow(10, std::floor(f2));
-  return Complex<T>::Builder(std::round(f1*err)/err);
+  return std::round(f1*err)/err;
 }
 
 Expression Round::shallowReduce(ExpressionNode::ReductionContext reductionContext) {
@@ -47,6 +47,28 @@ Evaluation<T> SequenceNode::templatedApproximate(Context * context, Preferences:
   return result;
 }
 
+template<typename T>
+std::complex<T> SequenceNode::templatedApproximateScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  T start = ApproximationHelper::RealScalar<T>(childAtIndex(2), context, complexFormat, angleUnit);
+  T end = ApproximationHelper::RealScalar<T>(childAtIndex(3), context, complexFormat, angleUnit);
+  if (std::isnan(start) || std::isnan(end) || start != (int)start || end != (int)end || end - start > k_maxNumberOfSteps) {
+    return std::complex<T>(NAN, NAN);
+  }
+  VariableContext nContext = VariableContext(static_cast<SymbolNode *>(childAtIndex(1))->name(), context);
+  std::complex<T> result = (T)emptySequenceValue();
+  for (int i = (int)start; i <= (int)end; i++) {
+    if (Expression::ShouldStopProcessing()) {
+      return std::complex<T>(NAN, NAN);
+    }
+    nContext.setApproximationForVariable<T>((T)i);
+    result = ApproximationHelper::ScalarResult(scalarWithNextTerm(T(), result, childAtIndex(0)->approximateScalar(T(), &nContext, complexFormat, angleUnit)));
+    if (std::isnan(result.real()) && std::isnan(result.imag())) {
+      return std::complex<T>(NAN, NAN);
+    }
+  }
+  return result;
+}
+
 Expression Sequence::shallowReduce(Context * context) {
   {
     Expression e = Expression::defaultShallowReduce();
@@ -63,5 +85,7 @@ Expression Sequence::shallowReduce(Context * context) {
 
 template Evaluation<float> SequenceNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
 template Evaluation<double> SequenceNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+template std::complex<float> SequenceNode::templatedApproximateScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+template std::complex<double> SequenceNode::templatedApproximateScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
 
 }
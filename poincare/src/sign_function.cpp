@@ -40,17 +40,17 @@ Expression SignFunctionNode::shallowReduce(ReductionContext reductionContext) {
 }
 
 template<typename T>
-Complex<T> SignFunctionNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> SignFunctionNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   if (c.imag() != 0 || std::isnan(c.real())) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
   if (c.real() == 0) {
-    return Complex<T>::Builder(0.0);
+    return 0.0;
   }
   if (c.real() < 0) {
-    return Complex<T>::Builder(-1.0);
+    return -1.0;
   }
-  return Complex<T>::Builder(1.0);
+  return 1.0;
 }
 
 
@@ -16,10 +16,10 @@ float SineNode::characteristicXRange(Context * context, Preferences::AngleUnit a
 }
 
 template<typename T>
-Complex<T> SineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> SineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   std::complex<T> angleInput = Trigonometry::ConvertToRadian(c, angleUnit);
   std::complex<T> res = std::sin(angleInput);
-  return Complex<T>::Builder(Trigonometry::RoundToMeaningfulDigits(res, angleInput));
+  return Trigonometry::RoundToMeaningfulDigits(res, angleInput);
 }
 
 Layout SineNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
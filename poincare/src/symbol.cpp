@@ -126,6 +126,16 @@ Evaluation<T> SymbolNode::templatedApproximate(Context * context, Preferences::C
   return e.node()->approximate(T(), context, complexFormat, angleUnit);
 }
 
+template<typename T>
+std::complex<T> SymbolNode::templatedApproximateScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  Symbol s(this);
+  Expression e = SymbolAbstract::Expand(s, context, false);
+  if (e.isUninitialized()) {
+    return std::complex<T>(NAN, NAN);
+  }
+  return e.node()->approximateScalar(T(), context, complexFormat, angleUnit);
+}
+
 bool SymbolNode::isUnknown(CodePoint unknownSymbol) const {
   bool result = UTF8Helper::CodePointIs(m_name, unknownSymbol);
   if (result) {
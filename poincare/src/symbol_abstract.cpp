@@ -38,6 +38,15 @@ int SymbolAbstractNode::simplificationOrderSameType(const ExpressionNode * e, bo
   return strcmp(name(), static_cast<const SymbolAbstractNode *>(e)->name());
 }
 
+uint32_t SymbolAbstractNode::computeStructuralHash() const {
+  // Symbols are only compared by name (see simplificationOrderSameType)
+  uint32_t hash = static_cast<uint32_t>(type());
+  for (const char * c = name(); *c != 0; c++) {
+    hash = CombineHashes(hash, *c);
+  }
+  return hash;
+}
+
 template <typename T, typename U>
 T SymbolAbstract::Builder(const char * name, int length) {
   size_t size = sizeof(U) + length + 1;
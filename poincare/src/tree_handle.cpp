@@ -48,6 +48,7 @@ void TreeHandle::replaceChildInPlace(TreeHandle oldChild, TreeHandle newChild) {
   }
 
   assert(!isUninitialized());
+  node()->invalidateCachedHash();
 
   // If the new child has a parent, detach from it
   newChild.detachFromParent();
@@ -81,6 +82,8 @@ void TreeHandle::mergeChildrenAtIndexInPlace(TreeHandle t, int i) {
    * children with ghosts. */
   // TODO assert this and t are "dynamic" trees
   assert(i >= 0 && i <= numberOfChildren());
+  node()->invalidateCachedHash();
+  t.node()->invalidateCachedHash();
   // Steal operands
   int numberOfNewChildren = t.numberOfChildren();
   if (i < numberOfChildren()) {
@@ -106,6 +109,7 @@ void TreeHandle::swapChildrenInPlace(int i, int j) {
   if (i == j) {
     return;
   }
+  node()->invalidateCachedHash();
   int firstChildIndex = i < j ? i : j;
   int secondChildIndex = i > j ? i : j;
   TreeHandle firstChild = childAtIndex(firstChildIndex);
@@ -128,6 +132,7 @@ void TreeHandle::addChildAtIndexInPlace(TreeHandle t, int index, int currentNumb
   assert(!isUninitialized());
   assert(!t.isUninitialized());
   assert(index >= 0 && index <= currentNumberOfChildren);
+  node()->invalidateCachedHash();
 
   // If t has a parent, detach t from it.
   t.detachFromParent();
@@ -157,6 +162,7 @@ void TreeHandle::removeChildAtIndexInPlace(int i) {
 
 void TreeHandle::removeChildInPlace(TreeHandle t, int childNumberOfChildren) {
   assert(!isUninitialized());
+  node()->invalidateCachedHash();
   TreePool::sharedPool()->move(TreePool::sharedPool()->last(), t.node(), childNumberOfChildren);
   t.node()->release(childNumberOfChildren);
   t.deleteParentIdentifier();
@@ -165,6 +171,7 @@ void TreeHandle::removeChildInPlace(TreeHandle t, int childNumberOfChildren) {
 
 void TreeHandle::removeChildrenInPlace(int currentNumberOfChildren) {
   assert(!isUninitialized());
+  node()->invalidateCachedHash();
   deleteParentIdentifierInChildren();
   TreePool::sharedPool()->removeChildren(node(), currentNumberOfChildren);
 }
@@ -15,6 +15,14 @@ void TreeNode::release(int currentNumberOfChildren) {
   }
 }
 
+void TreeNode::invalidateCachedHash() {
+  TreeNode * node = this;
+  while (node != nullptr && node->m_cachedHash != 0) {
+    node->m_cachedHash = 0;
+    node = node->parent();
+  }
+}
+
 void TreeNode::rename(int identifier, bool unregisterPreviousIdentifier) {
   if (unregisterPreviousIdentifier) {
     /* The previous identifier should not always be unregistered. For instance,
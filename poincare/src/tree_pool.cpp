@@ -2,6 +2,7 @@
 #include <poincare/exception_checkpoint.h>
 #include <poincare/helpers.h>
 #include <poincare/tree_handle.h>
+#include <ion/profiling.h>
 #include <poincare/test/tree/blob_node.h>
 #include <poincare/test/tree/pair_node.h>
 #include <string.h>
@@ -61,6 +62,10 @@ TreeNode * TreePool::copyTreeFromAddress(const void * address, size_t size) {
 }
 
 void TreePool::removeChildrenAndDestroy(TreeNode * nodeToDestroy, int nodeNumberOfChildren) {
+  if (canDiscardTreeAtOnce(nodeToDestroy, nodeNumberOfChildren)) {
+    discardTree(nodeToDestroy, nodeNumberOfChildren);
+    return;
+  }
   removeChildren(nodeToDestroy, nodeNumberOfChildren);
   discardTreeNode(nodeToDestroy);
 }
@@ -75,6 +80,8 @@ void TreePool::moveNodes(TreeNode * destination, TreeNode * source, size_t moveS
   size_t len = moveSize/4;
 
   if (Helpers::Rotate(dst, src, len)) {
+    // Rotate moves every word between the source and the destination
+    m_statistics.bytesMoved += 4 * (dst < src ? src + len - dst : dst - src);
     updateNodeForIdentifierFromNode(dst < src ? destination : source);
   }
 }
@@ -112,13 +119,22 @@ int TreePool::numberOfNodes() const {
   return count;
 }
 
+void TreePool::resetStatistics() {
+  m_statistics = Statistics{0, liveBytes(), 0, 0};
+}
+
 void * TreePool::alloc(size_t size) {
   size = Helpers::AlignedSize(size, ByteAlignment);
   if (m_cursor >= buffer() + BufferSize || m_cursor + size > buffer() + BufferSize) {
+    m_statistics.numberOfPoolFullAborts++;
     ExceptionCheckpoint::Raise();
   }
   void * result = m_cursor;
   m_cursor += size;
+  if (liveBytes() > m_statistics.peakLiveBytes) {
+    m_statistics.peakLiveBytes = liveBytes();
+  }
+  Ion::Profiling::record(Ion::Profiling::Gauge::TreePoolLiveBytes, liveBytes());
   return result;
 }
 
@@ -133,6 +149,8 @@ void TreePool::dealloc(TreeNode * node, size_t size) {
     ptr + size,
     m_cursor - (ptr + size)
   );
+  m_statistics.bytesMoved += m_cursor - (ptr + size);
+  m_statistics.numberOfCompactions++;
   m_cursor -= size;
 
   // Step 2: Update m_nodeForIdentifier for all nodes downstream
@@ -147,6 +165,37 @@ void TreePool::discardTreeNode(TreeNode * node) {
   freeIdentifier(nodeIdentifier);
 }
 
+bool TreePool::canDiscardTreeAtOnce(TreeNode * node, int nodeNumberOfChildren) const {
+  /* A descendant retained only once is only retained by its parent: it will be
+   * destroyed with the tree. If a descendant is retained by a handle too, it
+   * has to survive its parent and the tree must be dismantled node by node. */
+  TreeNode * end = reinterpret_cast<TreeNode *>(reinterpret_cast<char *>(node) + node->deepSize(nodeNumberOfChildren));
+  for (TreeNode * n = node->next(); n != end; n = n->next()) {
+    if (n->retainCount() != 1) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void TreePool::discardTree(TreeNode * node, int nodeNumberOfChildren) {
+  /* Destroying the nodes one by one would compact the pool once per node. As
+   * the tree is contiguous, we destroy all its nodes and then compact the
+   * pool only once. */
+  size_t size = node->deepSize(nodeNumberOfChildren);
+  TreeNode * end = reinterpret_cast<TreeNode *>(reinterpret_cast<char *>(node) + size);
+  TreeNode * n = node;
+  while (n != end) {
+    // Compute the next node before destroying the current one
+    TreeNode * nextNode = n->next();
+    int nodeIdentifier = n->identifier();
+    n->~TreeNode();
+    freeIdentifier(nodeIdentifier);
+    n = nextNode;
+  }
+  dealloc(node, size);
+}
+
 void TreePool::registerNode(TreeNode * node) {
   int nodeID = node->identifier();
   if (nodeID >= 0 && nodeID < MaxNumberOfNodes) {
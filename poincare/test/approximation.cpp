@@ -2,6 +2,8 @@
 #include <poincare/expression.h>
 #include <poincare/rational.h>
 #include <poincare/addition.h>
+#include <poincare/approximation_program.h>
+#include <poincare/integral.h>
 #include <apps/shared/global_context.h>
 #include <ion.h>
 #include <assert.h>
@@ -409,6 +411,24 @@ QUIZ_CASE(poincare_approximation_function) {
   assert_expression_approximates_to<float>("int(1+cos(e),e, 0, 180)", "180");
   assert_expression_approximates_to<double>("int(1+cos(e),e, 0, 180)", "180");
 
+  // Singularities at the bounds
+  assert_expression_approximates_to<float>("int(1/√(x),x,0,1)", "2");
+  assert_expression_approximates_to<double>("int(1/√(x),x,0,1)", "2");
+  assert_expression_approximates_to<double>("int(ln(x),x,0,1)", "-1");
+  assert_expression_approximates_to<double>("int(ℯ^(-x^2),x,0,10)", "8.8622692545276ᴇ-1");
+  assert_expression_approximates_to<double>("int(sin(x)/x,x,1,100)", "6.1614239652187ᴇ-1", Radian);
+
+  /* Oscillating integrands over many periods, whose integrals cancel out.
+   * Their tolerance is relative to the integral of the absolute value. */
+  assert_expression_approximates_to<float>("int(sin(x),x,0,1000)", "0.4376", Radian, Cartesian, 4);
+  assert_expression_approximates_to<double>("int(sin(x),x,0,1000)", "0.437620923709", Radian, Cartesian, 12);
+  assert_expression_approximates_to<float>("int(sin(10x),x,0,100)", "0.04376", Radian, Cartesian, 4);
+  assert_expression_approximates_to<double>("int(sin(10x),x,0,100)", "0.0437620923709", Radian, Cartesian, 12);
+  assert_expression_approximates_to<float>("int(abs(sin(x)),x,0,100)", "63.86", Radian, Cartesian, 4);
+  assert_expression_approximates_to<double>("int(abs(sin(x)),x,0,100)", "63.8623188723", Radian, Cartesian, 12);
+  assert_expression_approximates_to<float>("int(cos(x)^2,x,0,500)", "250.2", Radian, Cartesian, 4);
+  assert_expression_approximates_to<double>("int(cos(x)^2,x,0,500)", "250.206719885", Radian, Cartesian, 12);
+
   assert_expression_approximation_is_bounded("random()", 0.0f, 1.0f);
   assert_expression_approximation_is_bounded("random()", 0.0, 1.0);
 
@@ -416,6 +436,29 @@ QUIZ_CASE(poincare_approximation_function) {
   assert_expression_approximation_is_bounded("randint(4,45)", 4.0, 45.0, true);
 }
 
+void assert_integral_approximates_to(const char * expression, double approximation, double maxAbsoluteError) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(expression, false);
+  quiz_assert(e.type() == ExpressionNode::Type::Integral);
+  double absoluteError;
+  double result = static_cast<Integral &>(e).approximateWithError<double>(&globalContext, Cartesian, Radian, &absoluteError);
+  quiz_assert_print_if_failure(std::fabs(result - approximation) <= maxAbsoluteError && absoluteError >= 0.0 && absoluteError <= maxAbsoluteError, expression);
+}
+
+QUIZ_CASE(poincare_approximation_integral_error) {
+  assert_integral_approximates_to("int(x^2,x,0,3)", 9.0, 1E-12);
+  assert_integral_approximates_to("int(int(x×x,x,0,x),x,0,4)", 64.0/3.0, 1E-10);
+  assert_integral_approximates_to("int(sin(x),x,0,1000)", 1.0 - std::cos(1000.0), 1E-6);
+  assert_integral_approximates_to("int(1/√(x),x,0,1)", 2.0, 1E-8);
+
+  // Undefined integrals have no error either
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression("int(1/x,x,-1,1)", false);
+  double absoluteError;
+  quiz_assert(std::isnan(static_cast<Integral &>(e).approximateWithError<double>(&globalContext, Cartesian, Radian, &absoluteError)));
+  quiz_assert(std::isnan(absoluteError));
+}
+
 QUIZ_CASE(poincare_approximation_trigonometry_functions) {
   /* cos: R  ->  R (oscillator)
    *      Ri ->  R (even)
@@ -928,6 +971,208 @@ QUIZ_CASE(poincare_approximation_mix) {
 }
 
 
+template<typename T>
+void assert_program_approximates_as_expression(const char * expression, Preferences::AngleUnit angleUnit = Radian, Preferences::ComplexFormat complexFormat = Real) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(expression, false);
+  ApproximationProgram program;
+  program.compile(e, "x", &globalContext, complexFormat, angleUnit);
+  quiz_assert_print_if_failure(program.isCompiled(), expression);
+  const T values[] = {-100.0, -2.0, -1.0, -0.5, 0.0, 0.25, 1.0, 3.0, 1000.0};
+  int numberOfApproximations = 0;
+  for (T x : values) {
+    T expected = e.approximateWithValueForSymbol<T>("x", x, &globalContext, complexFormat, angleUnit);
+    T result;
+    if (program.approximateWithValueForSymbol<T>(x, &result)) {
+      numberOfApproximations++;
+      quiz_assert_print_if_failure(result == expected || (std::isnan(result) && std::isnan(expected)), expression);
+    }
+  }
+  quiz_assert_print_if_failure(numberOfApproximations > 0, expression);
+}
+
+void assert_program_is_not_compiled(const char * expression) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(expression, false);
+  ApproximationProgram program;
+  program.compile(e, "x", &globalContext, Real, Radian);
+  quiz_assert_print_if_failure(!program.isCompiled(), expression);
+  double result;
+  quiz_assert_print_if_failure(!program.approximateWithValueForSymbol<double>(1.0, &result), expression);
+}
+
+template<typename T>
+void assert_batch_approximates_as_expression(const char * expression, Preferences::ComplexFormat complexFormat = Real) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(expression, false);
+  // More values than a program batch, some of which it gives up on
+  constexpr int numberOfValues = 2 * ApproximationProgram::k_batchLength + 3;
+  T values[numberOfValues];
+  T results[numberOfValues];
+  for (int i = 0; i < numberOfValues; i++) {
+    values[i] = (T)(i - numberOfValues/2) / (T)4.0;
+  }
+  e.approximateWithValuesForSymbol<T>("x", values, results, numberOfValues, &globalContext, complexFormat, Radian);
+  for (int i = 0; i < numberOfValues; i++) {
+    T expected = e.approximateWithValueForSymbol<T>("x", values[i], &globalContext, complexFormat, Radian);
+    quiz_assert_print_if_failure(results[i] == expected || (std::isnan(results[i]) && std::isnan(expected)), expression);
+  }
+}
+
+QUIZ_CASE(poincare_approximation_program) {
+  assert_program_approximates_as_expression<float>("3×x^2+2×x+1");
+  assert_program_approximates_as_expression<double>("3×x^2+2×x+1");
+  assert_program_approximates_as_expression<double>("(x-1)/(x+1)");
+  assert_program_approximates_as_expression<float>("1/x");
+  assert_program_approximates_as_expression<double>("x^0.5+√(x)");
+  assert_program_approximates_as_expression<double>("x^(1/3)");
+  assert_program_approximates_as_expression<float>("-x^3+abs(x)");
+  assert_program_approximates_as_expression<double>("sin(x)+cos(2x)×tan(x/3)", Radian);
+  assert_program_approximates_as_expression<double>("sin(x)+cos(2x)×tan(x/3)", Degree);
+  assert_program_approximates_as_expression<float>("sin(x)", Gradian);
+  assert_program_approximates_as_expression<double>("sin(π/4)×x+ℯ^(x/100)");
+  assert_program_approximates_as_expression<double>("ln(x)+log(x)+log(x,3)");
+  assert_program_approximates_as_expression<float>("log(x,x)");
+  assert_program_approximates_as_expression<double>("atan(x)+asin(x/1000)+acos(x/1000)", Degree);
+  assert_program_approximates_as_expression<double>("sinh(x/100)+cosh(x/100)-tanh(x)");
+  assert_program_approximates_as_expression<double>("floor(x)+ceil(x)+frac(x)+sign(x)");
+  assert_program_approximates_as_expression<double>("x^2", Radian, Cartesian);
+  assert_program_approximates_as_expression<double>("√(x)", Radian, Cartesian);
+
+  assert_program_is_not_compiled("y×x");
+  assert_program_is_not_compiled("random()×x");
+  assert_program_is_not_compiled("𝐢×x");
+  assert_program_is_not_compiled("[[x,1]]");
+  assert_program_is_not_compiled("x!");
+  assert_program_is_not_compiled("f(x)");
+  assert_program_is_not_compiled("int(x×t,t,0,1)");
+}
+
+template<typename T>
+void assert_program_encloses_expression(const char * expression, T xMin, T xMax, bool isContinuous, Preferences::AngleUnit angleUnit = Radian) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(expression, false);
+  ApproximationProgram program;
+  program.compile(e, "x", &globalContext, Real, angleUnit);
+  Interval<T> result;
+  quiz_assert_print_if_failure(program.approximateOnInterval<T>(Interval<T>(xMin, xMax), &result), expression);
+  quiz_assert_print_if_failure(result.isContinuous() == isContinuous, expression);
+  constexpr int numberOfValues = 50;
+  for (int i = 0; i <= numberOfValues; i++) {
+    T x = xMin + (xMax - xMin) * i / numberOfValues;
+    T y = e.approximateWithValueForSymbol<T>("x", x, &globalContext, Real, angleUnit);
+    T tolerance = 10 * Expression::Epsilon<T>() * std::fabs(y);
+    quiz_assert_print_if_failure(std::isnan(y) || (result.lowerBound() - tolerance <= y && y <= result.upperBound() + tolerance), expression);
+  }
+}
+
+QUIZ_CASE(poincare_approximation_interval) {
+  assert_program_encloses_expression<float>("3×x^2+2×x+1", -2.0f, 1.0f, true);
+  assert_program_encloses_expression<double>("x^3-x", -1.5, 0.5, true);
+  assert_program_encloses_expression<double>("√(x)+ln(x)", 0.5, 4.0, true);
+  assert_program_encloses_expression<double>("√(x)", -1.0, 4.0, false);
+  assert_program_encloses_expression<double>("1/x", 0.5, 2.0, true);
+  assert_program_encloses_expression<double>("1/x", -0.5, 2.0, false);
+  assert_program_encloses_expression<double>("x^(-2)", -0.5, 0.5, false);
+  assert_program_encloses_expression<double>("sin(x)+cos(2x)", -1.0, 6.0, true);
+  assert_program_encloses_expression<double>("sin(x)", 80.0, 100.0, true, Degree);
+  assert_program_encloses_expression<float>("tan(x)", -1.5f, 1.5f, true);
+  assert_program_encloses_expression<float>("tan(x)", 1.0f, 2.0f, false);
+  assert_program_encloses_expression<double>("ℯ^(x/2)+2^x+log(x,3)", 1.0, 3.0, true);
+  assert_program_encloses_expression<double>("abs(x)+cosh(x)+atan(x)+asin(x/4)", -2.0, 1.0, true);
+  assert_program_encloses_expression<double>("acos(x)", 0.0, 2.0, false);
+  assert_program_encloses_expression<double>("floor(x)+frac(x)+sign(x)", 0.25, 0.75, true);
+  assert_program_encloses_expression<double>("floor(x)", 0.5, 1.5, false);
+  assert_program_encloses_expression<double>("sign(x)", -1.0, 1.0, false);
+
+  // Powers of negative numbers are only real for some exponents
+  Shared::GlobalContext globalContext;
+  ApproximationProgram program;
+  program.compile(parse_expression("(-2)^x", false), "x", &globalContext, Real, Radian);
+  Interval<double> result;
+  quiz_assert(!program.approximateOnInterval<double>(Interval<double>(0.0, 1.0), &result));
+  program.compile(parse_expression("1/(x-x)", false), "x", &globalContext, Real, Radian);
+  quiz_assert(program.approximateOnInterval<double>(Interval<double>(0.0, 0.0), &result) && result.isUndefined());
+}
+
+QUIZ_CASE(poincare_approximation_batch) {
+  assert_batch_approximates_as_expression<float>("3×x^2+2×x+1");
+  assert_batch_approximates_as_expression<double>("√(x)+ln(x)");
+  assert_batch_approximates_as_expression<double>("√(x)", Cartesian);
+  assert_batch_approximates_as_expression<double>("x!");
+  assert_batch_approximates_as_expression<float>("𝐢×x", Cartesian);
+}
+
+QUIZ_CASE(poincare_approximation_scalar) {
+  // Complexes encountered on the way are undefined in real format
+  assert_expression_approximates_to_scalar<float>("𝐢^2", -1.0f, Radian, Cartesian);
+  assert_expression_approximates_to_scalar<float>("𝐢^2", NAN, Radian, Real);
+  assert_expression_approximates_to_scalar<double>("√(-1)×√(-1)", -1.0, Radian, Cartesian);
+  assert_expression_approximates_to_scalar<double>("√(-1)×√(-1)", NAN, Radian, Real);
+  assert_expression_approximates_to_scalar<double>("log(-2,-2)", 1.0, Radian, Cartesian);
+  assert_expression_approximates_to_scalar<double>("log(-2,-2)", NAN, Radian, Real);
+  assert_expression_approximates_to_scalar<double>("log(10,2)", 3.3219280948873626, Radian, Real);
+  assert_expression_approximates_to_scalar<double>("sinh(1)-cosh(1)+tanh(1)", 0.3937147147843225, Radian, Real);
+
+  // Matrices have no scalar approximation, but their scalar functions do
+  assert_expression_approximates_to_scalar<float>("[[1]]", NAN);
+  assert_expression_approximates_to_scalar<float>("[[1]]^0", NAN);
+  assert_expression_approximates_to_scalar<double>("2×ln([[1,2][3,4]])", NAN);
+  assert_expression_approximates_to_scalar<double>("det([[1,2][3,4]])+1", -1.0);
+  assert_expression_approximates_to_scalar<float>("trace([[1,2][3,4]])×2", 10.0f);
+  assert_expression_approximates_to_scalar<double>("sum([[n]],n,1,2)", NAN);
+  assert_expression_approximates_to_scalar<double>("quo([[7]],2)", NAN);
+
+  // Parametered expressions
+  assert_expression_approximates_to_scalar<double>("sum(n,n,1,4)+product(n,n,1,4)", 34.0);
+  assert_expression_approximates_to_scalar<double>("sum(𝐢^(2n),n,1,1)", -1.0, Radian, Cartesian);
+  assert_expression_approximates_to_scalar<double>("sum(𝐢^(2n),n,1,1)", NAN, Radian, Real);
+  assert_expression_approximates_to_scalar<double>("int(x,x,0,1)+diff(x^2,x,3)", 6.5);
+  assert_expression_approximates_to_scalar<double>("root(-8,3)", -2.0, Radian, Real);
+}
+
+QUIZ_CASE(poincare_approximation_scalar_benchmark) {
+  /* The scalar approximation of expressions without matrices and without
+   * symbols does not allocate any node in the pool, whereas approximating
+   * them to Evaluations does. */
+  const char * expressions[] = {
+    "1+2×3-4/5",
+    "2^(1/3)×√(2)",
+    "ln(ℯ^3)+log(8,2)",
+    "cos(π/3)+sin(π/6)-tan(π/4)",
+    "acos(0.5)+asin(0.5)+atan(1)",
+    "cosh(1)+sinh(1)+tanh(1)+acosh(2)+asinh(2)+atanh(0.5)",
+    "abs(-3)+floor(2.5)+ceil(2.5)+frac(2.5)+sign(-2)+3!",
+    "re(2+3𝐢)+im(2+3𝐢)+arg(𝐢)+abs(conj(1+𝐢)×(1+𝐢))",
+    "-(1.5ᴇ3)/(2-(3))",
+    "quo(7,2)+rem(7,2)+gcd(12,18)+lcm(4,6)+round(2.345,2)",
+    "binomial(5,2)+permute(5,2)+root(8,3)",
+    "normcdf(1,0,1)+normcdf2(0,1,0,1)+normpdf(0,0,1)+invnorm(0.3,0,1)",
+    "binomcdf(2,5,0.5)+binompdf(2,5,0.5)+invbinom(0.5,5,0.5)"
+  };
+  Shared::GlobalContext globalContext;
+  TreePool * pool = TreePool::sharedPool();
+  for (const char * expression : expressions) {
+    Expression e = parse_expression(expression, false);
+    size_t liveBytes = pool->liveBytes();
+    pool->resetStatistics();
+    double scalar = e.approximateToScalar<double>(&globalContext, Cartesian, Radian);
+    quiz_assert_print_if_failure(!std::isnan(scalar), expression);
+    quiz_assert_print_if_failure(pool->statistics().peakLiveBytes == liveBytes, expression);
+    pool->resetStatistics();
+    Expression approximation = e.approximate<double>(&globalContext, Cartesian, Radian);
+    quiz_assert_print_if_failure(pool->statistics().peakLiveBytes > liveBytes, expression);
+    // The approximation is built with 14 significant digits
+    quiz_assert_print_if_failure(std::fabs(approximation.approximateToScalar<double>(&globalContext, Cartesian, Radian) - scalar) <= 1E-13 * std::fabs(scalar), expression);
+  }
+  // Random nodes cannot be compared to their Evaluations
+  Expression e = parse_expression("random()+randint(1,3)", false);
+  size_t liveBytes = pool->liveBytes();
+  pool->resetStatistics();
+  quiz_assert(!std::isnan(e.approximateToScalar<double>(&globalContext, Cartesian, Radian)));
+  quiz_assert(pool->statistics().peakLiveBytes == liveBytes);
+}
+
 template void assert_expression_approximates_to_scalar(const char * expression, float approximation, Preferences::AngleUnit angleUnit, Preferences::ComplexFormat complexFormat);
 template void assert_expression_approximates_to_scalar(const char * expression, double approximation, Preferences::AngleUnit angleUnit, Preferences::ComplexFormat complexFormat);
 
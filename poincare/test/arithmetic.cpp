@@ -54,12 +54,28 @@ void assert_prime_factorization_equals_to(Integer a, int * factors, int * coeffi
   }
 }
 
+void assert_prime_factorization_equals_to(Integer a, const char * factors[], int * coefficients, int length) {
+  Integer outputFactors[Arithmetic::k_maxNumberOfPrimeFactors];
+  Integer outputCoefficients[Arithmetic::k_maxNumberOfPrimeFactors];
+  int numberOfFactors = Arithmetic::PrimeFactorization(a, outputFactors, outputCoefficients, Arithmetic::k_maxNumberOfPrimeFactors);
+  constexpr size_t bufferSize = 100;
+  char failInformationBuffer[bufferSize];
+  fill_buffer_with(failInformationBuffer, bufferSize, "factor(", &a, 1);
+  quiz_assert_print_if_failure(numberOfFactors == length, failInformationBuffer);
+  for (int index = 0; index < length; index++) {
+    quiz_assert_print_if_failure(outputFactors[index].isEqualTo(Integer(factors[index])), failInformationBuffer);
+    quiz_assert_print_if_failure(outputCoefficients[index].isEqualTo(Integer(coefficients[index])), failInformationBuffer);
+  }
+}
+
 QUIZ_CASE(poincare_arithmetic_gcd) {
   assert_gcd_equals_to(Integer(11), Integer(121), Integer(11));
   assert_gcd_equals_to(Integer(-256), Integer(321), Integer(1));
   assert_gcd_equals_to(Integer(-8), Integer(-40), Integer(8));
   assert_gcd_equals_to(Integer("1234567899876543456"), Integer("234567890098765445678"), Integer(2));
   assert_gcd_equals_to(Integer("45678998789"), Integer("1461727961248"), Integer("45678998789"));
+  assert_gcd_equals_to(Integer("18446744030759878681"), Integer("-12884901873"), Integer("4294967291"));
+  assert_gcd_equals_to(Integer(0), Integer("-18446744073709551557"), Integer("18446744073709551557"));
 }
 
 QUIZ_CASE(poincare_arithmetic_lcm) {
@@ -84,3 +100,38 @@ QUIZ_CASE(poincare_arithmetic_factorization) {
   int coefficients3[7] = {4,2,2,2,2,2,2};
   assert_prime_factorization_equals_to(Integer("5513219850886344455940081"), factors3, coefficients3, 7);
 }
+
+QUIZ_CASE(poincare_arithmetic_factorization_large_prime_factors) {
+  // Prime factors above the table primeFactors are found by Pollard's rho
+  const char * factors0[2] = {"1000000007", "1000000009"};
+  int coefficients0[2] = {1, 1};
+  assert_prime_factorization_equals_to(Integer("1000000016000000063"), factors0, coefficients0, 2);
+  // Montgomery products on a modulus above 2^63
+  const char * factors1[1] = {"4294967291"};
+  int coefficients1[1] = {2};
+  assert_prime_factorization_equals_to(Integer("18446744030759878681"), factors1, coefficients1, 1);
+  const char * factors2[2] = {"4294967279", "4294967291"};
+  int coefficients2[2] = {1, 1};
+  assert_prime_factorization_equals_to(Integer("18446743979220271189"), factors2, coefficients2, 2);
+  const char * factors3[1] = {"18446744073709551557"};
+  int coefficients3[1] = {1};
+  assert_prime_factorization_equals_to(Integer("18446744073709551557"), factors3, coefficients3, 1);
+  // The cofactor fits in a native word once small factors are divided out
+  const char * factors4[3] = {"2", "1000000007", "1000000009"};
+  int coefficients4[3] = {40, 1, 1};
+  assert_prime_factorization_equals_to(Integer("1099511645368186113685232549888"), factors4, coefficients4, 3);
+  const char * factors5[4] = {"3", "7919", "10007", "1000000007"};
+  int coefficients5[4] = {1, 1, 2, 1};
+  assert_prime_factorization_equals_to(Integer("2379027160746190008651"), factors5, coefficients5, 4);
+  // Several prime factors whose differences may share a batch of gcds
+  const char * factors6[3] = {"1000003", "1000033", "1000037"};
+  int coefficients6[3] = {1, 1, 1};
+  assert_prime_factorization_equals_to(Integer("1000073001431003663"), factors6, coefficients6, 3);
+  const char * factors7[4] = {"7927", "7933", "7937", "7949"};
+  int coefficients7[4] = {1, 1, 1, 1};
+  assert_prime_factorization_equals_to(Integer("3967484052562783"), factors7, coefficients7, 4);
+  // Special case 2: the cofactor 9999999943*9999999967 does not fit in a native word
+  Integer outputFactors[Arithmetic::k_maxNumberOfPrimeFactors];
+  Integer outputCoefficients[Arithmetic::k_maxNumberOfPrimeFactors];
+  quiz_assert(Arithmetic::PrimeFactorization(Integer("699999993700000013167"), outputFactors, outputCoefficients, Arithmetic::k_maxNumberOfPrimeFactors) == -2);
+}
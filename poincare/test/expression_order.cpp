@@ -227,3 +227,22 @@ QUIZ_CASE(poincare_expression_order_addition_multiplication) {
     assert_multiplication_or_addition_is_ordered_as(e1, e2);
   }
 }
+
+QUIZ_CASE(poincare_expression_order_identical) {
+  // Expressions with a null simplification order are identical
+  Expression x = Symbol::Builder('x');
+  quiz_assert(Power::Builder(x.clone(), Rational::Builder(1)).isIdenticalTo(x));
+  quiz_assert(Addition::Builder(x.clone()).isIdenticalTo(x));
+  quiz_assert(Multiplication::Builder(Power::Builder(x.clone(), Rational::Builder(1))).isIdenticalTo(x));
+  quiz_assert(!Power::Builder(x.clone(), Rational::Builder(2)).isIdenticalTo(x));
+
+  // The cached hashes are invalidated when the tree is modified
+  Expression e1 = Sine::Builder(Addition::Builder(Symbol::Builder('x'), Symbol::Builder('y')));
+  Expression e2 = Sine::Builder(Addition::Builder(Symbol::Builder('x'), Symbol::Builder('z')));
+  quiz_assert(!e1.isIdenticalTo(e2));
+  Expression a = e1.childAtIndex(0);
+  a.replaceChildAtIndexInPlace(1, Symbol::Builder('z'));
+  quiz_assert(e1.isIdenticalTo(e2));
+  static_cast<Addition &>(a).addChildAtIndexInPlace(Rational::Builder(2), 2, 2);
+  quiz_assert(!e1.isIdenticalTo(e2));
+}
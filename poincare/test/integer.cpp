@@ -197,6 +197,15 @@ static inline void assert_pow_to(const Integer i, const Integer j, const Integer
 QUIZ_CASE(poincare_integer_pow) {
   assert_pow_to(Integer(2), Integer(2), Integer(4));
   assert_pow_to(Integer("12345678910111213141516171819202122232425"), Integer(2), Integer("152415787751564791571474464067365843004067618915106260955633159458990465721380625"));
+  assert_pow_to(Integer(7), Integer(0), Integer(1));
+  assert_pow_to(Integer(0), Integer(5), Integer(0));
+  assert_pow_to(Integer(-1), Integer("12345678910111213141516171819202122232425"), Integer(-1));
+  assert_pow_to(Integer(-3), Integer(5), Integer(-243));
+  assert_pow_to(Integer(-3), Integer(6), Integer(729));
+  assert_pow_to(Integer(2), Integer(100), Integer("1267650600228229401496703205376"));
+  assert_pow_to(Integer(3), Integer(600), Integer("18739277038847939886754019920358123424308469030992781557966909983211910963157763678726120154469030856807730587971859910379069087693119051085139566217370635083384943613868029545256897117998608156843699465093293765833141309526696357142600866935689483770877815014461194837692223879905132001"));
+  assert_pow_to(Integer(2), Integer(1024), OverflowedInteger());
+  assert_pow_to(Integer(2), Integer("123456789123456789"), OverflowedInteger());
 }
 
 static inline void assert_factorial_to(const Integer i, const Integer j) {
@@ -206,6 +215,24 @@ static inline void assert_factorial_to(const Integer i, const Integer j) {
 QUIZ_CASE(poincare_integer_factorial) {
   assert_factorial_to(Integer(5), Integer(120));
   assert_factorial_to(Integer(123), Integer("12146304367025329675766243241881295855454217088483382315328918161829235892362167668831156960612640202170735835221294047782591091570411651472186029519906261646730733907419814952960000000000000000000000000000"));
+  assert_factorial_to(Integer(0), Integer(1));
+  assert_factorial_to(Integer(1), Integer(1));
+  assert_factorial_to(Integer(171), OverflowedInteger());
+  assert_factorial_to(Integer("123456789123456789"), OverflowedInteger());
+}
+
+static inline void assert_binomial_coefficient_to(const Integer n, const Integer k, const Integer result) {
+  quiz_assert(Integer::NaturalOrder(Integer::BinomialCoefficient(n, k), result) == 0);
+}
+
+QUIZ_CASE(poincare_integer_binomial_coefficient) {
+  assert_binomial_coefficient_to(Integer(5), Integer(0), Integer(1));
+  assert_binomial_coefficient_to(Integer(5), Integer(5), Integer(1));
+  assert_binomial_coefficient_to(Integer(10), Integer(3), Integer(120));
+  assert_binomial_coefficient_to(Integer(299), Integer(150), Integer("46879851386413726396596877219532042439616327850040679460236176356487585010919795837930712"));
+  // The largest central binomial coefficient below 2^1024 does not overflow
+  assert_binomial_coefficient_to(Integer(1029), Integer(514), Integer("142982068649890408187856501708946414492523688245539947958032915466404092257754311668145358013801743919420329189264245951426484919524939028626144176498562835136312109604696782164330049719104866205700507349956012685273880851820225300107617483352072800755694184013832459568397308655630264694349713414866614528700"));
+  assert_binomial_coefficient_to(Integer(1030), Integer(515), OverflowedInteger());
 }
 
 // Simplify
@@ -90,3 +90,46 @@ QUIZ_CASE(tree_handle_does_not_copy) {
   PairByReference p2 = p;
   assert_pool_size(initialPoolSize+3);
 }
+
+QUIZ_CASE(tree_handle_discards_tree_at_once) {
+  int initialPoolSize = pool_size();
+  TreePool * pool = TreePool::sharedPool();
+  {
+    TreeHandle tree = BlobByReference::Builder(1);
+    for (int i = 0; i < 10; i++) {
+      tree = PairByReference::Builder(tree, BlobByReference::Builder(1));
+    }
+    assert_pool_size(initialPoolSize+21);
+    pool->resetStatistics();
+  }
+  assert_pool_size(initialPoolSize);
+  // The whole tree was only retained by its root: it is compacted in one go
+  quiz_assert(pool->statistics().numberOfCompactions == 1);
+}
+
+QUIZ_CASE(tree_handle_keeps_retained_descendants) {
+  int initialPoolSize = pool_size();
+  BlobByReference b = BlobByReference::Builder(3);
+  {
+    PairByReference p = PairByReference::Builder(BlobByReference::Builder(1), PairByReference::Builder(b, BlobByReference::Builder(2)));
+    assert_pool_size(initialPoolSize+5);
+  }
+  assert_pool_size(initialPoolSize+1);
+  quiz_assert(b.data() == 3);
+}
+
+QUIZ_CASE(tree_handle_counts_pool_full_aborts) {
+  TreePool * pool = TreePool::sharedPool();
+  pool->resetStatistics();
+  Poincare::ExceptionCheckpoint ecp;
+  if (ExceptionRun(ecp)) {
+    TreeHandle tree = BlobByReference::Builder(1);
+    while (true) {
+      tree = PairByReference::Builder(tree, BlobByReference::Builder(1));
+    }
+  } else {
+    Poincare::Tidy();
+  }
+  quiz_assert(pool->statistics().numberOfPoolFullAborts == 1);
+  quiz_assert(pool->statistics().peakLiveBytes <= 32768);
+}
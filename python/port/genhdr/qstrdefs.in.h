@@ -72,6 +72,10 @@ Q(draw_string)
 Q(fill_rect)
 Q(get_pixel)
 Q(set_pixel)
+Q(set_pixels)
+Q(blit)
+Q(flush)
+Q(set_buffering)
 
 // Turtle QSTRs
 Q(turtle)
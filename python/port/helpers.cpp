@@ -2,6 +2,7 @@
 #include <ion.h>
 extern "C" {
 #include "mphalport.h"
+#include "mod/kandinsky/modkandinsky.h"
 }
 
 bool micropython_port_vm_hook_loop() {
@@ -18,12 +19,16 @@ bool micropython_port_vm_hook_loop() {
     return false;
   }
 
+  // Show what was drawn with kandinsky.set_pixel since the last time
+  modkandinsky_push_buffered_pixels();
+
   // Check if the user asked for an interruption from the keyboard
   return micropython_port_interrupt_if_needed();
 }
 
 bool micropython_port_interruptible_msleep(int32_t delay) {
   assert(delay >= 0);
+  modkandinsky_push_buffered_pixels();
   /* We don't use millis because the systick drifts when changing the HCLK
    * frequency. */
   constexpr int32_t interruptionCheckDelay = 100;
@@ -6,6 +6,32 @@ extern "C" {
 #include <kandinsky.h>
 #include "port.h"
 
+/* The pixels set by set_pixel are buffered in a tile, which is pushed to the
+ * screen before drawing anything else, and when the script sleeps, waits for
+ * an input or ends. It is also pushed every now and then by the VM hook, for
+ * the drawing to show while the script runs. The tile takes 2.2KB of static
+ * RAM. Buffering can be turned off with set_buffering, for each pixel to show
+ * as soon as it is set, and is turned on again at the start of each Python
+ * session. */
+static KDTileBuffer * SharedTileBuffer() {
+  static KDTileBuffer tileBuffer(KDIonContext::sharedContext());
+  return &tileBuffer;
+}
+
+static bool sBufferingIsEnabled = true;
+
+void modkandinsky_enable_buffering() {
+  sBufferingIsEnabled = true;
+}
+
+void modkandinsky_push_buffered_pixels() {
+  SharedTileBuffer()->flush();
+}
+
+void modkandinsky_discard_buffered_pixels() {
+  SharedTileBuffer()->discard();
+}
+
 static KDColor ColorForTuple(mp_obj_t tuple) {
     size_t len;
     mp_obj_t * elem;
@@ -51,7 +77,10 @@ mp_obj_t modkandinsky_color(mp_obj_t red, mp_obj_t green, mp_obj_t blue) {
 
 mp_obj_t modkandinsky_get_pixel(mp_obj_t x, mp_obj_t y) {
   KDPoint point(mp_obj_get_int(x), mp_obj_get_int(y));
-  KDColor c = KDIonContext::sharedContext()->getPixel(point);
+  KDColor c;
+  if (!SharedTileBuffer()->getPixel(point, &c)) {
+    c = KDIonContext::sharedContext()->getPixel(point);
+  }
   return TupleForRGB(c.red(), c.green(), c.blue());
 }
 
@@ -59,7 +88,90 @@ mp_obj_t modkandinsky_set_pixel(mp_obj_t x, mp_obj_t y, mp_obj_t color) {
   KDPoint point(mp_obj_get_int(x), mp_obj_get_int(y));
   KDColor kdColor = ColorForTuple(color);
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
-  KDIonContext::sharedContext()->setPixel(point, kdColor);
+  if (sBufferingIsEnabled) {
+    SharedTileBuffer()->setPixel(point, kdColor);
+  } else {
+    KDIonContext::sharedContext()->setPixel(point, kdColor);
+  }
+  return mp_const_none;
+}
+
+/* set_pixels and blit push their pixels by chunks of k_chunkSize, the chunks
+ * of blit being made of whole rows when they fit. */
+static constexpr int k_chunkSize = 128;
+
+mp_obj_t modkandinsky_set_pixels(mp_obj_t x, mp_obj_t y, mp_obj_t colors) {
+  KDPoint point(mp_obj_get_int(x), mp_obj_get_int(y));
+  size_t numberOfColors;
+  mp_obj_t * colorTuples;
+  mp_obj_get_array(colors, &numberOfColors, &colorTuples);
+  // Check the colors before displaying the sandbox
+  for (size_t i = 0; i < numberOfColors; i++) {
+    ColorForTuple(colorTuples[i]);
+  }
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  SharedTileBuffer()->flush();
+  KDColor chunk[k_chunkSize];
+  for (size_t i = 0; i < numberOfColors; i += k_chunkSize) {
+    int chunkLength = numberOfColors - i < k_chunkSize ? numberOfColors - i : k_chunkSize;
+    for (int j = 0; j < chunkLength; j++) {
+      chunk[j] = ColorForTuple(colorTuples[i + j]);
+    }
+    KDRect chunkRect(point.x() + i, point.y(), chunkLength, 1);
+    KDIonContext::sharedContext()->fillRectWithPixels(chunkRect, chunk, nullptr);
+  }
+  // Cf comment on modkandinsky_draw_string
+  micropython_port_interrupt_if_needed();
+  return mp_const_none;
+}
+
+mp_obj_t modkandinsky_blit(size_t n_args, const mp_obj_t * args) {
+  KDCoordinate x = mp_obj_get_int(args[0]);
+  KDCoordinate y = mp_obj_get_int(args[1]);
+  mp_int_t width = mp_obj_get_int(args[2]);
+  mp_int_t height = mp_obj_get_int(args[3]);
+  mp_buffer_info_t buffer;
+  mp_get_buffer_raise(args[4], &buffer, MP_BUFFER_READ);
+  if (width < 0 || height < 0 || buffer.len != static_cast<size_t>(2 * width * height)) {
+    mp_raise_ValueError("buffer needs 2 bytes per pixel");
+  }
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  SharedTileBuffer()->flush();
+  // Each pixel is a 16-bit RGB565 color, most significant byte first
+  const uint8_t * bytes = static_cast<const uint8_t *>(buffer.buf);
+  KDColor chunk[k_chunkSize];
+  /* Narrow buffers are pushed several rows at a time, wide ones row by row,
+   * each row being cut in chunks. */
+  mp_int_t chunkWidth = width < k_chunkSize ? width : k_chunkSize;
+  mp_int_t chunkHeight = width > 0 && width < k_chunkSize ? k_chunkSize / width : 1;
+  for (mp_int_t j = 0; j < height; j += chunkHeight) {
+    mp_int_t numberOfRows = height - j < chunkHeight ? height - j : chunkHeight;
+    for (mp_int_t i = 0; i < width; i += chunkWidth) {
+      mp_int_t numberOfColumns = width - i < chunkWidth ? width - i : chunkWidth;
+      for (mp_int_t row = 0; row < numberOfRows; row++) {
+        const uint8_t * pixel = bytes + 2 * ((j + row) * width + i);
+        for (mp_int_t column = 0; column < numberOfColumns; column++) {
+          chunk[row * numberOfColumns + column] = KDColor::RGB16(pixel[0] << 8 | pixel[1]);
+          pixel += 2;
+        }
+      }
+      KDRect chunkRect(x + i, y + j, numberOfColumns, numberOfRows);
+      KDIonContext::sharedContext()->fillRectWithPixels(chunkRect, chunk, chunk);
+    }
+  }
+  // Cf comment on modkandinsky_draw_string
+  micropython_port_interrupt_if_needed();
+  return mp_const_none;
+}
+
+mp_obj_t modkandinsky_flush() {
+  SharedTileBuffer()->flush();
+  return mp_const_none;
+}
+
+mp_obj_t modkandinsky_set_buffering(mp_obj_t enabled) {
+  SharedTileBuffer()->flush();
+  sBufferingIsEnabled = mp_obj_is_true(enabled);
   return mp_const_none;
 }
 
@@ -69,6 +181,7 @@ mp_obj_t modkandinsky_draw_string(size_t n_args, const mp_obj_t * args) {
   KDColor textColor = (n_args >= 4) ? ColorForTuple(args[3]) : KDColorBlack;
   KDColor backgroundColor = (n_args >= 5) ? ColorForTuple(args[4]) : KDColorWhite;
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  SharedTileBuffer()->flush();
   KDIonContext::sharedContext()->drawString(text, point, KDFont::LargeFont, textColor, backgroundColor);
   /* Before and after execution of "modkandinsky_draw_string",
    * "micropython_port_vm_hook_loop" is called by "mp_execute_bytecode" and will
@@ -92,6 +205,7 @@ mp_obj_t modkandinsky_fill_rect(size_t n_args, const mp_obj_t * args) {
   );
   KDColor color = ColorForTuple(args[4]);
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  SharedTileBuffer()->flush();
   KDIonContext::sharedContext()->fillRect(rect, color);
   // Cf comment on modkandinsky_draw_string
   micropython_port_interrupt_if_needed();
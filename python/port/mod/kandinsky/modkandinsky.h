@@ -5,3 +5,14 @@ mp_obj_t modkandinsky_get_pixel(mp_obj_t x, mp_obj_t y);
 mp_obj_t modkandinsky_set_pixel(mp_obj_t x, mp_obj_t y, mp_obj_t color);
 mp_obj_t modkandinsky_draw_string(size_t n_args, const mp_obj_t *args);
 mp_obj_t modkandinsky_fill_rect(size_t n_args, const mp_obj_t *args);
+mp_obj_t modkandinsky_set_pixels(mp_obj_t x, mp_obj_t y, mp_obj_t colors);
+mp_obj_t modkandinsky_blit(size_t n_args, const mp_obj_t *args);
+mp_obj_t modkandinsky_flush();
+mp_obj_t modkandinsky_set_buffering(mp_obj_t enabled);
+
+// Push the pixels buffered by set_pixel to the screen
+void modkandinsky_push_buffered_pixels();
+// Forget them once the sandbox they were drawn on is hidden
+void modkandinsky_discard_buffered_pixels();
+// Turn buffering back on, at the start of each Python session
+void modkandinsky_enable_buffering();
@@ -5,6 +5,10 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(modkandinsky_get_pixel_obj, modkandinsky_get_pi
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(modkandinsky_set_pixel_obj, modkandinsky_set_pixel);
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modkandinsky_draw_string_obj, 3, 5, modkandinsky_draw_string);
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modkandinsky_fill_rect_obj, 5, 5, modkandinsky_fill_rect);
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(modkandinsky_set_pixels_obj, modkandinsky_set_pixels);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modkandinsky_blit_obj, 5, 5, modkandinsky_blit);
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(modkandinsky_flush_obj, modkandinsky_flush);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modkandinsky_set_buffering_obj, modkandinsky_set_buffering);
 
 STATIC const mp_rom_map_elem_t modkandinsky_module_globals_table[] = {
   { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_kandinsky) },
@@ -13,6 +17,10 @@ STATIC const mp_rom_map_elem_t modkandinsky_module_globals_table[] = {
   { MP_ROM_QSTR(MP_QSTR_set_pixel), (mp_obj_t)&modkandinsky_set_pixel_obj },
   { MP_ROM_QSTR(MP_QSTR_draw_string), (mp_obj_t)&modkandinsky_draw_string_obj },
   { MP_ROM_QSTR(MP_QSTR_fill_rect), (mp_obj_t)&modkandinsky_fill_rect_obj },
+  { MP_ROM_QSTR(MP_QSTR_set_pixels), (mp_obj_t)&modkandinsky_set_pixels_obj },
+  { MP_ROM_QSTR(MP_QSTR_blit), (mp_obj_t)&modkandinsky_blit_obj },
+  { MP_ROM_QSTR(MP_QSTR_flush), (mp_obj_t)&modkandinsky_flush_obj },
+  { MP_ROM_QSTR(MP_QSTR_set_buffering), (mp_obj_t)&modkandinsky_set_buffering_obj },
 };
 
 STATIC MP_DEFINE_CONST_DICT(modkandinsky_module_globals, modkandinsky_module_globals_table);
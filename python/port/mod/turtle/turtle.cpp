@@ -3,6 +3,7 @@
 #include <cmath>
 extern "C" {
 #include <py/misc.h>
+#include "../kandinsky/modkandinsky.h"
 }
 #include "../../helpers.h"
 #include "../../port.h"
@@ -26,6 +27,7 @@ template <typename T> static inline T * allocate(size_t count) {
 
 void Turtle::reset() {
   // Erase the drawing
+  modkandinsky_push_buffered_pixels();
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->resetSandbox();
 
   // Reset turtle values
@@ -267,6 +269,8 @@ KDRect Turtle::iconRect() const {
 
 bool Turtle::draw(bool force) {
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  // Draw on top of the pixels set with kandinsky
+  modkandinsky_push_buffered_pixels();
 
   if ((m_speed > 0 || force) && m_visible && !m_drawn && hasUnderneathPixelBuffer()) {
     KDContext * ctx = KDIonContext::sharedContext();
@@ -348,6 +352,7 @@ bool Turtle::draw(bool force) {
 
 bool Turtle::dot(mp_float_t x, mp_float_t y) {
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  modkandinsky_push_buffered_pixels();
 
   // Draw the dot if the pen is down
   if (m_penDown && hasDotBuffers()) {
@@ -400,6 +405,7 @@ void Turtle::erase() {
   if (!m_drawn || m_underneathPixelBuffer == nullptr) {
     return;
   }
+  modkandinsky_push_buffered_pixels();
   KDContext * ctx = KDIonContext::sharedContext();
   ctx->fillRectWithPixels(iconRect(), m_underneathPixelBuffer, nullptr);
   m_drawn = false;
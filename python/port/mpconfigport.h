@@ -35,6 +35,12 @@
 // add bunch of once-off options. May need refactoring later
 #define MICROPY_CPYTHON_COMPAT (0)
 
+// Imported scripts are compiled to bytecode that the script provider can keep,
+// and are then loaded as frozen modules from that bytecode
+#define MICROPY_PERSISTENT_CODE_LOAD (1)
+#define MICROPY_PERSISTENT_CODE_SAVE (1)
+#define MICROPY_MODULE_FROZEN_MPY (1)
+
 // modturtle needs a hook upon init
 #define MICROPY_MODULE_BUILTIN_INIT (1)
 
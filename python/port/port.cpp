@@ -10,15 +10,18 @@
 extern "C" {
 #include "py/builtin.h"
 #include "py/compile.h"
+#include "py/frozenmod.h"
 #include "py/gc.h"
 #include "py/lexer.h"
 #include "py/mperrno.h"
 #include "py/mphal.h"
 #include "py/nlr.h"
+#include "py/persistentcode.h"
 #include "py/repl.h"
 #include "py/runtime.h"
 #include "py/stackctrl.h"
 #include "mphalport.h"
+#include "mod/kandinsky/modkandinsky.h"
 #include "mod/turtle/modturtle.h"
 }
 
@@ -77,6 +80,7 @@ void MicroPython::ExecutionEnvironment::runCode(const char * str) {
     mp_print_str(&mp_plat_print, "\n");
     /* End of mp_obj_print_exception. */
   }
+  modkandinsky_push_buffered_pixels();
 
   assert(sCurrentExecutionEnvironment == this);
   sCurrentExecutionEnvironment = nullptr;
@@ -88,6 +92,7 @@ void MicroPython::ExecutionEnvironment::interrupt() {
 
 void MicroPython::ExecutionEnvironment::setSandboxIsDisplayed(bool display) {
   if (m_sandboxIsDisplayed && !display) {
+    modkandinsky_discard_buffered_pixels();
     modturtle_view_did_disappear();
   }
   m_sandboxIsDisplayed = display;
@@ -109,6 +114,7 @@ void MicroPython::init(void * heapStart, void * heapEnd) {
 #endif
   gc_init(heapStart, heapEnd);
   mp_init();
+  modkandinsky_enable_buffering();
 }
 
 void MicroPython::deinit() {
@@ -189,6 +195,50 @@ mp_lexer_t * mp_lexer_new_from_file(const char * filename) {
   }
 }
 
+/* Scripts are imported as frozen modules made of bytecode, which is either
+ * kept by the script provider from a previous import or compiled from the
+ * script and then handed to the provider. mp_import_stat finds the scripts, so
+ * no path is reported as a frozen module. */
+
+mp_import_stat_t mp_frozen_stat(const char * str) {
+  return MP_IMPORT_STAT_NO_EXIST;
+}
+
+int mp_find_frozen_module(const char * str, size_t len, void ** data) {
+  if (sScriptProvider == nullptr) {
+    return MP_FROZEN_NONE;
+  }
+  size_t bytecodeSize;
+  const void * bytecode = sScriptProvider->bytecodeOfScript(str, &bytecodeSize);
+  if (bytecode != nullptr) {
+    *data = mp_raw_code_load_mem(static_cast<const byte *>(bytecode), bytecodeSize);
+    return MP_FROZEN_MPY;
+  }
+  const char * script = sScriptProvider->contentOfScript(str);
+  if (script == nullptr) {
+    return MP_FROZEN_NONE;
+  }
+  mp_lexer_t * lex = mp_lexer_new_from_str_len(qstr_from_strn(str, len), script, strlen(script), 0);
+  qstr sourceName = lex->source_name;
+  mp_parse_tree_t parseTree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+  sScriptProvider->willCompileScript(str, parseTree.root);
+  mp_raw_code_t * rawCode = mp_compile_to_raw_code(&parseTree, sourceName, MP_EMIT_OPT_NONE, false);
+  /* The module can be imported even if there is no memory left to save its
+   * bytecode. */
+  nlr_buf_t nlr;
+  if (nlr_push(&nlr) == 0) {
+    vstr_t savedBytecode;
+    mp_print_t print;
+    vstr_init_print(&savedBytecode, 64, &print);
+    mp_raw_code_save(rawCode, &print);
+    sScriptProvider->didCompileScript(str, savedBytecode.buf, savedBytecode.len);
+    vstr_clear(&savedBytecode);
+    nlr_pop();
+  }
+  *data = rawCode;
+  return MP_FROZEN_MPY;
+}
+
 mp_import_stat_t mp_import_stat(const char *path) {
   if (sScriptProvider && sScriptProvider->contentOfScript(path)) {
     return MP_IMPORT_STAT_FILE;
@@ -203,5 +253,6 @@ void mp_hal_stdout_tx_strn_cooked(const char * str, size_t len) {
 
 const char * mp_hal_input(const char * prompt) {
   assert(sCurrentExecutionEnvironment != nullptr);
+  modkandinsky_push_buffered_pixels();
   return sCurrentExecutionEnvironment->inputText(prompt);
 }
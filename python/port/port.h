@@ -3,6 +3,7 @@
 
 extern "C" {
 #include <stddef.h>
+#include "py/parse.h"
 }
 
 namespace MicroPython {
@@ -10,6 +11,15 @@ namespace MicroPython {
 class ScriptProvider {
 public:
   virtual const char * contentOfScript(const char * name) = 0;
+  /* Imported scripts are compiled to bytecode, that the provider can keep to
+   * import the scripts again without compiling them while they are unchanged.
+   * bytecodeOfScript returns nullptr when the provider has no bytecode for the
+   * current content of the script. Before being compiled, the parse tree of
+   * the script is handed to willCompileScript, and its bytecode is then handed
+   * to didCompileScript. */
+  virtual const void * bytecodeOfScript(const char * name, size_t * size) { return nullptr; }
+  virtual void willCompileScript(const char * name, mp_parse_node_t root) {}
+  virtual void didCompileScript(const char * name, const void * bytecode, size_t size) {}
 };
 
 class ExecutionEnvironment {